@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "hhc_arithmetic.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @file arithmetic_bench.cpp
+ * @brief Benchmarks for advancing encoded cursors; reports items per second.
+ */
+
+namespace {
+
+using hhc::bench::Permuted32;
+
+using std::vector;
+using benchmark::DoNotOptimize;
+using benchmark::ClobberMemory;
+
+constexpr std::size_t CURSOR_COUNT = 1024;
+constexpr uint64_t PAGE_SIZE = 50;
+
+vector<char> random_cursors() {
+    Permuted32 permuted32(rand());
+    vector<char> cursors(CURSOR_COUNT * hhc::hhc64_codec::ENCODED_LENGTH);
+    for (std::size_t i = 0; i < CURSOR_COUNT; ++i) {
+        const uint64_t id = (static_cast<uint64_t>(permuted32.next() >> 1) << 32) | permuted32.next();
+        hhc::hhc64_codec::encode_padded(id, cursors.data() + i * hhc::hhc64_codec::ENCODED_LENGTH);
+    }
+    return cursors;
+}
+
+/**
+ * @brief Baseline: advance each cursor by decoding, adding and re-encoding.
+ */
+void BM_hhc64BitCursorAdvanceRoundTrip(benchmark::State& state) {
+    const vector<char> cursors = random_cursors();
+    vector<char> output(cursors.size());
+    for (auto _ : state) {
+        for (std::size_t offset = 0; offset < cursors.size(); offset += hhc::hhc64_codec::ENCODED_LENGTH) {
+            uint64_t value = 0;
+            hhc::hhc64_codec::decode_batch(cursors.data() + offset, 1, &value);
+            hhc::hhc64_codec::encode_padded(value + PAGE_SIZE, output.data() + offset);
+        }
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * CURSOR_COUNT);
+}
+BENCHMARK(BM_hhc64BitCursorAdvanceRoundTrip);
+
+/**
+ * @brief Benchmark advancing each cursor with digit-wise addition on the encoded string.
+ */
+void BM_hhc64BitCursorAdvanceEncoded(benchmark::State& state) {
+    const vector<char> cursors = random_cursors();
+    vector<char> output(cursors.size());
+    for (auto _ : state) {
+        for (std::size_t offset = 0; offset < cursors.size(); offset += hhc::hhc64_codec::ENCODED_LENGTH) {
+            hhc::add_encoded_value(cursors.data() + offset, PAGE_SIZE, output.data() + offset);
+        }
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * CURSOR_COUNT);
+}
+BENCHMARK(BM_hhc64BitCursorAdvanceEncoded);
+
+/**
+ * @brief Benchmark comparing mixed padded and unpadded encodings.
+ */
+void BM_hhc64BitCompareEncoded(benchmark::State& state) {
+    const vector<char> cursors = random_cursors();
+    vector<std::string> unpadded(CURSOR_COUNT);
+    for (std::size_t i = 0; i < CURSOR_COUNT; ++i) {
+        char text[hhc::hhc64_codec::STRING_LENGTH] = {};
+        hhc::hhc64_codec::encode_unpadded(static_cast<uint64_t>(i) * 0x9E3779B97F4A7C15ULL >> 2, text);
+        unpadded[i] = text;
+    }
+    for (auto _ : state) {
+        int total = 0;
+        for (std::size_t i = 0; i < CURSOR_COUNT; ++i) {
+            const std::string_view padded(cursors.data() + i * hhc::hhc64_codec::ENCODED_LENGTH,
+                                          hhc::hhc64_codec::ENCODED_LENGTH);
+            total += hhc::compare_encoded(padded, unpadded[i]) < 0;
+        }
+        DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * CURSOR_COUNT);
+}
+BENCHMARK(BM_hhc64BitCompareEncoded);
+
+} // namespace
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "hhc_bigint.hpp"
+
+#include <string>
+#include <vector>
+
+/**
+ * @file bigint_bench.cpp
+ * @brief Benchmarks for the arbitrary-precision integer codec.
+ */
+
+namespace {
+
+using hhc::bench::Permuted32;
+using hhc::big_uint;
+
+using std::string;
+using std::vector;
+using benchmark::DoNotOptimize;
+
+/**
+ * @brief Build a random value with exactly the requested number of bits.
+ */
+big_uint random_big_uint(std::size_t bits) {
+    Permuted32 permuted32(rand());
+    vector<big_uint::limb_type> limbs((bits + 31) / 32);
+    for (auto& limb : limbs) {
+        limb = permuted32.next();
+    }
+    if (bits % 32 != 0) {
+        limbs.back() &= (1U << (bits % 32)) - 1;
+    }
+    limbs.back() |= 1U << ((bits - 1) % 32);
+    return big_uint::from_limbs(limbs);
+}
+
+/**
+ * @brief Benchmark big-integer encoding; the argument is the value width in bits.
+ */
+void BM_hhcBigintEncode(benchmark::State& state) {
+    const big_uint value = random_big_uint(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        string encoded = hhc::hhc_bigint_encode(value);
+        DoNotOptimize(encoded);
+    }
+}
+BENCHMARK(BM_hhcBigintEncode)->Arg(256)->Arg(1024)->Arg(4096)->Arg(65536);
+
+/**
+ * @brief Benchmark big-integer decoding; the argument is the value width in bits.
+ */
+void BM_hhcBigintDecode(benchmark::State& state) {
+    const string encoded = hhc::hhc_bigint_encode(random_big_uint(static_cast<std::size_t>(state.range(0))));
+    for (auto _ : state) {
+        big_uint value = hhc::hhc_bigint_decode(encoded.c_str());
+        DoNotOptimize(value);
+    }
+}
+BENCHMARK(BM_hhcBigintDecode)->Arg(256)->Arg(1024)->Arg(4096)->Arg(65536);
+
+}  // namespace
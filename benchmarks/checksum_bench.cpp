@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "hhc_checksum.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @file checksum_bench.cpp
+ * @brief Benchmarks for check symbol encoding, decoding and verification; reports items per second.
+ *
+ * Compare against BM_hhc64BitPlainEncodeBatch and BM_hhc64BitPlainDecodeBatch for the cost of the check symbol.
+ */
+
+namespace {
+
+using hhc::checksum_codec64;
+
+using std::vector;
+using benchmark::DoNotOptimize;
+
+constexpr std::size_t BATCH_SIZE = 1024;
+constexpr std::size_t LENGTH = checksum_codec64::ENCODED_LENGTH;
+
+vector<uint64_t> random_ids() {
+    hhc::bench::Permuted32 permuted32(rand());
+    vector<uint64_t> ids(BATCH_SIZE);
+    for (auto& value : ids) {
+        value = hhc::bench::next_u64(permuted32);
+    }
+    return ids;
+}
+
+/**
+ * @brief Benchmark padded batch encoding with the check symbol computed alongside the digits.
+ */
+void BM_hhc64BitChecksumEncodeBatch(benchmark::State& state) {
+    const vector<uint64_t> ids = random_ids();
+    vector<char> records(BATCH_SIZE * LENGTH);
+    for (auto _ : state) {
+        checksum_codec64::encode_padded_batch(ids.data(), ids.size(), records.data());
+        DoNotOptimize(records.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * BATCH_SIZE);
+}
+BENCHMARK(BM_hhc64BitChecksumEncodeBatch);
+
+/**
+ * @brief Benchmark validating, verifying and decoding records in one pass.
+ */
+void BM_hhc64BitChecksumDecodeBatch(benchmark::State& state) {
+    const vector<uint64_t> ids = random_ids();
+    vector<char> records(BATCH_SIZE * LENGTH);
+    checksum_codec64::encode_padded_batch(ids.data(), ids.size(), records.data());
+    vector<uint64_t> decoded(BATCH_SIZE);
+    for (auto _ : state) {
+        checksum_codec64::decode_batch(records.data(), BATCH_SIZE, decoded.data());
+        DoNotOptimize(decoded.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * BATCH_SIZE);
+}
+BENCHMARK(BM_hhc64BitChecksumDecodeBatch);
+
+/**
+ * @brief Benchmark verifying records without decoding them.
+ */
+void BM_hhc64BitChecksumVerifyBatch(benchmark::State& state) {
+    const vector<uint64_t> ids = random_ids();
+    vector<char> records(BATCH_SIZE * LENGTH);
+    checksum_codec64::encode_padded_batch(ids.data(), ids.size(), records.data());
+    const auto valid = std::make_unique<bool[]>(BATCH_SIZE);
+    for (auto _ : state) {
+        DoNotOptimize(checksum_codec64::verify_batch(records.data(), BATCH_SIZE, valid.get()));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * BATCH_SIZE);
+}
+BENCHMARK(BM_hhc64BitChecksumVerifyBatch);
+
+} // namespace
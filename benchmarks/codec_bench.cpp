@@ -0,0 +1,184 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "hhc_codec.hpp"
+#include "hhc_runtime_codec.hpp"
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+/**
+ * @file codec_bench.cpp
+ * @brief Benchmarks for the generic compile-time codec and its batch kernels.
+ */
+
+namespace {
+
+using hhc::bench::Permuted32;
+using hhc::bench::next_u64;
+using hhc::basic_codec;
+using hhc::base62_alphabet;
+using hhc::hhc64_codec;
+using hhc::codec;
+
+using std::array;
+using std::vector;
+using benchmark::DoNotOptimize;
+
+using base62_64 = basic_codec<base62_alphabet, uint64_t>;
+
+/**
+ * @brief Benchmark the padded base62 encoder built from the generic codec.
+ */
+void BM_base62EncodePadded(benchmark::State& state) {
+    Permuted32 permuted32(rand());
+    array<uint64_t, 2U << 16> inputs{};
+    for (auto& input : inputs) {
+        input = next_u64(permuted32);
+    }
+
+    array<char, base62_64::STRING_LENGTH> output{};
+    std::size_t idx = 0;
+    const std::size_t mask = inputs.size() - 1;
+
+    for (auto _ : state) {
+        base62_64::encode_padded(inputs[++idx & mask], output.data());
+        DoNotOptimize(output);
+    }
+}
+BENCHMARK(BM_base62EncodePadded);
+
+/**
+ * @brief Benchmark the checked base62 decoder built from the generic codec.
+ */
+void BM_base62DecodeSafe(benchmark::State& state) {
+    Permuted32 permuted32(rand());
+    vector<array<char, base62_64::STRING_LENGTH>> inputs(hhc::bench::PERMUTATION_BLOCKSIZE);
+    for (auto& input : inputs) {
+        base62_64::encode_padded(next_u64(permuted32), input.data());
+    }
+
+    std::size_t idx = 0;
+    const std::size_t mask = inputs.size() - 1;
+
+    for (auto _ : state) {
+        auto value = base62_64::decode(inputs[++idx & mask].data());
+        DoNotOptimize(value);
+    }
+}
+BENCHMARK(BM_base62DecodeSafe);
+
+/**
+ * @brief Benchmark the 64-bit batch encoder; reports throughput in items per second.
+ */
+void BM_hhc64BitEncodePaddedBatch(benchmark::State& state) {
+    Permuted32 permuted32(rand());
+    vector<uint64_t> inputs(static_cast<std::size_t>(state.range(0)));
+    for (auto& input : inputs) {
+        input = next_u64(permuted32);
+    }
+    vector<char> output(inputs.size() * hhc64_codec::ENCODED_LENGTH);
+
+    for (auto _ : state) {
+        hhc64_codec::encode_padded_batch(inputs.data(), inputs.size(), output.data());
+        DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_hhc64BitEncodePaddedBatch)->Arg(1024);
+
+/**
+ * @brief Benchmark the validating 64-bit batch decoder; reports throughput in items per second.
+ */
+void BM_hhc64BitDecodeBatch(benchmark::State& state) {
+    Permuted32 permuted32(rand());
+    vector<uint64_t> inputs(static_cast<std::size_t>(state.range(0)));
+    for (auto& input : inputs) {
+        input = next_u64(permuted32);
+    }
+    vector<char> encoded(inputs.size() * hhc64_codec::ENCODED_LENGTH);
+    hhc64_codec::encode_padded_batch(inputs.data(), inputs.size(), encoded.data());
+
+    for (auto _ : state) {
+        hhc64_codec::decode_batch(encoded.data(), inputs.size(), inputs.data());
+        DoNotOptimize(inputs.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_hhc64BitDecodeBatch)->Arg(1024);
+
+/**
+ * @brief Build a runtime codec over a reversed copy of the built-in alphabet.
+ */
+codec make_shuffled_codec() {
+    std::string alphabet(hhc::ALPHABET.begin(), hhc::ALPHABET.end());
+    std::reverse(alphabet.begin(), alphabet.end());
+    return codec(alphabet);
+}
+
+/**
+ * @brief Benchmark the padded 64-bit encoder of a runtime-configured alphabet.
+ */
+void BM_runtimeCodec64BitEncodePadded(benchmark::State& state) {
+    const codec runtime = make_shuffled_codec();
+    Permuted32 permuted32(rand());
+    array<uint64_t, 2U << 16> inputs{};
+    for (auto& input : inputs) {
+        input = next_u64(permuted32);
+    }
+
+    array<char, hhc::HHC_64BIT_STRING_LENGTH> output{};
+    std::size_t idx = 0;
+    const std::size_t mask = inputs.size() - 1;
+
+    for (auto _ : state) {
+        runtime.encode_64bit_padded(inputs[++idx & mask], output.data());
+        DoNotOptimize(output);
+    }
+}
+BENCHMARK(BM_runtimeCodec64BitEncodePadded);
+
+/**
+ * @brief Benchmark the checked 64-bit decoder of a runtime-configured alphabet.
+ */
+void BM_runtimeCodec64BitDecodeSafe(benchmark::State& state) {
+    const codec runtime = make_shuffled_codec();
+    Permuted32 permuted32(rand());
+    vector<array<char, hhc::HHC_64BIT_STRING_LENGTH>> inputs(hhc::bench::PERMUTATION_BLOCKSIZE);
+    for (auto& input : inputs) {
+        runtime.encode_64bit_padded(next_u64(permuted32), input.data());
+    }
+
+    std::size_t idx = 0;
+    const std::size_t mask = inputs.size() - 1;
+
+    for (auto _ : state) {
+        auto value = runtime.decode_64bit(inputs[++idx & mask].data());
+        DoNotOptimize(value);
+    }
+}
+BENCHMARK(BM_runtimeCodec64BitDecodeSafe);
+
+/**
+ * @brief Benchmark the runtime-alphabet 64-bit batch encoder; compare with BM_hhc64BitEncodePaddedBatch.
+ */
+void BM_runtimeCodec64BitEncodePaddedBatch(benchmark::State& state) {
+    const codec runtime = make_shuffled_codec();
+    Permuted32 permuted32(rand());
+    vector<uint64_t> inputs(static_cast<std::size_t>(state.range(0)));
+    for (auto& input : inputs) {
+        input = next_u64(permuted32);
+    }
+    vector<char> output(inputs.size() * hhc::HHC_64BIT_ENCODED_LENGTH);
+
+    for (auto _ : state) {
+        runtime.encode_64bit_padded_batch(inputs.data(), inputs.size(), output.data());
+        DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_runtimeCodec64BitEncodePaddedBatch)->Arg(1024);
+
+}  // namespace
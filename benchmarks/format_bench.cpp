@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "hhc.hpp"
+#include "hhc_format.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+
+/**
+ * @file format_bench.cpp
+ * @brief Benchmarks for appending HHC-formatted IDs to a log line.
+ */
+
+namespace {
+
+using hhc::bench::Permuted32;
+
+using std::string;
+using benchmark::DoNotOptimize;
+
+uint64_t next_id(Permuted32& permuted32) {
+    return (static_cast<uint64_t>(permuted32.next()) << 32) | permuted32.next();
+}
+
+/**
+ * @brief Baseline: encode into a stack buffer, then append through a temporary std::string.
+ */
+void HM_hhc64BitAppendViaString(benchmark::State& state) {
+    Permuted32 permuted32(rand());
+    string line;
+    line.reserve(64);
+
+    for (auto _ : state) {
+        line.clear();
+        char buffer[hhc::HHC_64BIT_STRING_LENGTH] = {};
+        hhc::hhc_64bit_encode_unpadded(next_id(permuted32), buffer);
+        line += string(buffer);
+        DoNotOptimize(line.data());
+    }
+}
+BENCHMARK(HM_hhc64BitAppendViaString);
+
+/**
+ * @brief Benchmark format_to writing the unpadded ID straight into the line.
+ */
+void BM_hhc64BitFormatTo(benchmark::State& state) {
+    Permuted32 permuted32(rand());
+    string line;
+    line.reserve(64);
+
+    for (auto _ : state) {
+        line.clear();
+        hhc::format_to(std::back_inserter(line), hhc::as_hhc(next_id(permuted32)), false);
+        DoNotOptimize(line.data());
+    }
+}
+BENCHMARK(BM_hhc64BitFormatTo);
+
+}  // namespace
@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "hhc_front_coded.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/**
+ * @file front_coded_bench.cpp
+ * @brief Benchmarks for lookups and streaming over front-coded encoded IDs; reports items per second.
+ */
+
+namespace {
+
+using hhc::bench::Permuted32;
+
+using std::vector;
+using benchmark::DoNotOptimize;
+
+constexpr std::size_t LIST_SIZE = 1 << 20;
+constexpr std::size_t QUERY_COUNT = 1024;
+constexpr std::size_t LENGTH = hhc::hhc64_codec::ENCODED_LENGTH;
+
+vector<uint64_t> sorted_ids() {
+    Permuted32 permuted32(rand());
+    vector<uint64_t> ids(LIST_SIZE);
+    for (auto& id : ids) {
+        id = (static_cast<uint64_t>(permuted32.next() & 0xFFU) << 32) | permuted32.next();
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+vector<uint64_t> queries(const vector<uint64_t>& ids) {
+    Permuted32 permuted32(rand());
+    vector<uint64_t> picked(QUERY_COUNT);
+    for (auto& id : picked) {
+        id = ids[permuted32.next() % ids.size()];
+    }
+    return picked;
+}
+
+/**
+ * @brief Baseline: binary search over flat 11-byte records with memcmp.
+ */
+void BM_hhc64BitFlatRecordsLookup(benchmark::State& state) {
+    const vector<uint64_t> ids = sorted_ids();
+    vector<char> records(ids.size() * LENGTH);
+    hhc::hhc64_codec::encode_padded_batch(ids.data(), ids.size(), records.data());
+    vector<char> targets(QUERY_COUNT * LENGTH);
+    const vector<uint64_t> picked = queries(ids);
+    hhc::hhc64_codec::encode_padded_batch(picked.data(), QUERY_COUNT, targets.data());
+
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (std::size_t q = 0; q < QUERY_COUNT; ++q) {
+            const char* target = targets.data() + q * LENGTH;
+            std::size_t low = 0;
+            std::size_t high = ids.size();
+            while (low < high) {
+                const std::size_t mid = (low + high) / 2;
+                if (std::memcmp(records.data() + mid * LENGTH, target, LENGTH) < 0) {
+                    low = mid + 1;
+                } else {
+                    high = mid;
+                }
+            }
+            found += low;
+        }
+        DoNotOptimize(found);
+    }
+    state.counters["bytes_per_id"] = static_cast<double>(records.size()) / static_cast<double>(ids.size());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * QUERY_COUNT);
+}
+BENCHMARK(BM_hhc64BitFlatRecordsLookup);
+
+/**
+ * @brief Benchmark lower_bound on the front-coded list.
+ */
+void BM_hhc64BitFrontCodedLookup(benchmark::State& state) {
+    const vector<uint64_t> ids = sorted_ids();
+    hhc::front_coded_list list;
+    for (uint64_t id : ids) {
+        list.push_back_value(id);
+    }
+    list.shrink_to_fit();
+    const vector<uint64_t> picked = queries(ids);
+
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (uint64_t id : picked) {
+            found += list.lower_bound(id);
+        }
+        DoNotOptimize(found);
+    }
+    state.counters["bytes_per_id"] = static_cast<double>(list.memory_usage()) / static_cast<double>(ids.size());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * QUERY_COUNT);
+}
+BENCHMARK(BM_hhc64BitFrontCodedLookup);
+
+/**
+ * @brief Benchmark streaming every record out of the front-coded list.
+ */
+void BM_hhc64BitFrontCodedStream(benchmark::State& state) {
+    const vector<uint64_t> ids = sorted_ids();
+    hhc::front_coded_list list;
+    for (uint64_t id : ids) {
+        list.push_back_value(id);
+    }
+    vector<char> output(ids.size() * LENGTH);
+    for (auto _ : state) {
+        list.copy_to(output.data());
+        DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(ids.size()));
+}
+BENCHMARK(BM_hhc64BitFrontCodedStream)->Unit(benchmark::kMillisecond);
+
+} // namespace
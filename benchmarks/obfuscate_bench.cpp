@@ -0,0 +1,126 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "hhc_obfuscate.hpp"
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file obfuscate_bench.cpp
+ * @brief Benchmarks for obfuscated encoding and decoding against the plain codec; reports items per second.
+ */
+
+namespace {
+
+using hhc::bench::Permuted32;
+
+using std::vector;
+using benchmark::DoNotOptimize;
+
+constexpr std::size_t BATCH_SIZE = 1024;
+constexpr std::size_t LENGTH = hhc::hhc64_codec::ENCODED_LENGTH;
+constexpr uint64_t KEY = 0x0123456789abcdefULL;
+
+vector<uint64_t> sequential_ids() {
+    vector<uint64_t> ids(BATCH_SIZE);
+    uint64_t id = static_cast<uint64_t>(rand());
+    for (auto& value : ids) {
+        value = id++;
+    }
+    return ids;
+}
+
+/**
+ * @brief Baseline: plain padded batch encoding.
+ */
+void BM_hhc64BitPlainEncodeBatch(benchmark::State& state) {
+    const vector<uint64_t> ids = sequential_ids();
+    vector<char> records(BATCH_SIZE * LENGTH);
+    for (auto _ : state) {
+        hhc::hhc64_codec::encode_padded_batch(ids.data(), ids.size(), records.data());
+        DoNotOptimize(records.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * BATCH_SIZE);
+}
+BENCHMARK(BM_hhc64BitPlainEncodeBatch);
+
+/**
+ * @brief Benchmark obfuscating and encoding in one pass.
+ */
+void BM_hhc64BitObfuscatedEncodeBatch(benchmark::State& state) {
+    const hhc::obfuscated_codec64 codec(KEY);
+    const vector<uint64_t> ids = sequential_ids();
+    vector<char> records(BATCH_SIZE * LENGTH);
+    for (auto _ : state) {
+        codec.encode_padded_batch(ids.data(), ids.size(), records.data());
+        DoNotOptimize(records.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * BATCH_SIZE);
+}
+BENCHMARK(BM_hhc64BitObfuscatedEncodeBatch);
+
+/**
+ * @brief Baseline: plain validated batch decoding.
+ */
+void BM_hhc64BitPlainDecodeBatch(benchmark::State& state) {
+    const hhc::obfuscated_codec64 codec(KEY);
+    const vector<uint64_t> ids = sequential_ids();
+    vector<char> records(BATCH_SIZE * LENGTH);
+    codec.encode_padded_batch(ids.data(), ids.size(), records.data());
+    vector<uint64_t> decoded(BATCH_SIZE);
+    for (auto _ : state) {
+        hhc::hhc64_codec::decode_batch(records.data(), BATCH_SIZE, decoded.data());
+        DoNotOptimize(decoded.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * BATCH_SIZE);
+}
+BENCHMARK(BM_hhc64BitPlainDecodeBatch);
+
+/**
+ * @brief Benchmark validated decoding followed by the inverse permutation.
+ */
+void BM_hhc64BitObfuscatedDecodeBatch(benchmark::State& state) {
+    const hhc::obfuscated_codec64 codec(KEY);
+    const vector<uint64_t> ids = sequential_ids();
+    vector<char> records(BATCH_SIZE * LENGTH);
+    codec.encode_padded_batch(ids.data(), ids.size(), records.data());
+    vector<uint64_t> decoded(BATCH_SIZE);
+    for (auto _ : state) {
+        codec.decode_batch(records.data(), BATCH_SIZE, decoded.data());
+        DoNotOptimize(decoded.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * BATCH_SIZE);
+}
+BENCHMARK(BM_hhc64BitObfuscatedDecodeBatch);
+
+/**
+ * @brief Benchmark a single obfuscated encode (latency of the fused path).
+ */
+void BM_hhc64BitObfuscatedEncodeSingle(benchmark::State& state) {
+    const hhc::obfuscated_codec64 codec(KEY);
+    Permuted32 permuted32(rand());
+    char record[LENGTH];
+    for (auto _ : state) {
+        codec.encode_padded(hhc::bench::next_u64(permuted32), record);
+        DoNotOptimize(record);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_hhc64BitObfuscatedEncodeSingle);
+
+/**
+ * @brief Baseline: a single plain encode.
+ */
+void BM_hhc64BitPlainEncodeSingle(benchmark::State& state) {
+    Permuted32 permuted32(rand());
+    char record[LENGTH];
+    for (auto _ : state) {
+        hhc::hhc64_codec::encode_padded(hhc::bench::next_u64(permuted32), record);
+        DoNotOptimize(record);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_hhc64BitPlainEncodeSingle);
+
+} // namespace
@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "hhc_ordered.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/**
+ * @file ordered_bench.cpp
+ * @brief Benchmarks for order-preserving signed and floating point encodings; reports items per second.
+ *
+ * Compare against BM_hhc64BitPlainEncodeBatch and BM_hhc64BitPlainDecodeBatch for the cost of the mapping.
+ */
+
+namespace {
+
+using hhc::ordered_double_codec;
+using hhc::ordered_int64_codec;
+
+using std::vector;
+using benchmark::DoNotOptimize;
+
+constexpr std::size_t BATCH_SIZE = 1024;
+constexpr std::size_t LENGTH = ordered_int64_codec::ENCODED_LENGTH;
+
+vector<int64_t> random_signed() {
+    hhc::bench::Permuted32 permuted32(rand());
+    vector<int64_t> values(BATCH_SIZE);
+    for (auto& value : values) {
+        value = static_cast<int64_t>(hhc::bench::next_u64(permuted32));
+    }
+    return values;
+}
+
+vector<double> random_doubles() {
+    std::mt19937_64 rng(static_cast<uint64_t>(rand()));
+    std::normal_distribution<double> normal(0.0, 1e6);
+    vector<double> values(BATCH_SIZE);
+    for (auto& value : values) {
+        value = normal(rng);
+    }
+    return values;
+}
+
+/**
+ * @brief Benchmark batch encoding of signed 64-bit integers.
+ */
+void BM_hhc64BitOrderedSignedEncodeBatch(benchmark::State& state) {
+    const vector<int64_t> values = random_signed();
+    vector<char> records(BATCH_SIZE * LENGTH);
+    for (auto _ : state) {
+        ordered_int64_codec::encode_padded_batch(values.data(), values.size(), records.data());
+        DoNotOptimize(records.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * BATCH_SIZE);
+}
+BENCHMARK(BM_hhc64BitOrderedSignedEncodeBatch);
+
+/**
+ * @brief Benchmark batch encoding of doubles.
+ */
+void BM_hhc64BitOrderedDoubleEncodeBatch(benchmark::State& state) {
+    const vector<double> values = random_doubles();
+    vector<char> records(BATCH_SIZE * LENGTH);
+    for (auto _ : state) {
+        ordered_double_codec::encode_padded_batch(values.data(), values.size(), records.data());
+        DoNotOptimize(records.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * BATCH_SIZE);
+}
+BENCHMARK(BM_hhc64BitOrderedDoubleEncodeBatch);
+
+/**
+ * @brief Benchmark validated batch decoding of doubles.
+ */
+void BM_hhc64BitOrderedDoubleDecodeBatch(benchmark::State& state) {
+    const vector<double> values = random_doubles();
+    vector<char> records(BATCH_SIZE * LENGTH);
+    ordered_double_codec::encode_padded_batch(values.data(), values.size(), records.data());
+    vector<double> decoded(BATCH_SIZE);
+    for (auto _ : state) {
+        ordered_double_codec::decode_batch(records.data(), BATCH_SIZE, decoded.data());
+        DoNotOptimize(decoded.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * BATCH_SIZE);
+}
+BENCHMARK(BM_hhc64BitOrderedDoubleDecodeBatch);
+
+} // namespace
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "hhc_random.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/**
+ * @file random_bench.cpp
+ * @brief Benchmarks for minting random tokens over the HHC alphabet; reports items (tokens) per second.
+ */
+
+namespace {
+
+using hhc::bench::Permuted32;
+
+using std::vector;
+using benchmark::DoNotOptimize;
+
+constexpr std::size_t TOKEN_COUNT = 4096;
+constexpr std::size_t TOKEN_LENGTH = 12;
+
+/**
+ * @brief Baseline: one rejection loop per character.
+ */
+void BM_hhcRandomTokensPerCharacter(benchmark::State& state) {
+    Permuted32 permuted32(rand());
+    vector<char> tokens(TOKEN_COUNT * TOKEN_LENGTH);
+    for (auto _ : state) {
+        for (auto& symbol : tokens) {
+            symbol = hhc::bench::random_alphabet_char(permuted32);
+        }
+        DoNotOptimize(tokens.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * TOKEN_COUNT);
+}
+BENCHMARK(BM_hhcRandomTokensPerCharacter);
+
+/**
+ * @brief Benchmark random_tokens with the keyed token_engine.
+ */
+void BM_hhcRandomTokensTokenEngine(benchmark::State& state) {
+    hhc::token_engine rng(static_cast<uint64_t>(rand()));
+    vector<char> tokens(TOKEN_COUNT * TOKEN_LENGTH);
+    for (auto _ : state) {
+        hhc::random_tokens(tokens.data(), TOKEN_COUNT, TOKEN_LENGTH, rng);
+        DoNotOptimize(tokens.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * TOKEN_COUNT);
+}
+BENCHMARK(BM_hhcRandomTokensTokenEngine);
+
+/**
+ * @brief Benchmark random_tokens with std::mt19937_64.
+ */
+void BM_hhcRandomTokensMersenneTwister(benchmark::State& state) {
+    std::mt19937_64 rng(static_cast<uint64_t>(rand()));
+    vector<char> tokens(TOKEN_COUNT * TOKEN_LENGTH);
+    for (auto _ : state) {
+        hhc::random_tokens(tokens.data(), TOKEN_COUNT, TOKEN_LENGTH, rng);
+        DoNotOptimize(tokens.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * TOKEN_COUNT);
+}
+BENCHMARK(BM_hhcRandomTokensMersenneTwister);
+
+} // namespace
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "hhc_sequence.hpp"
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file sequence_bench.cpp
+ * @brief Benchmarks for sequential ID encoding; reports items per second.
+ */
+
+namespace {
+
+using std::vector;
+using benchmark::DoNotOptimize;
+using benchmark::ClobberMemory;
+
+constexpr uint64_t SEQUENCE_START = 0x0123456789ULL;
+
+/**
+ * @brief Baseline: encode each sequential ID from scratch.
+ */
+void BM_hhc64BitEncodeSequential(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    vector<char> output(count * hhc::hhc64_codec::ENCODED_LENGTH);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < count; ++i) {
+            hhc::hhc64_codec::encode_padded(SEQUENCE_START + i, output.data() + i * hhc::hhc64_codec::ENCODED_LENGTH);
+        }
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_hhc64BitEncodeSequential)->Arg(4096);
+
+/**
+ * @brief Benchmark advancing the odometer sequence encoder.
+ */
+void BM_hhc64BitSequenceEncoder(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    vector<char> output(count * hhc::hhc64_codec::ENCODED_LENGTH);
+    for (auto _ : state) {
+        hhc::sequence_encoder ids(SEQUENCE_START);
+        for (std::size_t i = 0; i < count; ++i) {
+            ids.next(output.data() + i * hhc::hhc64_codec::ENCODED_LENGTH);
+        }
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_hhc64BitSequenceEncoder)->Arg(4096);
+
+/**
+ * @brief Benchmark materializing a block of sequential IDs with encode_range.
+ */
+void BM_hhc64BitEncodeRange(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    vector<char> output(count * hhc::hhc64_codec::ENCODED_LENGTH);
+    for (auto _ : state) {
+        hhc::encode_range(SEQUENCE_START, count, output.data());
+        DoNotOptimize(output.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_hhc64BitEncodeRange)->Arg(4096);
+
+} // namespace
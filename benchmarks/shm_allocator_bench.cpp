@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include "hhc_shm_allocator.hpp"
+
+#if HHC_HAVE_SHM_ALLOCATOR
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/**
+ * @file shm_allocator_bench.cpp
+ * @brief Benchmarks for taking encoded IDs from a shared-memory segment across processes; reports items per second.
+ */
+
+namespace {
+
+using benchmark::DoNotOptimize;
+
+constexpr uint64_t IDS_PER_PROCESS = 1 << 20;
+
+/**
+ * @brief Fork range(0) processes that each take IDS_PER_PROCESS encoded IDs in blocks of range(1).
+ *
+ * A block size of 1 is one contended fetch-add per ID; larger blocks show the local allocator.
+ */
+void BM_hhc64BitShmAllocatorProcesses(benchmark::State& state) {
+    const auto processes = static_cast<int>(state.range(0));
+    const std::string name = "/hhc_bench_" + std::to_string(::getpid());
+    hhc::shm_allocator_options options;
+    options.block_size = static_cast<uint64_t>(state.range(1));
+    hhc::shm_id_allocator::remove(name);
+    hhc::shm_id_allocator allocator(name, options);
+
+    for (auto _ : state) {
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<pid_t> children;
+        for (int p = 0; p < processes; ++p) {
+            const pid_t pid = ::fork();
+            if (pid == 0) {
+                hhc::shm_id_allocator child(name, options);
+                auto local = child.local();
+                char key[hhc::hhc64_codec::ENCODED_LENGTH];
+                for (uint64_t i = 0; i < IDS_PER_PROCESS; ++i) {
+                    DoNotOptimize(local.next(key));
+                    DoNotOptimize(key);
+                }
+                ::_exit(0);
+            }
+            children.push_back(pid);
+        }
+        for (const pid_t pid : children) {
+            ::waitpid(pid, nullptr, 0);
+        }
+        state.SetIterationTime(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    hhc::shm_id_allocator::remove(name);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * processes * static_cast<int64_t>(IDS_PER_PROCESS));
+}
+BENCHMARK(BM_hhc64BitShmAllocatorProcesses)
+    ->ArgsProduct({{1, 2, 4}, {1, 4096}})
+    ->ArgNames({"processes", "block"})
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace
+
+#endif // HHC_HAVE_SHM_ALLOCATOR
@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+
+#include "hhc_snowflake.hpp"
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @file snowflake_bench.cpp
+ * @brief Benchmarks for generating snowflake IDs with their padded encoding; reports items per second.
+ */
+
+namespace {
+
+using benchmark::DoNotOptimize;
+using benchmark::ClobberMemory;
+
+/// Ticks one millisecond every 4096 reads at no cost, isolating the generator from the system clock
+struct tick_clock {
+    using duration = std::chrono::milliseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<tick_clock>;
+    static constexpr bool is_steady = true;
+
+    static time_point now() noexcept {
+        thread_local int64_t reads = int64_t{hhc::SNOWFLAKE_DEFAULT_EPOCH} << 12;
+        return time_point(duration(reads++ >> 12));
+    }
+};
+
+/**
+ * @brief Baseline: one compare-and-swap per ID, then a full encode.
+ */
+void BM_hhc64BitSnowflakeSharedEncode(benchmark::State& state) {
+    static hhc::snowflake_generator generator(1);
+    char key[hhc::hhc64_codec::ENCODED_LENGTH];
+    for (auto _ : state) {
+        DoNotOptimize(generator.next(key));
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_hhc64BitSnowflakeSharedEncode)->Threads(1)->Threads(4);
+
+/**
+ * @brief Benchmark a per-thread generator taking blocks and incrementing the encoding in place.
+ */
+void BM_hhc64BitSnowflakeLocalEncode(benchmark::State& state) {
+    static hhc::snowflake_generator generator(2);
+    auto local = generator.local();
+    char key[hhc::hhc64_codec::ENCODED_LENGTH];
+    for (auto _ : state) {
+        DoNotOptimize(local.next(key));
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_hhc64BitSnowflakeLocalEncode)->Threads(1)->Threads(4);
+
+/**
+ * @brief Baseline without clock cost: one compare-and-swap per ID, then a full encode.
+ */
+void BM_hhc64BitSnowflakeSharedEncodeTickClock(benchmark::State& state) {
+    static hhc::basic_snowflake_generator<tick_clock> generator(3);
+    char key[hhc::hhc64_codec::ENCODED_LENGTH];
+    for (auto _ : state) {
+        DoNotOptimize(generator.next(key));
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_hhc64BitSnowflakeSharedEncodeTickClock)->Threads(1)->Threads(4);
+
+/**
+ * @brief Benchmark the per-thread generator without clock cost.
+ */
+void BM_hhc64BitSnowflakeLocalEncodeTickClock(benchmark::State& state) {
+    static hhc::basic_snowflake_generator<tick_clock> generator(4);
+    auto local = generator.local();
+    char key[hhc::hhc64_codec::ENCODED_LENGTH];
+    for (auto _ : state) {
+        DoNotOptimize(local.next(key));
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_hhc64BitSnowflakeLocalEncodeTickClock)->Threads(1)->Threads(4);
+
+} // namespace
@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "hhc_sort.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @file sort_bench.cpp
+ * @brief Benchmarks for sorting columns of encoded IDs; reports items per second.
+ */
+
+namespace {
+
+using hhc::bench::Permuted32;
+
+using std::string;
+using std::vector;
+using benchmark::DoNotOptimize;
+using benchmark::ClobberMemory;
+
+string random_records(std::size_t count) {
+    Permuted32 permuted32(rand());
+    vector<uint64_t> ids(count);
+    for (auto& id : ids) {
+        id = (static_cast<uint64_t>(permuted32.next()) << 32) | permuted32.next();
+    }
+    string records(count * hhc::hhc64_codec::ENCODED_LENGTH, '\0');
+    hhc::hhc64_codec::encode_padded_batch(ids.data(), count, records.data());
+    return records;
+}
+
+/**
+ * @brief Baseline: std::sort of std::string records with the string comparator.
+ */
+void BM_hhc64BitSortStdString(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const string records = random_records(count);
+    vector<string> strings(count);
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (std::size_t i = 0; i < count; ++i) {
+            strings[i].assign(records, i * hhc::hhc64_codec::ENCODED_LENGTH, hhc::hhc64_codec::ENCODED_LENGTH);
+        }
+        state.ResumeTiming();
+        std::sort(strings.begin(), strings.end());
+        DoNotOptimize(strings.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_hhc64BitSortStdString)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Benchmark the radix sort on one thread.
+ */
+void BM_hhc64BitSortEncoded(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const string records = random_records(count);
+    string working;
+    for (auto _ : state) {
+        state.PauseTiming();
+        working = records;
+        state.ResumeTiming();
+        hhc::sort_encoded(working.data(), count, 1);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_hhc64BitSortEncoded)->Arg(1 << 16)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Benchmark the radix sort with the default thread count.
+ */
+void BM_hhc64BitSortEncodedParallel(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const string records = random_records(count);
+    string working;
+    for (auto _ : state) {
+        state.PauseTiming();
+        working = records;
+        state.ResumeTiming();
+        hhc::sort_encoded(working.data(), count);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_hhc64BitSortEncodedParallel)->Arg(1 << 20)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+} // namespace
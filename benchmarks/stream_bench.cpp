@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "hhc_stream.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file stream_bench.cpp
+ * @brief Benchmarks for the streaming block codec; reports throughput in input bytes per second.
+ */
+
+namespace {
+
+using hhc::bench::Permuted32;
+
+using std::vector;
+using benchmark::DoNotOptimize;
+
+vector<uint8_t> random_payload(std::size_t size) {
+    Permuted32 permuted32(rand());
+    vector<uint8_t> payload(size);
+    for (auto& byte : payload) {
+        byte = static_cast<uint8_t>(permuted32.next());
+    }
+    return payload;
+}
+
+/**
+ * @brief Benchmark one-shot stream encoding; the argument is the payload size in bytes.
+ */
+void BM_hhcStreamEncode(benchmark::State& state) {
+    const vector<uint8_t> payload = random_payload(static_cast<std::size_t>(state.range(0)));
+    vector<char> output(hhc::hhc_stream_encoded_length(payload.size()));
+
+    for (auto _ : state) {
+        hhc::hhc_stream_encode(payload.data(), payload.size(), output.data());
+        DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_hhcStreamEncode)->Arg(64)->Arg(64 << 10);
+
+/**
+ * @brief Benchmark one-shot validating stream decoding; the argument is the payload size in bytes.
+ */
+void BM_hhcStreamDecode(benchmark::State& state) {
+    const vector<uint8_t> payload = random_payload(static_cast<std::size_t>(state.range(0)));
+    vector<char> encoded(hhc::hhc_stream_encoded_length(payload.size()));
+    hhc::hhc_stream_encode(payload.data(), payload.size(), encoded.data());
+    vector<uint8_t> output(payload.size());
+
+    for (auto _ : state) {
+        hhc::hhc_stream_decode(encoded.data(), encoded.size(), output.data());
+        DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_hhcStreamDecode)->Arg(64)->Arg(64 << 10);
+
+/**
+ * @brief Benchmark the incremental encoder fed in odd-sized 4093-byte chunks.
+ */
+void BM_hhcStreamEncoderChunked(benchmark::State& state) {
+    const vector<uint8_t> payload = random_payload(static_cast<std::size_t>(state.range(0)));
+    vector<char> output(hhc::hhc_stream_encoded_length(payload.size()) + hhc::HHC_STREAM_BLOCK_LENGTH);
+    constexpr std::size_t chunk = 4093;
+
+    for (auto _ : state) {
+        hhc::stream_encoder encoder;
+        std::size_t written = 0;
+        for (std::size_t offset = 0; offset < payload.size(); offset += chunk) {
+            const std::size_t size = std::min(chunk, payload.size() - offset);
+            written += encoder.update(payload.data() + offset, size, output.data() + written);
+        }
+        written += encoder.finish(output.data() + written);
+        DoNotOptimize(written);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_hhcStreamEncoderChunked)->Arg(64 << 10);
+
+}  // namespace
@@ -0,0 +1,144 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "hhc.hpp"
+#include "hhc_128bit.hpp"
+
+#include <array>
+#include <cstdio>
+#include <vector>
+
+/**
+ * @file uuid_bench.cpp
+ * @brief Benchmarks for the 128-bit codec and the direct UUID path.
+ */
+
+#if defined(__SIZEOF_INT128__)
+
+namespace {
+
+using hhc::bench::Permuted32;
+using hhc::bench::next_u64;
+using hhc::uint128_t;
+
+using std::array;
+using std::vector;
+using benchmark::DoNotOptimize;
+
+/**
+ * @brief Build a block of random canonical UUID strings.
+ */
+vector<array<char, hhc::HHC_UUID_TEXT_LENGTH + 1>> make_uuids() {
+    Permuted32 permuted32(rand());
+    vector<array<char, hhc::HHC_UUID_TEXT_LENGTH + 1>> uuids(hhc::bench::PERMUTATION_BLOCKSIZE);
+    for (auto& uuid : uuids) {
+        const uint128_t value = (static_cast<uint128_t>(next_u64(permuted32)) << 64) | next_u64(permuted32);
+        hhc::hhc_uuid_format(value, uuid.data());
+    }
+    return uuids;
+}
+
+/**
+ * @brief Benchmark the padded 128-bit encoder.
+ */
+void BM_hhc128BitEncodePadded(benchmark::State& state) {
+    Permuted32 permuted32(rand());
+    vector<uint128_t> inputs(hhc::bench::PERMUTATION_BLOCKSIZE);
+    for (auto& input : inputs) {
+        input = (static_cast<uint128_t>(next_u64(permuted32)) << 64) | next_u64(permuted32);
+    }
+
+    array<char, hhc::HHC_128BIT_STRING_LENGTH> output{};
+    std::size_t idx = 0;
+    const std::size_t mask = inputs.size() - 1;
+
+    for (auto _ : state) {
+        hhc::hhc_128bit_encode_padded(inputs[++idx & mask], output.data());
+        DoNotOptimize(output);
+    }
+}
+BENCHMARK(BM_hhc128BitEncodePadded);
+
+/**
+ * @brief Benchmark the checked 128-bit decoder.
+ */
+void BM_hhc128BitDecodeSafe(benchmark::State& state) {
+    Permuted32 permuted32(rand());
+    vector<array<char, hhc::HHC_128BIT_STRING_LENGTH>> inputs(hhc::bench::PERMUTATION_BLOCKSIZE);
+    for (auto& input : inputs) {
+        hhc::hhc_128bit_encode_padded((static_cast<uint128_t>(next_u64(permuted32)) << 64) | next_u64(permuted32),
+                                      input.data());
+    }
+
+    std::size_t idx = 0;
+    const std::size_t mask = inputs.size() - 1;
+
+    for (auto _ : state) {
+        auto value = hhc::hhc_128bit_decode(inputs[++idx & mask].data());
+        DoNotOptimize(value);
+    }
+}
+BENCHMARK(BM_hhc128BitDecodeSafe);
+
+/**
+ * @brief Benchmark UUID string to 22-character HHC, parsing the hex digits eight at a time.
+ */
+void BM_hhcUuidEncode(benchmark::State& state) {
+    const auto uuids = make_uuids();
+    array<char, hhc::HHC_128BIT_STRING_LENGTH> output{};
+    std::size_t idx = 0;
+    const std::size_t mask = uuids.size() - 1;
+
+    for (auto _ : state) {
+        hhc::hhc_uuid_encode(uuids[++idx & mask].data(), output.data());
+        DoNotOptimize(output);
+    }
+}
+BENCHMARK(BM_hhcUuidEncode);
+
+/**
+ * @brief Baseline: UUID string to two 11-character halves via sscanf and the 64-bit encoder.
+ */
+void HM_uuidEncodeSplit64Bit(benchmark::State& state) {
+    const auto uuids = make_uuids();
+    array<char, 2 * hhc::HHC_64BIT_ENCODED_LENGTH + 1> output{};
+    std::size_t idx = 0;
+    const std::size_t mask = uuids.size() - 1;
+
+    for (auto _ : state) {
+        unsigned int a = 0, b = 0, c = 0, d = 0;
+        unsigned long long e = 0;
+        std::sscanf(uuids[++idx & mask].data(), "%8x-%4x-%4x-%4x-%12llx", &a, &b, &c, &d, &e);
+        const uint64_t high = (static_cast<uint64_t>(a) << 32) | (static_cast<uint64_t>(b) << 16) | c;
+        const uint64_t low = (static_cast<uint64_t>(d) << 48) | e;
+        hhc::hhc_64bit_encode_padded(high, output.data());
+        hhc::hhc_64bit_encode_padded(low, output.data() + hhc::HHC_64BIT_ENCODED_LENGTH);
+        DoNotOptimize(output);
+    }
+}
+BENCHMARK(HM_uuidEncodeSplit64Bit);
+
+/**
+ * @brief Benchmark 22-character HHC back to a canonical UUID string.
+ */
+void BM_hhcUuidDecode(benchmark::State& state) {
+    const auto uuids = make_uuids();
+    vector<array<char, hhc::HHC_128BIT_STRING_LENGTH>> inputs(uuids.size());
+    for (std::size_t i = 0; i < uuids.size(); ++i) {
+        hhc::hhc_uuid_encode(uuids[i].data(), inputs[i].data());
+    }
+
+    array<char, hhc::HHC_UUID_TEXT_LENGTH + 1> output{};
+    std::size_t idx = 0;
+    const std::size_t mask = inputs.size() - 1;
+
+    for (auto _ : state) {
+        hhc::hhc_uuid_decode(inputs[++idx & mask].data(), output.data());
+        DoNotOptimize(output);
+    }
+}
+BENCHMARK(BM_hhcUuidDecode);
+
+}  // namespace
+
+#endif // __SIZEOF_INT128__
@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "hhc_varint.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @file varint_bench.cpp
+ * @brief Benchmarks for parsing ID lists as varints versus comma-joined padded encodings; reports items per second.
+ */
+
+namespace {
+
+using hhc::bench::Permuted32;
+
+using std::string;
+using std::vector;
+using benchmark::DoNotOptimize;
+
+constexpr std::size_t LIST_SIZE = 256;
+constexpr std::size_t LENGTH = hhc::hhc64_codec::ENCODED_LENGTH;
+
+/// A saved selection: sorted IDs drawn from a window of recent 40-bit IDs
+vector<uint64_t> selection() {
+    Permuted32 permuted32(rand());
+    vector<uint64_t> ids(LIST_SIZE);
+    for (auto& id : ids) {
+        id = (uint64_t{1} << 40) + permuted32.next() % (LIST_SIZE * 1000);
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+/**
+ * @brief Baseline: split a comma-joined list of padded encodings and decode each one.
+ */
+void BM_hhc64BitIdListCommaJoined(benchmark::State& state) {
+    const vector<uint64_t> ids = selection();
+    string text;
+    for (const uint64_t id : ids) {
+        char record[LENGTH];
+        hhc::hhc64_codec::encode_padded(id, record);
+        if (!text.empty()) {
+            text += ',';
+        }
+        text.append(record, LENGTH);
+    }
+    vector<uint64_t> output(ids.size());
+    for (auto _ : state) {
+        std::size_t count = 0;
+        for (std::size_t pos = 0; pos < text.size(); pos += LENGTH + 1) {
+            hhc::hhc64_codec::decode_batch(text.data() + pos, 1, output.data() + count++);
+        }
+        DoNotOptimize(output.data());
+    }
+    state.counters["chars_per_id"] = static_cast<double>(text.size()) / static_cast<double>(ids.size());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * LIST_SIZE);
+}
+BENCHMARK(BM_hhc64BitIdListCommaJoined);
+
+/**
+ * @brief Benchmark decoding the same list written as plain varints.
+ */
+void BM_hhc64BitIdListVarint(benchmark::State& state) {
+    const vector<uint64_t> ids = selection();
+    const string text = hhc::encode_varints(ids);
+    vector<uint64_t> output(text.size());
+    for (auto _ : state) {
+        DoNotOptimize(hhc::decode_varint_batch(text.data(), text.size(), output.data()));
+    }
+    state.counters["chars_per_id"] = static_cast<double>(text.size()) / static_cast<double>(ids.size());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * LIST_SIZE);
+}
+BENCHMARK(BM_hhc64BitIdListVarint);
+
+/**
+ * @brief Benchmark decoding the same list written as delta varints.
+ */
+void BM_hhc64BitIdListVarintDelta(benchmark::State& state) {
+    const vector<uint64_t> ids = selection();
+    const string text = hhc::encode_varints(ids, hhc::varint_mode::delta);
+    vector<uint64_t> output(text.size());
+    for (auto _ : state) {
+        DoNotOptimize(hhc::decode_varint_batch(text.data(), text.size(), output.data(), hhc::varint_mode::delta));
+    }
+    state.counters["chars_per_id"] = static_cast<double>(text.size()) / static_cast<double>(ids.size());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * LIST_SIZE);
+}
+BENCHMARK(BM_hhc64BitIdListVarintDelta);
+
+} // namespace
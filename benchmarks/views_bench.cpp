@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "hhc_views.hpp"
+
+#include <cstdint>
+#include <list>
+#include <vector>
+
+/**
+ * @file views_bench.cpp
+ * @brief Benchmarks for the lazy encode/decode range views; reports items per second.
+ */
+
+namespace {
+
+using hhc::bench::Permuted32;
+
+using std::vector;
+using benchmark::DoNotOptimize;
+
+vector<uint64_t> random_ids(std::size_t count) {
+    Permuted32 permuted32(rand());
+    vector<uint64_t> ids(count);
+    for (auto& id : ids) {
+        id = (static_cast<uint64_t>(permuted32.next()) << 32) | permuted32.next();
+    }
+    return ids;
+}
+
+/**
+ * @brief Benchmark encoding a contiguous vector through the blocked view.
+ */
+void BM_hhcViewEncode64Contiguous(benchmark::State& state) {
+    const vector<uint64_t> ids = random_ids(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (const auto& encoded : ids | hhc::views::encode64_padded) {
+            DoNotOptimize(encoded);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_hhcViewEncode64Contiguous)->Arg(1024);
+
+/**
+ * @brief Benchmark encoding a std::list through the per-element view.
+ */
+void BM_hhcViewEncode64List(benchmark::State& state) {
+    const vector<uint64_t> source = random_ids(static_cast<std::size_t>(state.range(0)));
+    const std::list<uint64_t> ids(source.begin(), source.end());
+    for (auto _ : state) {
+        for (const auto& encoded : ids | hhc::views::encode64_padded) {
+            DoNotOptimize(encoded);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_hhcViewEncode64List)->Arg(1024);
+
+/**
+ * @brief Benchmark validating decode of contiguous padded records through the blocked view.
+ */
+void BM_hhcViewDecode64Contiguous(benchmark::State& state) {
+    const vector<uint64_t> ids = random_ids(static_cast<std::size_t>(state.range(0)));
+    auto encoded_view = ids | hhc::views::encode64_padded;
+    const vector<std::array<char, hhc::hhc64_codec::ENCODED_LENGTH>> records(encoded_view.begin(), encoded_view.end());
+    for (auto _ : state) {
+        for (uint64_t value : records | hhc::views::decode64) {
+            DoNotOptimize(value);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_hhcViewDecode64Contiguous)->Arg(1024);
+
+}  // namespace
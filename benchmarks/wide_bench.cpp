@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_utils.hpp"
+#include "hhc.hpp"
+#include "hhc_wide.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @file wide_bench.cpp
+ * @brief Benchmarks for the UTF-16 encode/decode overloads against transcoding around the char API.
+ */
+
+namespace {
+
+using hhc::bench::Permuted32;
+using hhc::HHC_64BIT_STRING_LENGTH;
+
+using std::string;
+using std::u16string;
+using std::vector;
+using benchmark::DoNotOptimize;
+
+constexpr std::size_t pool_size = 1U << 12;
+constexpr std::size_t mask = pool_size - 1;
+
+vector<u16string> random_utf16_ids() {
+    Permuted32 permuted32(rand());
+    vector<u16string> ids(pool_size);
+    for (auto& id : ids) {
+        const uint64_t value = (static_cast<uint64_t>(permuted32.next()) << 32) | permuted32.next();
+        char16_t buffer[HHC_64BIT_STRING_LENGTH] = {};
+        hhc::hhc_64bit_encode_padded(value, buffer);
+        id = buffer;
+    }
+    return ids;
+}
+
+/**
+ * @brief Baseline: transcode UTF-16 to a std::string, then decode.
+ */
+void HM_hhc64BitDecodeUtf16ViaString(benchmark::State& state) {
+    const vector<u16string> ids = random_utf16_ids();
+    std::size_t idx = 0;
+    for (auto _ : state) {
+        const u16string& current = ids[idx++ & mask];
+        string narrow(current.begin(), current.end());
+        DoNotOptimize(hhc::hhc_64bit_decode(narrow.c_str()));
+    }
+}
+BENCHMARK(HM_hhc64BitDecodeUtf16ViaString);
+
+/**
+ * @brief Benchmark the validating UTF-16 decode overload (pointer and length).
+ */
+void BM_hhc64BitDecodeUtf16(benchmark::State& state) {
+    const vector<u16string> ids = random_utf16_ids();
+    std::size_t idx = 0;
+    for (auto _ : state) {
+        const u16string& current = ids[idx++ & mask];
+        DoNotOptimize(hhc::hhc_64bit_decode(current.data(), current.size()));
+    }
+}
+BENCHMARK(BM_hhc64BitDecodeUtf16);
+
+/**
+ * @brief Benchmark the padded UTF-16 encode overload.
+ */
+void BM_hhc64BitEncodeUtf16Padded(benchmark::State& state) {
+    Permuted32 permuted32(rand());
+    char16_t buffer[HHC_64BIT_STRING_LENGTH] = {};
+    for (auto _ : state) {
+        const uint64_t value = (static_cast<uint64_t>(permuted32.next()) << 32) | permuted32.next();
+        hhc::hhc_64bit_encode_padded(value, buffer);
+        DoNotOptimize(buffer);
+    }
+}
+BENCHMARK(BM_hhc64BitEncodeUtf16Padded);
+
+}  // namespace
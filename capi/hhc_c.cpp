@@ -0,0 +1,194 @@
+#include "hhc_c.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include "hhc_codec.hpp"
+
+#ifndef HHC_C_LIBRARY_VERSION
+#  define HHC_C_LIBRARY_VERSION "unknown"
+#endif
+
+static_assert(HHC_C_32BIT_ENCODED_LENGTH == hhc::hhc32_codec::ENCODED_LENGTH, "C header out of sync");
+static_assert(HHC_C_64BIT_ENCODED_LENGTH == hhc::hhc64_codec::ENCODED_LENGTH, "C header out of sync");
+
+namespace {
+
+    /**
+     * @brief Run a codec call, translating the C++ exceptions it may throw into status codes
+     */
+    template <typename Function>
+    hhc_status guarded(Function&& function) noexcept {
+        try {
+            function();
+            return HHC_OK;
+        } catch (const std::out_of_range&) {
+            return HHC_ERROR_OUT_OF_RANGE;
+        } catch (const std::invalid_argument&) {
+            return HHC_ERROR_INVALID_CHARACTER;
+        } catch (...) {
+            return HHC_ERROR_INTERNAL;
+        }
+    }
+
+    template <typename Codec>
+    hhc_status encode_unpadded(typename Codec::value_type value, char* output, size_t* output_length) noexcept {
+        if (output == nullptr || output_length == nullptr) {
+            return HHC_ERROR_NULL_POINTER;
+        }
+        char padded[Codec::ENCODED_LENGTH];
+        Codec::encode_padded(value, padded);
+
+        std::size_t first = 0;
+        while (first < Codec::ENCODED_LENGTH && padded[first] == Codec::ALPHABET[0]) {
+            ++first;
+        }
+        for (std::size_t pos = first; pos < Codec::ENCODED_LENGTH; ++pos) {
+            output[pos - first] = padded[pos];
+        }
+        *output_length = Codec::ENCODED_LENGTH - first;
+        return HHC_OK;
+    }
+
+    template <typename Codec>
+    hhc_status decode(const char* input, size_t length, typename Codec::value_type* value) noexcept {
+        if (input == nullptr || value == nullptr) {
+            return HHC_ERROR_NULL_POINTER;
+        }
+        // Checked up front so the generic invalid_argument mapping below only ever means a bad character
+        if (length == 0 || length > Codec::ENCODED_LENGTH) {
+            return HHC_ERROR_INVALID_LENGTH;
+        }
+        return guarded([&] { *value = Codec::decode(input, length); });
+    }
+
+    template <typename Codec>
+    hhc_status encode_batch(const typename Codec::value_type* values, size_t count, char* output) noexcept {
+        if (count == 0) {
+            return HHC_OK;
+        }
+        if (values == nullptr || output == nullptr) {
+            return HHC_ERROR_NULL_POINTER;
+        }
+        Codec::encode_padded_batch(values, count, output);
+        return HHC_OK;
+    }
+
+    template <typename Codec>
+    hhc_status decode_batch(const char* input, size_t count, typename Codec::value_type* values,
+                            size_t* error_index) noexcept {
+        if (count == 0) {
+            return HHC_OK;
+        }
+        if (input == nullptr || values == nullptr) {
+            return HHC_ERROR_NULL_POINTER;
+        }
+        const hhc_status status = guarded([&] { Codec::decode_batch(input, count, values); });
+        if (status == HHC_OK) {
+            return HHC_OK;
+        }
+        // The batch stops at the first bad record, so earlier values are already decoded; find which one it was
+        for (std::size_t index = 0; index < count; ++index) {
+            const hhc_status record_status = guarded(
+                [&] { Codec::decode_batch(input + index * Codec::ENCODED_LENGTH, 1, values + index); });
+            if (record_status != HHC_OK) {
+                if (error_index != nullptr) {
+                    *error_index = index;
+                }
+                return record_status;
+            }
+        }
+        return status;
+    }
+
+} // namespace
+
+extern "C" {
+
+hhc_status hhc_get_kernel_info(hhc_kernel_info* info) {
+    if (info == nullptr) {
+        return HHC_ERROR_NULL_POINTER;
+    }
+    hhc_kernel_info filled{};
+    filled.struct_size = sizeof(hhc_kernel_info);
+    filled.api_version = HHC_C_API_VERSION;
+    filled.library_version = HHC_C_LIBRARY_VERSION;
+    filled.encode_kernel = "scalar-pair-table";
+    filled.decode_kernel = "scalar-place-value";
+    filled.batch_block_size = 0;
+
+    const std::size_t size = info->struct_size < sizeof(hhc_kernel_info) ? info->struct_size : sizeof(hhc_kernel_info);
+    filled.struct_size = static_cast<uint32_t>(size);
+    std::memcpy(info, &filled, size);
+    return HHC_OK;
+}
+
+const char* hhc_status_string(hhc_status status) {
+    switch (status) {
+    case HHC_OK:
+        return "success";
+    case HHC_ERROR_NULL_POINTER:
+        return "null pointer argument";
+    case HHC_ERROR_INVALID_LENGTH:
+        return "invalid HHC string length";
+    case HHC_ERROR_INVALID_CHARACTER:
+        return "character outside the HHC alphabet";
+    case HHC_ERROR_OUT_OF_RANGE:
+        return "HHC string exceeds the bounds of the integer type";
+    case HHC_ERROR_INTERNAL:
+        return "internal error";
+    default:
+        return "unknown status";
+    }
+}
+
+hhc_status hhc_encode32_padded(uint32_t value, char* output) {
+    if (output == nullptr) {
+        return HHC_ERROR_NULL_POINTER;
+    }
+    hhc::hhc32_codec::encode_padded(value, output);
+    return HHC_OK;
+}
+
+hhc_status hhc_encode64_padded(uint64_t value, char* output) {
+    if (output == nullptr) {
+        return HHC_ERROR_NULL_POINTER;
+    }
+    hhc::hhc64_codec::encode_padded(value, output);
+    return HHC_OK;
+}
+
+hhc_status hhc_encode32_unpadded(uint32_t value, char* output, size_t* output_length) {
+    return encode_unpadded<hhc::hhc32_codec>(value, output, output_length);
+}
+
+hhc_status hhc_encode64_unpadded(uint64_t value, char* output, size_t* output_length) {
+    return encode_unpadded<hhc::hhc64_codec>(value, output, output_length);
+}
+
+hhc_status hhc_decode32(const char* input, size_t length, uint32_t* value) {
+    return decode<hhc::hhc32_codec>(input, length, value);
+}
+
+hhc_status hhc_decode64(const char* input, size_t length, uint64_t* value) {
+    return decode<hhc::hhc64_codec>(input, length, value);
+}
+
+hhc_status hhc_encode32_padded_batch(const uint32_t* values, size_t count, char* output) {
+    return encode_batch<hhc::hhc32_codec>(values, count, output);
+}
+
+hhc_status hhc_encode64_padded_batch(const uint64_t* values, size_t count, char* output) {
+    return encode_batch<hhc::hhc64_codec>(values, count, output);
+}
+
+hhc_status hhc_decode32_batch(const char* input, size_t count, uint32_t* values, size_t* error_index) {
+    return decode_batch<hhc::hhc32_codec>(input, count, values, error_index);
+}
+
+hhc_status hhc_decode64_batch(const char* input, size_t count, uint64_t* values, size_t* error_index) {
+    return decode_batch<hhc::hhc64_codec>(input, count, values, error_index);
+}
+
+} // extern "C"
@@ -0,0 +1,117 @@
+#ifndef HHC_C_H
+#define HHC_C_H
+
+/*
+ * Stable C ABI for the k-hhc codec (libk-hhc.so).
+ *
+ * Every function reports errors through an hhc_status return value and never lets a C++
+ * exception escape. Strings cross the boundary as (pointer, length) pairs and are never
+ * null-terminated, which matches how Go, Rust and most FFI layers hold them. Prefer the batch
+ * entry points: one FFI call per batch amortizes the call overhead over many 3-8 ns conversions.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#  if defined(HHC_C_BUILDING)
+#    define HHC_C_API __declspec(dllexport)
+#  else
+#    define HHC_C_API __declspec(dllimport)
+#  endif
+#elif defined(__GNUC__)
+#  define HHC_C_API __attribute__((visibility("default")))
+#else
+#  define HHC_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ABI version of this header; bumped only on incompatible changes */
+#define HHC_C_API_VERSION 1
+
+/** Characters in a padded 32-bit encoding */
+#define HHC_C_32BIT_ENCODED_LENGTH 6
+/** Characters in a padded 64-bit encoding */
+#define HHC_C_64BIT_ENCODED_LENGTH 11
+
+/** Result of every hhc_* call (fixed 32-bit width so it is ABI stable across compilers) */
+typedef int32_t hhc_status;
+
+#define HHC_OK 0                      /**< Success */
+#define HHC_ERROR_NULL_POINTER 1      /**< A required pointer argument was NULL */
+#define HHC_ERROR_INVALID_LENGTH 2    /**< Empty input, or longer than the encoded length */
+#define HHC_ERROR_INVALID_CHARACTER 3 /**< Input contains a character outside the alphabet */
+#define HHC_ERROR_OUT_OF_RANGE 4      /**< Input decodes to a value wider than the requested type */
+#define HHC_ERROR_INTERNAL 5          /**< Unexpected failure inside the library */
+
+/** Description of the compiled library, filled by hhc_get_kernel_info */
+typedef struct hhc_kernel_info {
+    uint32_t struct_size;        /**< Set by the caller to sizeof(hhc_kernel_info) before the call */
+    uint32_t api_version;        /**< HHC_C_API_VERSION of the library */
+    const char* library_version; /**< Library version, e.g. "1.0.9" */
+    const char* encode_kernel;   /**< Name of the encode kernel */
+    const char* decode_kernel;   /**< Name of the decode kernel */
+    uint32_t batch_block_size;   /**< Records a batch call converts per inner block (0 if unblocked) */
+} hhc_kernel_info;
+
+/**
+ * Describe the library and its kernels.
+ * Fields beyond info->struct_size are left untouched, so older callers keep working.
+ */
+HHC_C_API hhc_status hhc_get_kernel_info(hhc_kernel_info* info);
+
+/** Static English description of a status code (never NULL) */
+HHC_C_API const char* hhc_status_string(hhc_status status);
+
+/** Encode value into exactly HHC_C_32BIT_ENCODED_LENGTH characters */
+HHC_C_API hhc_status hhc_encode32_padded(uint32_t value, char* output);
+
+/** Encode value into exactly HHC_C_64BIT_ENCODED_LENGTH characters */
+HHC_C_API hhc_status hhc_encode64_padded(uint64_t value, char* output);
+
+/**
+ * Encode value without leading padding into output (at least HHC_C_32BIT_ENCODED_LENGTH bytes).
+ * *output_length receives the number of characters written; zero encodes to 0 characters.
+ */
+HHC_C_API hhc_status hhc_encode32_unpadded(uint32_t value, char* output, size_t* output_length);
+
+/**
+ * Encode value without leading padding into output (at least HHC_C_64BIT_ENCODED_LENGTH bytes).
+ * *output_length receives the number of characters written; zero encodes to 0 characters.
+ */
+HHC_C_API hhc_status hhc_encode64_unpadded(uint64_t value, char* output, size_t* output_length);
+
+/** Decode a padded or unpadded string of length characters with validation */
+HHC_C_API hhc_status hhc_decode32(const char* input, size_t length, uint32_t* value);
+
+/** Decode a padded or unpadded string of length characters with validation */
+HHC_C_API hhc_status hhc_decode64(const char* input, size_t length, uint64_t* value);
+
+/** Encode count values into back-to-back padded records (count * HHC_C_32BIT_ENCODED_LENGTH bytes) */
+HHC_C_API hhc_status hhc_encode32_padded_batch(const uint32_t* values, size_t count, char* output);
+
+/** Encode count values into back-to-back padded records (count * HHC_C_64BIT_ENCODED_LENGTH bytes) */
+HHC_C_API hhc_status hhc_encode64_padded_batch(const uint64_t* values, size_t count, char* output);
+
+/**
+ * Decode count back-to-back padded records with validation.
+ * On failure, values before the offending record are decoded and, if error_index is not NULL,
+ * *error_index receives the index of the offending record.
+ */
+HHC_C_API hhc_status hhc_decode32_batch(const char* input, size_t count, uint32_t* values, size_t* error_index);
+
+/**
+ * Decode count back-to-back padded records with validation.
+ * On failure, values before the offending record are decoded and, if error_index is not NULL,
+ * *error_index receives the index of the offending record.
+ */
+HHC_C_API hhc_status hhc_decode64_batch(const char* input, size_t count, uint64_t* values, size_t* error_index);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* HHC_C_H */
@@ -9,9 +9,10 @@
 #include <iostream>
 
 int safe_divide(int a, int b) {
-    // This assertion will:
-    // - In Debug: print detailed error + stack trace if b == 0, then abort
-    // - In Release: generate trap instruction if b == 0 (unreachable code hint)
+    // This assertion will, depending on HHC_CONTRACT_LEVEL:
+    // - debug: print detailed error + stack trace if b == 0, then abort
+    // - trap: generate trap instruction if b == 0
+    // - assume/off: let the optimizer assume b != 0
     HHC_ASSERT_MSG(b != 0, "Division by zero is not allowed");
     
     return a / b;
@@ -31,12 +32,18 @@ int main() {
     std::cout << "HHC Custom Assertion Module Demo\n";
     std::cout << "=================================\n\n";
     
-#ifndef NDEBUG
-    std::cout << "Build Mode: DEBUG\n";
+#if HHC_CONTRACT_LEVEL == HHC_CONTRACT_DEBUG
+    std::cout << "Contract Level: DEBUG\n";
     std::cout << "Assertions will print detailed error messages with stack traces.\n\n";
+#elif HHC_CONTRACT_LEVEL == HHC_CONTRACT_TRAP
+    std::cout << "Contract Level: TRAP\n";
+    std::cout << "Assertions will generate trap instructions.\n\n";
+#elif HHC_CONTRACT_LEVEL == HHC_CONTRACT_ASSUME
+    std::cout << "Contract Level: ASSUME\n";
+    std::cout << "Assertions are optimizer hints; a failing one is undefined behavior.\n\n";
 #else
-    std::cout << "Build Mode: RELEASE\n";
-    std::cout << "Assertions will generate trap instructions (optimizer hints).\n\n";
+    std::cout << "Contract Level: OFF\n";
+    std::cout << "Assertions are compiled out.\n\n";
 #endif
 
     // Example 1: Passing assertions (work in both debug and release)
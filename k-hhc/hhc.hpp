@@ -5,8 +5,16 @@
 #include <stdexcept>
 #include "hhc_constants.hpp"
 #include "hhc_assert.hpp"
+#include "hhc_codec.hpp"
 #include <cstring>
 #include <string>
+#include <type_traits>
+
+#if defined(__cpp_consteval)
+#  define HHC_CONSTEVAL consteval
+#else
+#  define HHC_CONSTEVAL constexpr
+#endif
 
 namespace hhc {
 
@@ -19,13 +27,7 @@ namespace hhc {
      */
     constexpr void hhc_32bit_encode_padded(uint32_t input, char* output_string) {
         HHC_ASSERT(output_string != nullptr);
-
-        for (uint32_t pos = HHC_32BIT_ENCODED_LENGTH; pos > 0; --pos) {
-            const uint32_t index = input % BASE;
-            input /= BASE;
-            output_string[pos - 1] = ALPHABET[index];
-
-        }
+        hhc32_codec::encode_padded(input, output_string);
     }
 
     /**
@@ -96,11 +98,7 @@ namespace hhc {
      */
     constexpr void hhc_64bit_encode_padded(uint64_t input, char* output_string) {
         HHC_ASSERT(output_string != nullptr);
-        for (uint32_t pos = HHC_64BIT_ENCODED_LENGTH; pos > 0; --pos) {
-            const uint32_t index = input % BASE;
-            input /= BASE;
-            output_string[pos - 1] = ALPHABET[index];
-        }
+        hhc64_codec::encode_padded(input, output_string);
     }
 
     /**
@@ -186,12 +184,12 @@ namespace hhc {
      */
     constexpr uint32_t hhc_32bit_decode(const char* input_string) {
         if (input_string == nullptr) {
-            throw std::invalid_argument("Invalid HHC string (nullptr)");
+            detail::throw_null_string();
         }
 
         const std::size_t length = hhc_validate_string(input_string);
         if (length == 0 || length > HHC_32BIT_ENCODED_LENGTH) {
-            throw std::invalid_argument("Invalid HHC string (length " + std::to_string(length) + ")");
+            detail::throw_invalid_length(length);
         }
 
         // If the string is not padded, pad it (no bounds check needed - shorter strings are always valid)
@@ -200,8 +198,14 @@ namespace hhc {
             const std::size_t padding = HHC_32BIT_ENCODED_LENGTH - length;
 
             HHC_ASSERT(padding <= HHC_32BIT_STRING_LENGTH);
-            std::memset(padded_string, ALPHABET[0], padding);
-            std::memcpy(padded_string + padding, input_string, length);
+            // Plain loops instead of memset/memcpy keep this path usable in constant expressions;
+            // compilers lower them to the same block moves.
+            for (std::size_t i = 0; i < padding; ++i) {
+                padded_string[i] = ALPHABET[0];
+            }
+            for (std::size_t i = 0; i < length; ++i) {
+                padded_string[padding + i] = input_string[i];
+            }
             padded_string[HHC_32BIT_ENCODED_LENGTH] = '\0';
             
             return hhc_32bit_decode_unsafe(padded_string);
@@ -209,7 +213,7 @@ namespace hhc {
 
         // Check bounds on the already-padded string
         if (!hhc_bounds_check(input_string, HHC_32BIT_ENCODED_MAX_STRING)) {
-            throw std::out_of_range("HHC string exceeds 32-bit bounds");
+            detail::throw_out_of_range("HHC string exceeds 32-bit bounds");
         }
 
         return hhc_32bit_decode_unsafe(input_string); // Already padded
@@ -224,12 +228,12 @@ namespace hhc {
      */
     constexpr uint64_t hhc_64bit_decode(const char* input_string) {
         if (input_string == nullptr) {
-            throw std::invalid_argument("Invalid HHC string (nullptr)");
+            detail::throw_null_string();
         }
 
         const std::size_t length = hhc_validate_string(input_string);
         if (length == 0 || length > HHC_64BIT_ENCODED_LENGTH) {
-            throw std::invalid_argument("Invalid HHC string (length " + std::to_string(length) + ")");
+            detail::throw_invalid_length(length);
         }
 
         // If the string is not padded, pad it (no bounds check needed - shorter strings are always valid)
@@ -238,8 +242,14 @@ namespace hhc {
             const std::size_t padding = HHC_64BIT_ENCODED_LENGTH - length;
 
             HHC_ASSERT(padding <= HHC_64BIT_STRING_LENGTH);
-            std::memset(padded_string, ALPHABET[0], padding);
-            std::memcpy(padded_string + padding, input_string, length);
+            // Plain loops instead of memset/memcpy keep this path usable in constant expressions;
+            // compilers lower them to the same block moves.
+            for (std::size_t i = 0; i < padding; ++i) {
+                padded_string[i] = ALPHABET[0];
+            }
+            for (std::size_t i = 0; i < length; ++i) {
+                padded_string[padding + i] = input_string[i];
+            }
             padded_string[HHC_64BIT_ENCODED_LENGTH] = '\0';
             
             return hhc_64bit_decode_unsafe(padded_string);
@@ -247,11 +257,83 @@ namespace hhc {
 
         // Check bounds on the already-padded string
         if (!hhc_bounds_check(input_string, HHC_64BIT_ENCODED_MAX_STRING)) {
-            throw std::out_of_range("HHC string exceeds 64-bit bounds");
+            detail::throw_out_of_range("HHC string exceeds 64-bit bounds");
         }
 
         return hhc_64bit_decode_unsafe(input_string); // Already padded
     }
+
+    namespace detail {
+
+        template <typename UInt>
+        constexpr std::size_t encoded_length_for() {
+            static_assert(std::is_integral_v<UInt> && std::is_unsigned_v<UInt> && !std::is_same_v<UInt, bool>,
+                          "HHC compile-time encoding requires an unsigned integer value");
+            static_assert(sizeof(UInt) <= sizeof(uint64_t), "HHC compile-time encoding supports at most 64-bit values");
+            return sizeof(UInt) <= sizeof(uint32_t) ? HHC_32BIT_ENCODED_LENGTH : HHC_64BIT_ENCODED_LENGTH;
+        }
+
+        template <auto Value>
+        constexpr auto make_encoded_constant() {
+            using value_type = decltype(Value);
+            std::array<char, encoded_length_for<value_type>() + 1> encoded{};
+            if constexpr (sizeof(value_type) <= sizeof(uint32_t)) {
+                hhc_32bit_encode_padded(static_cast<uint32_t>(Value), encoded.data());
+            } else {
+                hhc_64bit_encode_padded(static_cast<uint64_t>(Value), encoded.data());
+            }
+            encoded.back() = '\0';
+            return encoded;
+        }
+
+        template <auto Value>
+        inline constexpr auto encoded_constant = make_encoded_constant<Value>();
+
+    } // namespace detail
+
+    /**
+     * @brief Encode an unsigned integer at compile time
+     * @note Values up to 32 bits produce the 6-character form, 64-bit values the 11-character form
+     * @note The array holds the padded encoding followed by a null terminator
+     * @tparam Value The unsigned integer to encode
+     * @return The padded encoding as a constant std::array
+     */
+    template <auto Value>
+    constexpr auto encode_ct() {
+        return detail::encoded_constant<Value>;
+    }
+
+    namespace literals {
+
+        /**
+         * @brief Decode a 32-bit HHC literal, e.g. "1QLCp1"_hhc32
+         * @note Evaluated at compile time when the compiler supports consteval; an invalid literal is ill-formed
+         * @param input_string The literal characters
+         * @param length The literal length
+         * @return The decoded 32-bit integer
+         */
+        HHC_CONSTEVAL uint32_t operator""_hhc32(const char* input_string, std::size_t length) {
+            if (hhc_validate_string(input_string) != length) {
+                detail::throw_invalid_length(length);
+            }
+            return hhc_32bit_decode(input_string);
+        }
+
+        /**
+         * @brief Decode a 64-bit HHC literal, e.g. "9lH9ebONzYD"_hhc64
+         * @note Evaluated at compile time when the compiler supports consteval; an invalid literal is ill-formed
+         * @param input_string The literal characters
+         * @param length The literal length
+         * @return The decoded 64-bit integer
+         */
+        HHC_CONSTEVAL uint64_t operator""_hhc64(const char* input_string, std::size_t length) {
+            if (hhc_validate_string(input_string) != length) {
+                detail::throw_invalid_length(length);
+            }
+            return hhc_64bit_decode(input_string);
+        }
+
+    } // namespace literals
 } // namespace hhc
 
 #endif // hhc_HPP
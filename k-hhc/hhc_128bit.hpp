@@ -0,0 +1,284 @@
+#ifndef HHC_128BIT_HPP
+#define HHC_128BIT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include "hhc_constants.hpp"
+#include "hhc_assert.hpp"
+#include "hhc_codec.hpp"
+
+#if defined(__SIZEOF_INT128__)
+
+namespace hhc {
+
+    /// Unsigned 128-bit integer (GCC/Clang extension)
+    using uint128_t = unsigned __int128;
+
+    /// Characters in a canonical UUID string (8-4-4-4-12 hex digits), excluding the null terminator
+    constexpr size_t HHC_UUID_TEXT_LENGTH = 36;
+
+    namespace detail {
+
+        /// 66^10, the largest power of the base that fits in 64 bits
+        inline constexpr uint64_t BASE_POW_10 = 1568336880910795776ULL;
+
+        /// Digit values of HHC_128BIT_ENCODED_MAX_STRING
+        inline constexpr std::array<uint8_t, HHC_128BIT_ENCODED_LENGTH> MAX_DIGITS_128 = [] {
+            std::array<uint8_t, HHC_128BIT_ENCODED_LENGTH> digits{};
+            uint128_t value = ~uint128_t{0};
+            for (std::size_t pos = HHC_128BIT_ENCODED_LENGTH; pos > 0; --pos) {
+                digits[pos - 1] = static_cast<uint8_t>(value % BASE);
+                value /= BASE;
+            }
+            return digits;
+        }();
+
+        /// Byte masks used by the SWAR hex kernels
+        inline constexpr uint64_t BYTES_LOW = 0x0101010101010101ULL;
+        inline constexpr uint64_t BYTES_HIGH = 0x8080808080808080ULL;
+
+        /**
+         * @brief Parse eight hex characters, packed big-endian into one word, eight bytes at a time
+         *
+         * Each byte is range-checked against '0'..'9' and (case-folded) 'a'..'f' with borrow-free
+         * byte-wise subtraction, converted to its nibble, and the nibbles are then folded together
+         * in three shift-and-mask steps.
+         *
+         * @param word Eight ASCII characters loaded big-endian
+         * @param valid Cleared if any character is not a hex digit
+         * @return The 32-bit value of the eight hex digits
+         */
+        constexpr uint32_t parse_hex8(uint64_t word, bool& valid) {
+            // x + 0x80 - lo sets the high bit iff x >= lo (for x < 0x80), without borrowing across bytes
+            const auto at_least = [](uint64_t x, uint8_t lo) { return ((x | BYTES_HIGH) - lo * BYTES_LOW) & BYTES_HIGH; };
+            const auto at_most = [](uint64_t x, uint8_t hi) { return ((hi * BYTES_LOW | BYTES_HIGH) - x) & BYTES_HIGH; };
+
+            const uint64_t folded = word | (0x20 * BYTES_LOW);
+            const uint64_t digit = at_least(word, '0') & at_most(word, '9');
+            const uint64_t alpha = at_least(folded, 'a') & at_most(folded, 'f');
+            if ((word & BYTES_HIGH) != 0 || (digit | alpha) != BYTES_HIGH) {
+                valid = false;
+            }
+
+            uint64_t nibbles = (word & (0x0F * BYTES_LOW)) + 9 * (alpha >> 7);
+            nibbles = (nibbles | (nibbles >> 4)) & 0x00FF00FF00FF00FFULL;
+            nibbles = (nibbles | (nibbles >> 8)) & 0x0000FFFF0000FFFFULL;
+            nibbles = (nibbles | (nibbles >> 16)) & 0x00000000FFFFFFFFULL;
+            return static_cast<uint32_t>(nibbles);
+        }
+
+        /**
+         * @brief Write a 32-bit value as eight lower-case hex characters, eight bytes at a time
+         */
+        constexpr void format_hex8(uint32_t value, char* output) {
+            uint64_t nibbles = value;
+            nibbles = (nibbles | (nibbles << 16)) & 0x0000FFFF0000FFFFULL;
+            nibbles = (nibbles | (nibbles << 8)) & 0x00FF00FF00FF00FFULL;
+            nibbles = (nibbles | (nibbles << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+            // n + 0x76 sets the high bit iff n > 9; those bytes skip from '9' + 1 to 'a'
+            const uint64_t letters = ((nibbles + 0x76 * BYTES_LOW) & BYTES_HIGH) >> 7;
+            const uint64_t chars = nibbles + '0' * BYTES_LOW + ('a' - '0' - 10) * letters;
+            for (std::size_t i = 0; i < 8; ++i) {
+                output[i] = static_cast<char>(chars >> (56 - 8 * i));
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Encode a 128-bit integer into a 22-character string
+     *
+     * The value is split into 2 + 10 + 10 digits with two divisions by 66^10, so the digit
+     * loops run on 64-bit halves.
+     *
+     * @note The output string is not null-terminated
+     * @param input The 128-bit integer to encode
+     * @param output_string The output string (at least HHC_128BIT_STRING_LENGTH bytes)
+     */
+    constexpr void hhc_128bit_encode_padded(uint128_t input, char* output_string) {
+        HHC_ASSERT(output_string != nullptr);
+        using tables = detail::alphabet_tables<hhc_alphabet>;
+
+        const uint128_t high = input / detail::BASE_POW_10;
+        const auto low = static_cast<uint64_t>(input - high * detail::BASE_POW_10);
+        const auto top = static_cast<uint64_t>(high / detail::BASE_POW_10);
+        const auto middle = static_cast<uint64_t>(high - static_cast<uint128_t>(top) * detail::BASE_POW_10);
+
+        detail::encode_digits<2, BASE>(top, ALPHABET.data(), tables::PAIRS.data(), output_string);
+        detail::encode_digits<10, BASE>(middle, ALPHABET.data(), tables::PAIRS.data(), output_string + 2);
+        detail::encode_digits<10, BASE>(low, ALPHABET.data(), tables::PAIRS.data(), output_string + 12);
+    }
+
+    /**
+     * @brief Decode a 128-bit integer from a 22-character string without validation
+     * @param input_string The input string to decode
+     * @return The decoded 128-bit integer
+     */
+    constexpr uint128_t hhc_128bit_decode_unsafe(const char* input_string) {
+        HHC_ASSERT(input_string != nullptr);
+        const uint8_t* inverse = detail::alphabet_tables<hhc_alphabet>::INVERSE.data();
+
+        const auto top = detail::decode_digits<2, BASE, uint64_t>(input_string, inverse);
+        const auto middle = detail::decode_digits<10, BASE, uint64_t>(input_string + 2, inverse);
+        const auto low = detail::decode_digits<10, BASE, uint64_t>(input_string + 12, inverse);
+        return (static_cast<uint128_t>(top) * detail::BASE_POW_10 + middle) * detail::BASE_POW_10 + low;
+    }
+
+    /**
+     * @brief Decode a 128-bit integer from a padded or unpadded string
+     * @param input_string The input string to decode
+     * @return The decoded 128-bit integer
+     * @throws std::invalid_argument if the string is invalid
+     * @throws std::out_of_range if the string exceeds 128-bit bounds
+     */
+    constexpr uint128_t hhc_128bit_decode(const char* input_string) {
+        if (input_string == nullptr) {
+            detail::throw_null_string();
+        }
+        const uint8_t* inverse = detail::alphabet_tables<hhc_alphabet>::INVERSE.data();
+
+        const std::size_t length = detail::validate_symbols(input_string, inverse);
+        if (length == 0 || length > HHC_128BIT_ENCODED_LENGTH) {
+            detail::throw_invalid_length(length);
+        }
+        if (!detail::digits_within_bounds_n(input_string, length, inverse, detail::MAX_DIGITS_128)) {
+            detail::throw_out_of_range("HHC string exceeds 128-bit bounds");
+        }
+
+        // Right-align every input in a local buffer, so the fixed-offset loads never touch the caller's string
+        char padded_string[HHC_128BIT_STRING_LENGTH] = {};
+        const std::size_t padding = HHC_128BIT_ENCODED_LENGTH - length;
+        for (std::size_t pos = 0; pos < padding; ++pos) {
+            padded_string[pos] = ALPHABET[0];
+        }
+        for (std::size_t pos = 0; pos < length; ++pos) {
+            padded_string[padding + pos] = input_string[pos];
+        }
+        return hhc_128bit_decode_unsafe(padded_string);
+    }
+
+    /**
+     * @brief Parse a canonical UUID string (8-4-4-4-12 hex digits, either case) of known length into a 128-bit integer
+     * @param uuid_string The UUID characters (they need not be null-terminated)
+     * @param length The number of characters, which must be HHC_UUID_TEXT_LENGTH
+     * @return The UUID as a big-endian 128-bit integer
+     * @throws std::invalid_argument if the string is not a canonical UUID
+     */
+    constexpr uint128_t hhc_uuid_parse(const char* uuid_string, std::size_t length) {
+        if (uuid_string == nullptr) {
+            detail::throw_null_string();
+        }
+        if (length != HHC_UUID_TEXT_LENGTH) {
+            throw std::invalid_argument("Invalid UUID string (expected 36 characters)");
+        }
+        if (uuid_string[8] != '-' || uuid_string[13] != '-' || uuid_string[18] != '-' || uuid_string[23] != '-') {
+            throw std::invalid_argument("Invalid UUID string (expected 8-4-4-4-12 hex digits)");
+        }
+
+        // The 32 hex digits form four 8-character words; the middle two straddle dashes
+        const uint64_t words[4] = {
+            detail::load_be<8, uint64_t>(uuid_string),
+            (uint64_t{detail::load_be<4, uint32_t>(uuid_string + 9)} << 32) | detail::load_be<4, uint32_t>(uuid_string + 14),
+            (uint64_t{detail::load_be<4, uint32_t>(uuid_string + 19)} << 32) | detail::load_be<4, uint32_t>(uuid_string + 24),
+            detail::load_be<8, uint64_t>(uuid_string + 28),
+        };
+
+        bool valid = true;
+        const uint64_t high = (uint64_t{detail::parse_hex8(words[0], valid)} << 32) | detail::parse_hex8(words[1], valid);
+        const uint64_t low = (uint64_t{detail::parse_hex8(words[2], valid)} << 32) | detail::parse_hex8(words[3], valid);
+        if (!valid) {
+            throw std::invalid_argument("Invalid UUID string (expected 8-4-4-4-12 hex digits)");
+        }
+        return (static_cast<uint128_t>(high) << 64) | low;
+    }
+
+    /**
+     * @brief Parse a null-terminated canonical UUID string (8-4-4-4-12 hex digits, either case) into a 128-bit integer
+     * @return The UUID as a big-endian 128-bit integer
+     * @throws std::invalid_argument if the string is not a canonical UUID
+     */
+    constexpr uint128_t hhc_uuid_parse(const char* uuid_string) {
+        if (uuid_string == nullptr) {
+            detail::throw_null_string();
+        }
+        // Copy while scanning (stopping one past the expected length), so the fixed-offset parse
+        // only ever reads this buffer and never past the end of a short string
+        char text[HHC_UUID_TEXT_LENGTH] = {};
+        std::size_t length = 0;
+        for (; length <= HHC_UUID_TEXT_LENGTH && uuid_string[length] != '\0'; ++length) {
+            if (length < HHC_UUID_TEXT_LENGTH) {
+                text[length] = uuid_string[length];
+            }
+        }
+        return hhc_uuid_parse(text, length);
+    }
+
+    /**
+     * @brief Format a 128-bit integer as a canonical lower-case UUID string
+     * @note The output string is not null-terminated
+     * @param value The UUID as a big-endian 128-bit integer
+     * @param uuid_string The output string (at least HHC_UUID_TEXT_LENGTH bytes)
+     */
+    constexpr void hhc_uuid_format(uint128_t value, char* uuid_string) {
+        HHC_ASSERT(uuid_string != nullptr);
+        char digits[32] = {};
+        detail::format_hex8(static_cast<uint32_t>(value >> 96), digits);
+        detail::format_hex8(static_cast<uint32_t>(value >> 64), digits + 8);
+        detail::format_hex8(static_cast<uint32_t>(value >> 32), digits + 16);
+        detail::format_hex8(static_cast<uint32_t>(value), digits + 24);
+
+        for (std::size_t i = 0; i < 8; ++i) {
+            uuid_string[i] = digits[i];
+            uuid_string[28 + i] = digits[24 + i];
+        }
+        for (std::size_t i = 0; i < 4; ++i) {
+            uuid_string[9 + i] = digits[8 + i];
+            uuid_string[14 + i] = digits[12 + i];
+            uuid_string[19 + i] = digits[16 + i];
+            uuid_string[24 + i] = digits[20 + i];
+        }
+        uuid_string[8] = uuid_string[13] = uuid_string[18] = uuid_string[23] = '-';
+    }
+
+    /**
+     * @brief Encode a canonical UUID string directly into a 22-character HHC string
+     * @note The output string is not null-terminated
+     * @param uuid_string A null-terminated canonical UUID string
+     * @param output_string The output string (at least HHC_128BIT_STRING_LENGTH bytes)
+     * @throws std::invalid_argument if the string is not a canonical UUID
+     */
+    constexpr void hhc_uuid_encode(const char* uuid_string, char* output_string) {
+        hhc_128bit_encode_padded(hhc_uuid_parse(uuid_string), output_string);
+    }
+
+    /**
+     * @brief Encode a canonical UUID string of known length directly into a 22-character HHC string
+     * @note The output string is not null-terminated
+     * @param uuid_string The UUID characters (they need not be null-terminated)
+     * @param length The number of characters, which must be HHC_UUID_TEXT_LENGTH
+     * @param output_string The output string (at least HHC_128BIT_STRING_LENGTH bytes)
+     * @throws std::invalid_argument if the string is not a canonical UUID
+     */
+    constexpr void hhc_uuid_encode(const char* uuid_string, std::size_t length, char* output_string) {
+        hhc_128bit_encode_padded(hhc_uuid_parse(uuid_string, length), output_string);
+    }
+
+    /**
+     * @brief Decode a padded or unpadded HHC string into a canonical lower-case UUID string
+     * @note The output string is not null-terminated
+     * @param input_string The HHC string to decode
+     * @param uuid_string The output string (at least HHC_UUID_TEXT_LENGTH bytes)
+     * @throws std::invalid_argument if the string is invalid
+     * @throws std::out_of_range if the string exceeds 128-bit bounds
+     */
+    constexpr void hhc_uuid_decode(const char* input_string, char* uuid_string) {
+        hhc_uuid_format(hhc_128bit_decode(input_string), uuid_string);
+    }
+
+} // namespace hhc
+
+#endif // __SIZEOF_INT128__
+
+#endif // HHC_128BIT_HPP
@@ -0,0 +1,258 @@
+#ifndef HHC_ARITHMETIC_HPP
+#define HHC_ARITHMETIC_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include "hhc_assert.hpp"
+#include "hhc_codec.hpp"
+
+namespace hhc {
+
+    namespace detail {
+
+        /**
+         * @brief Compare two equal-length digit strings
+         * @return Negative, zero or positive as a is less than, equal to or greater than b
+         */
+        template <typename Codec>
+        constexpr int compare_digits(std::string_view a, std::string_view b) {
+            if constexpr (is_ascii_ordered(Codec::ALPHABET)) {
+                return a.compare(b);
+            } else {
+                const uint8_t* inverse = alphabet_tables<typename Codec::alphabet_type>::INVERSE.data();
+                for (std::size_t pos = 0; pos < a.size(); ++pos) {
+                    const int da = inverse[static_cast<unsigned char>(a[pos])];
+                    const int db = inverse[static_cast<unsigned char>(b[pos])];
+                    if (da != db) {
+                        return da - db;
+                    }
+                }
+                return 0;
+            }
+        }
+
+        /**
+         * @brief Whether every character of text is the zero symbol
+         */
+        template <typename Codec>
+        constexpr bool all_zero_symbols(std::string_view text) {
+            for (const char symbol : text) {
+                if (symbol != Codec::ALPHABET[0]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Add or subtract two padded records digit by digit, least significant digit first
+         * @return The final carry (add) or borrow (subtract)
+         * @throws std::invalid_argument if either record contains a character outside the alphabet
+         * @throws std::out_of_range when subtracting from a record that exceeds the bounds of the codec
+         */
+        template <typename Codec, bool Subtract>
+        constexpr bool add_digits(const char* a, const char* b, char* output) {
+            constexpr std::size_t LENGTH = Codec::ENCODED_LENGTH;
+            constexpr int BASE = static_cast<int>(Codec::BASE);
+            const uint8_t* inverse = alphabet_tables<typename Codec::alphabet_type>::INVERSE.data();
+
+            // Validate before writing anything, so output may alias a or b
+            uint8_t combined = 0;
+            for (std::size_t pos = 0; pos < LENGTH; ++pos) {
+                combined |= inverse[static_cast<unsigned char>(a[pos])] | inverse[static_cast<unsigned char>(b[pos])];
+            }
+            if ((combined & 0x80U) != 0) {
+                throw_invalid_character();
+            }
+            // The difference is no larger than a, so a bound on a bounds the result
+            if (Subtract && !digits_within_bounds(a, inverse, Codec::MAX_DIGITS)) {
+                throw_out_of_range("HHC string exceeds codec bounds");
+            }
+
+            int carry = 0;
+            for (std::size_t pos = LENGTH; pos > 0; --pos) {
+                const int da = inverse[static_cast<unsigned char>(a[pos - 1])];
+                const int db = inverse[static_cast<unsigned char>(b[pos - 1])];
+                int digit = Subtract ? da - db - carry : da + db + carry;
+                if constexpr (Subtract) {
+                    carry = digit < 0;
+                    digit += carry * BASE;
+                } else {
+                    carry = digit >= BASE;
+                    digit -= carry * BASE;
+                }
+                output[pos - 1] = Codec::ALPHABET[static_cast<std::size_t>(digit)];
+            }
+            return carry != 0;
+        }
+
+        /**
+         * @brief Add an integer to, or subtract it from, a padded record, stopping once the carry dies out
+         * @return Whether a carry (add) or borrow (subtract) is left past the top digit
+         * @throws std::invalid_argument if the record contains a character outside the alphabet
+         * @throws std::out_of_range when subtracting from a record that exceeds the bounds of the codec
+         */
+        template <typename Codec, bool Subtract>
+        constexpr bool add_value_digits(const char* a, typename Codec::value_type delta, char* output) {
+            using UInt = typename Codec::value_type;
+            constexpr std::size_t LENGTH = Codec::ENCODED_LENGTH;
+            constexpr int BASE = static_cast<int>(Codec::BASE);
+            const uint8_t* inverse = alphabet_tables<typename Codec::alphabet_type>::INVERSE.data();
+
+            uint8_t combined = 0;
+            for (std::size_t pos = 0; pos < LENGTH; ++pos) {
+                combined |= inverse[static_cast<unsigned char>(a[pos])];
+            }
+            if ((combined & 0x80U) != 0) {
+                throw_invalid_character();
+            }
+            if (Subtract && !digits_within_bounds(a, inverse, Codec::MAX_DIGITS)) {
+                throw_out_of_range("HHC string exceeds codec bounds");
+            }
+
+            // Page-size deltas touch one or two digits; the untouched prefix is copied as is
+            std::size_t pos = LENGTH;
+            for (; pos > 0 && delta != 0; --pos) {
+                const int low = static_cast<int>(delta % Codec::BASE);
+                delta = static_cast<UInt>(delta / Codec::BASE);
+                int digit = inverse[static_cast<unsigned char>(a[pos - 1])];
+                digit = Subtract ? digit - low : digit + low;
+                if (Subtract ? digit < 0 : digit >= BASE) {
+                    digit += Subtract ? BASE : -BASE;
+                    ++delta; // delta was divided by BASE, so this cannot wrap
+                }
+                output[pos - 1] = Codec::ALPHABET[static_cast<std::size_t>(digit)];
+            }
+            if (output != a) {
+                for (std::size_t i = 0; i < pos; ++i) {
+                    output[i] = a[i];
+                }
+            }
+            return delta != 0;
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Compare two encoded values without decoding them
+     *
+     * Either string may be padded or unpadded; a shorter string is compared as if left-padded
+     * with the zero symbol. For ASCII-ordered alphabets such as HHC the comparison is a single
+     * byte comparison of the aligned strings.
+     *
+     * @note The strings are not validated; use the validating decoders for untrusted input
+     * @tparam Codec A basic_codec instantiation (defaults to 64-bit HHC)
+     * @param a An encoded value (at most ENCODED_LENGTH characters)
+     * @param b An encoded value (at most ENCODED_LENGTH characters)
+     * @return Negative, zero or positive as a is less than, equal to or greater than b
+     */
+    template <typename Codec = hhc64_codec>
+    constexpr int compare_encoded(std::string_view a, std::string_view b) {
+        HHC_ASSERT(a.size() <= Codec::ENCODED_LENGTH && b.size() <= Codec::ENCODED_LENGTH);
+        if (a.size() > b.size()) {
+            const std::size_t extra = a.size() - b.size();
+            if (!detail::all_zero_symbols<Codec>(a.substr(0, extra))) {
+                return 1;
+            }
+            a.remove_prefix(extra);
+        } else if (b.size() > a.size()) {
+            const std::size_t extra = b.size() - a.size();
+            if (!detail::all_zero_symbols<Codec>(b.substr(0, extra))) {
+                return -1;
+            }
+            b.remove_prefix(extra);
+        }
+        return detail::compare_digits<Codec>(a, b);
+    }
+
+    /**
+     * @brief The smaller of two encoded values (a if they are equal)
+     * @see compare_encoded
+     */
+    template <typename Codec = hhc64_codec>
+    constexpr std::string_view min_encoded(std::string_view a, std::string_view b) {
+        return compare_encoded<Codec>(b, a) < 0 ? b : a;
+    }
+
+    /**
+     * @brief The larger of two encoded values (a if they are equal)
+     * @see compare_encoded
+     */
+    template <typename Codec = hhc64_codec>
+    constexpr std::string_view max_encoded(std::string_view a, std::string_view b) {
+        return compare_encoded<Codec>(b, a) > 0 ? b : a;
+    }
+
+    /**
+     * @brief Add two padded encoded values digit by digit, without decoding them
+     * @note The output string is not null-terminated; it may alias a or b, and is unspecified if this throws
+     * @tparam Codec A basic_codec instantiation (defaults to 64-bit HHC)
+     * @param a A padded encoded value (ENCODED_LENGTH characters)
+     * @param b A padded encoded value (ENCODED_LENGTH characters)
+     * @param output_string The padded sum (at least ENCODED_LENGTH bytes)
+     * @throws std::invalid_argument if either input contains a character outside the alphabet
+     * @throws std::out_of_range if the sum exceeds the bounds of the codec
+     */
+    template <typename Codec = hhc64_codec>
+    constexpr void add_encoded(const char* a, const char* b, char* output_string) {
+        HHC_ASSERT(a != nullptr && b != nullptr && output_string != nullptr);
+        const bool carry = detail::add_digits<Codec, false>(a, b, output_string);
+        if (carry || !detail::digits_within_bounds(output_string,
+                                                   detail::alphabet_tables<typename Codec::alphabet_type>::INVERSE.data(),
+                                                   Codec::MAX_DIGITS)) {
+            detail::throw_out_of_range("HHC sum exceeds codec bounds");
+        }
+    }
+
+    /**
+     * @brief Subtract two padded encoded values digit by digit, without decoding them
+     * @note The output string is not null-terminated; it may alias a or b, and is unspecified if this throws
+     * @tparam Codec A basic_codec instantiation (defaults to 64-bit HHC)
+     * @param a A padded encoded value (ENCODED_LENGTH characters)
+     * @param b A padded encoded value (ENCODED_LENGTH characters) no larger than a
+     * @param output_string The padded difference a - b (at least ENCODED_LENGTH bytes)
+     * @throws std::invalid_argument if either input contains a character outside the alphabet
+     * @throws std::out_of_range if b is larger than a, or a exceeds the bounds of the codec
+     */
+    template <typename Codec = hhc64_codec>
+    constexpr void subtract_encoded(const char* a, const char* b, char* output_string) {
+        HHC_ASSERT(a != nullptr && b != nullptr && output_string != nullptr);
+        if (detail::add_digits<Codec, true>(a, b, output_string)) {
+            detail::throw_out_of_range("HHC difference is negative");
+        }
+    }
+
+    /**
+     * @brief Add an integer to a padded encoded value (e.g. advance a cursor by a page size)
+     *
+     * Only the digits the carry reaches are rewritten, so small deltas cost a digit or two.
+     * @see add_encoded
+     */
+    template <typename Codec = hhc64_codec>
+    constexpr void add_encoded_value(const char* a, typename Codec::value_type delta, char* output_string) {
+        HHC_ASSERT(a != nullptr && output_string != nullptr);
+        const bool carry = detail::add_value_digits<Codec, false>(a, delta, output_string);
+        if (carry || !detail::digits_within_bounds(output_string,
+                                                   detail::alphabet_tables<typename Codec::alphabet_type>::INVERSE.data(),
+                                                   Codec::MAX_DIGITS)) {
+            detail::throw_out_of_range("HHC sum exceeds codec bounds");
+        }
+    }
+
+    /**
+     * @brief Subtract an integer from a padded encoded value (e.g. step a cursor back by a page size)
+     * @see subtract_encoded
+     */
+    template <typename Codec = hhc64_codec>
+    constexpr void subtract_encoded_value(const char* a, typename Codec::value_type delta, char* output_string) {
+        HHC_ASSERT(a != nullptr && output_string != nullptr);
+        if (detail::add_value_digits<Codec, true>(a, delta, output_string)) {
+            detail::throw_out_of_range("HHC difference is negative");
+        }
+    }
+
+} // namespace hhc
+
+#endif // HHC_ARITHMETIC_HPP
@@ -1,15 +1,62 @@
 #ifndef HHC_ASSERT_HPP
 #define HHC_ASSERT_HPP
 
-#include <cstdlib>
-#include <iostream>
-
 #if defined(__clang__)
 #  define HHC_NO_PROFILE __attribute__((no_profile_instrument_function))
 #else
 #  define HHC_NO_PROFILE
 #endif
 
+/**
+ * Contract levels, selected by defining HHC_CONTRACT_LEVEL before including any HHC header
+ * (or with the HHC_CONTRACT_LEVEL CMake option). Every translation unit of a program must use
+ * the same level.
+ *
+ * - HHC_CONTRACT_OFF:    assertions compile to nothing; the expression is not evaluated
+ * - HHC_CONTRACT_ASSUME: a failed assertion is undefined behavior; the expression becomes an
+ *                        optimizer hint
+ * - HHC_CONTRACT_TRAP:   a failed assertion executes a trap instruction (release default)
+ * - HHC_CONTRACT_DEBUG:  a failed assertion prints the expression, location and a stack trace,
+ *                        then aborts (default when NDEBUG is not defined)
+ */
+#define HHC_CONTRACT_OFF 0
+#define HHC_CONTRACT_ASSUME 1
+#define HHC_CONTRACT_TRAP 2
+#define HHC_CONTRACT_DEBUG 3
+
+#ifndef HHC_CONTRACT_LEVEL
+#  ifdef NDEBUG
+#    define HHC_CONTRACT_LEVEL HHC_CONTRACT_TRAP
+#  else
+#    define HHC_CONTRACT_LEVEL HHC_CONTRACT_DEBUG
+#  endif
+#endif
+
+#if HHC_CONTRACT_LEVEL < HHC_CONTRACT_OFF || HHC_CONTRACT_LEVEL > HHC_CONTRACT_DEBUG
+#  error "HHC_CONTRACT_LEVEL must be one of HHC_CONTRACT_OFF, _ASSUME, _TRAP or _DEBUG"
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#  define HHC_COLD __attribute__((cold, noinline))
+#  define HHC_UNLIKELY(expr) __builtin_expect(!!(expr), 0)
+#  define HHC_BUILTIN_TRAP() __builtin_trap()
+#  define HHC_BUILTIN_UNREACHABLE() __builtin_unreachable()
+#elif defined(_MSC_VER)
+#  define HHC_COLD __declspec(noinline)
+#  define HHC_UNLIKELY(expr) (expr)
+#  define HHC_BUILTIN_TRAP() __debugbreak()
+#  define HHC_BUILTIN_UNREACHABLE() __assume(0)
+#else
+#  error "Unsupported compiler (no trap instruction)"
+#endif
+
+// The reporting machinery (stdio and the platform stack-trace headers) is only pulled in at the
+// debug level, so release translation units that include hhc.hpp do not pay for it.
+#if HHC_CONTRACT_LEVEL == HHC_CONTRACT_DEBUG
+
+#include <cstdio>
+#include <cstdlib>
+
 // Platform-specific includes for stack traces
 // Check Windows first (clang-cl defines __clang__ but not __unix__)
 #if defined(_WIN32) || defined(_WIN64)
@@ -51,6 +98,8 @@
     #define HHC_HAVE_STACKWALK 0
 #endif
 
+#endif // HHC_CONTRACT_LEVEL == HHC_CONTRACT_DEBUG
+
 namespace hhc::detail {
 
 #ifdef LLVM_BUILD_INSTRUMENTED
@@ -63,9 +112,21 @@ inline void flush_coverage_profile() {
 inline void flush_coverage_profile() {}
 #endif
 
+    /**
+     * @brief Handle a contract violation at the trap level
+     *
+     * Cold and out of line, so a check in hot code is a compare and a never-taken branch.
+     */
+    [[noreturn]] HHC_COLD HHC_NO_PROFILE inline void contract_trap() {
+        flush_coverage_profile();
+        HHC_BUILTIN_TRAP();
+        HHC_BUILTIN_UNREACHABLE();
+    }
+
+#if HHC_CONTRACT_LEVEL == HHC_CONTRACT_DEBUG
 
     /**
-     * @brief Print stack trace (debug builds only)
+     * @brief Print stack trace (debug level only)
      */
     HHC_NO_PROFILE inline void print_stack_trace() {
 
@@ -76,9 +137,10 @@ inline void flush_coverage_profile() {}
         
         int frame_count = backtrace(buffer, max_frames);
         
-        std::cerr << "\n=== Stack Trace ===\n";
+        std::fputs("\n=== Stack Trace ===\n", stderr);
+        std::fflush(stderr);
         backtrace_symbols_fd(buffer, frame_count, STDERR_FILENO);
-        std::cerr << "===================\n\n";
+        std::fputs("===================\n\n", stderr);
         
 #elif HHC_HAVE_STACKWALK
         // Windows stack walk
@@ -90,7 +152,7 @@ inline void flush_coverage_profile() {}
         
         WORD frame_count = CaptureStackBackTrace(0, max_frames, stack, NULL);
         
-        std::cerr << "\n=== Stack Trace ===\n";
+        std::fputs("\n=== Stack Trace ===\n", stderr);
         
         SYMBOL_INFO* symbol = (SYMBOL_INFO*)calloc(sizeof(SYMBOL_INFO) + 256 * sizeof(char), 1);
         if (symbol) {
@@ -99,117 +161,104 @@ inline void flush_coverage_profile() {}
             
             for (int i = 0; i < frame_count; i++) {
                 if (SymFromAddr(process, (DWORD64)(stack[i]), 0, symbol)) {
-                    std::cerr << "  " << symbol->Name << " [0x" << std::hex << symbol->Address << std::dec << "]\n";
+                    std::fprintf(stderr, "  %s [0x%llx]\n", symbol->Name, (unsigned long long)symbol->Address);
                 } else {
-                    std::cerr << "  [0x" << std::hex << (DWORD64)stack[i] << std::dec << "]\n";
+                    std::fprintf(stderr, "  [0x%llx]\n", (unsigned long long)(DWORD64)stack[i]);
                 }
             }
             
             free(symbol);
         }
         
-        std::cerr << "===================\n\n";
+        std::fputs("===================\n\n", stderr);
         SymCleanup(process);
         
 #else
         // Fallback: no stack trace available (e.g., musl without libexecinfo)
-        std::cerr << "\n[Stack trace not available on this platform]\n\n";
+        std::fputs("\n[Stack trace not available on this platform]\n\n", stderr);
 #endif
     }
 
     /**
-     * @brief Handle assertion failure
+     * @brief Handle assertion failure at the debug level
      * 
-     * In debug builds: prints detailed error message with stack trace and aborts
-     * In release builds: invokes undefined behavior trap (optimizer hint)
+     * Prints a detailed error message with stack trace and aborts. Cold and out of line, so
+     * the reporting code stays out of the callers' hot paths.
      * 
      * @param expression The expression that failed (as string)
      * @param file Source file name
      * @param line Line number
      * @param function Function name
      */
-    [[noreturn]] HHC_NO_PROFILE inline void assertion_failed(const char* expression,
-                                                             const char* file,
-                                                             const int line,
-                                                             const char* function) {
-#ifndef NDEBUG
-        // Debug build: provide stack trace and error message
-        std::cerr << "\n╔═════════════════════════════════════════════════════════════╗\n"
-                  << "║                  HHC ASSERTION FAILED                       ║\n"
-                  << "╚═════════════════════════════════════════════════════════════╝\n\n"
-                  << "Expression: " << expression << '\n'
-                  << "Location:   " << file << ':' << line << '\n'
-                  << "Function:   " << function << '\n';
+    [[noreturn]] HHC_COLD HHC_NO_PROFILE inline void assertion_failed(const char* expression,
+                                                                      const char* file,
+                                                                      const int line,
+                                                                      const char* function) {
+        std::fprintf(stderr,
+                     "\n╔═════════════════════════════════════════════════════════════╗\n"
+                     "║                  HHC ASSERTION FAILED                       ║\n"
+                     "╚═════════════════════════════════════════════════════════════╝\n\n"
+                     "Expression: %s\n"
+                     "Location:   %s:%d\n"
+                     "Function:   %s\n",
+                     expression, file, line, function);
         
         print_stack_trace();
         
-        std::cerr << "This is a critical error indicating a bug in the HHC library.\n"
-                  << "Please report this issue with the above information.\n\n";
+        std::fputs("This is a critical error indicating a bug in the HHC library.\n"
+                   "Please report this issue with the above information.\n\n", stderr);
         
         flush_coverage_profile();
         std::abort();
-#else
-        // Release build: generate trap instruction
-        // This tells the compiler this code path is unreachable,
-        // enabling aggressive optimizations while still catching bugs
-        
-        // Suppress unused parameter warnings
-        (void)expression;
-        (void)file;
-        (void)line;
-        (void)function;
-        
-        flush_coverage_profile();
-        
-        // Use compiler built-in to generate trap instruction
-        #if defined(__GNUC__) || defined(__clang__)
-            __builtin_trap();
-        #elif defined(_MSC_VER)
-            __debugbreak();
-        #else
-            #error "Unsupported compiler (no trap instruction)"
-        #endif
-        
-        // Tell compiler this is unreachable
-        #if defined(__GNUC__) || defined(__clang__)
-            __builtin_unreachable();
-        #elif defined(_MSC_VER)
-            __assume(0);
-        #else
-            #error "Unsupported compiler (no unreachable instruction)"
-        #endif
-#endif
     }
 
+#endif // HHC_CONTRACT_LEVEL == HHC_CONTRACT_DEBUG
+
 } // namespace hhc::detail
 
+#if HHC_CONTRACT_LEVEL == HHC_CONTRACT_DEBUG
+#  define HHC_CONTRACT_FAIL_(description) \
+    ::hhc::detail::assertion_failed(description, __FILE__, __LINE__, __func__)
+#elif HHC_CONTRACT_LEVEL == HHC_CONTRACT_TRAP
+#  define HHC_CONTRACT_FAIL_(description) ::hhc::detail::contract_trap()
+#else
+#  define HHC_CONTRACT_FAIL_(description) HHC_BUILTIN_UNREACHABLE()
+#endif
+
+#if HHC_CONTRACT_LEVEL == HHC_CONTRACT_OFF
+// sizeof keeps the expression type-checked without evaluating it
+#  define HHC_CONTRACT_CHECK_(expr, description) \
+    do { \
+        (void)sizeof(!(expr)); \
+    } while (0)
+#else
+#  define HHC_CONTRACT_CHECK_(expr, description) \
+    do { \
+        if (HHC_UNLIKELY(!(expr))) { \
+            HHC_CONTRACT_FAIL_(description); \
+        } \
+    } while (0)
+#endif
+
 /**
  * @brief HHC assertion macro
  * 
- * Unlike standard assert(), this macro:
- * - Is ALWAYS enabled (both debug and release builds)
- * - In debug: provides detailed error message with stack trace
- * - In release: generates trap instruction (optimization hint)
+ * Unlike standard assert(), this macro follows HHC_CONTRACT_LEVEL rather than NDEBUG:
+ * - debug: provides detailed error message with stack trace
+ * - trap: generates trap instruction
+ * - assume: tells the optimizer the expression holds
+ * - off: does nothing (the expression is not evaluated)
  * 
  * Use this for conditions that should NEVER be false. If they are,
- * it indicates a critical bug in the library code.
+ * it indicates a critical bug in the library code. Check once per call
+ * rather than per element in batch loops.
  * 
  * Example:
  *   HHC_ASSERT(pointer != nullptr);
  * 
  * @param expr The expression to check (must evaluate to true)
  */
-#define HHC_ASSERT(expr) \
-    do { \
-        if (!(expr)) { \
-            ::hhc::detail::assertion_failed( \
-                #expr, \
-                __FILE__, \
-                __LINE__, \
-                __func__ \
-            ); \
-        } \
-    } while (0)
+#define HHC_ASSERT(expr) HHC_CONTRACT_CHECK_(expr, #expr)
 
 /**
  * @brief HHC assertion macro with custom message
@@ -222,24 +271,15 @@ inline void flush_coverage_profile() {}
  * @param expr The expression to check
  * @param msg Custom error message (string literal)
  */
-#define HHC_ASSERT_MSG(expr, msg) \
-    do { \
-        if (!(expr)) { \
-            ::hhc::detail::assertion_failed( \
-                #expr " (" msg ")", \
-                __FILE__, \
-                __LINE__, \
-                __func__ \
-            ); \
-        } \
-    } while (0)
+#define HHC_ASSERT_MSG(expr, msg) HHC_CONTRACT_CHECK_(expr, #expr " (" msg ")")
 
 /**
  * @brief Mark a code path as unreachable
  * 
  * Use this for code paths that should never be reached.
- * In debug: aborts with error message
- * In release: generates trap instruction (optimization hint)
+ * - debug: aborts with error message
+ * - trap: generates trap instruction
+ * - assume/off: optimizer hint
  * 
  * Example:
  *   switch (value) {
@@ -250,13 +290,6 @@ inline void flush_coverage_profile() {}
  * 
  * @param msg Explanation of why this should be unreachable
  */
-#define HHC_UNREACHABLE(msg) \
-    ::hhc::detail::assertion_failed( \
-        "Unreachable code: " msg, \
-        __FILE__, \
-        __LINE__, \
-        __func__ \
-    )
+#define HHC_UNREACHABLE(msg) HHC_CONTRACT_FAIL_("Unreachable code: " msg)
 
 #endif // HHC_ASSERT_HPP
-
@@ -0,0 +1,512 @@
+#ifndef HHC_BIGINT_HPP
+#define HHC_BIGINT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "hhc_constants.hpp"
+#include "hhc_assert.hpp"
+#include "hhc_codec.hpp"
+
+namespace hhc {
+
+    namespace detail {
+
+        /// Little-endian 32-bit limbs without leading (most significant) zero limbs; zero is empty
+        using limb_vector = std::vector<uint32_t>;
+
+        /// Operand size (in limbs) below which schoolbook multiplication beats Karatsuba
+        inline constexpr std::size_t KARATSUBA_THRESHOLD = 32;
+
+        /// Digits per leaf of the conversion trees (66^10 is the largest power of the base below 2^64)
+        inline constexpr std::size_t BIGINT_LEAF_DIGITS = 10;
+
+        inline void trim_limbs(limb_vector& limbs) {
+            while (!limbs.empty() && limbs.back() == 0) {
+                limbs.pop_back();
+            }
+        }
+
+        inline limb_vector limbs_from_u64(uint64_t value) {
+            limb_vector limbs;
+            if (value != 0) {
+                limbs.push_back(static_cast<uint32_t>(value));
+                if ((value >> 32) != 0) {
+                    limbs.push_back(static_cast<uint32_t>(value >> 32));
+                }
+            }
+            return limbs;
+        }
+
+        /**
+         * @brief Three-way comparison of two normalized limb vectors
+         * @return Negative, zero or positive as a is less than, equal to or greater than b
+         */
+        inline int compare_limbs(const limb_vector& a, const limb_vector& b) {
+            if (a.size() != b.size()) {
+                return a.size() < b.size() ? -1 : 1;
+            }
+            for (std::size_t i = a.size(); i-- > 0;) {
+                if (a[i] != b[i]) {
+                    return a[i] < b[i] ? -1 : 1;
+                }
+            }
+            return 0;
+        }
+
+        /**
+         * @brief a += b * 2^(32 * offset)
+         */
+        inline void add_limbs_shifted(limb_vector& a, const limb_vector& b, std::size_t offset) {
+            if (b.empty()) {
+                return;
+            }
+            if (a.size() < b.size() + offset) {
+                a.resize(b.size() + offset, 0);
+            }
+            uint64_t carry = 0;
+            for (std::size_t i = 0; i < b.size(); ++i) {
+                carry += static_cast<uint64_t>(a[offset + i]) + b[i];
+                a[offset + i] = static_cast<uint32_t>(carry);
+                carry >>= 32;
+            }
+            for (std::size_t pos = offset + b.size(); carry != 0; ++pos) {
+                if (pos == a.size()) {
+                    a.push_back(0);
+                }
+                carry += a[pos];
+                a[pos] = static_cast<uint32_t>(carry);
+                carry >>= 32;
+            }
+        }
+
+        /**
+         * @brief a -= b
+         * @note Requires a >= b
+         */
+        inline void subtract_limbs(limb_vector& a, const limb_vector& b) {
+            HHC_ASSERT(compare_limbs(a, b) >= 0);
+            uint64_t borrow = 0;
+            for (std::size_t i = 0; i < a.size() && (i < b.size() || borrow != 0); ++i) {
+                const uint64_t subtrahend = (i < b.size() ? b[i] : 0) + borrow;
+                borrow = a[i] < subtrahend ? 1 : 0;
+                a[i] = static_cast<uint32_t>(a[i] - subtrahend);
+            }
+            trim_limbs(a);
+        }
+
+        inline limb_vector multiply_schoolbook(const limb_vector& a, const limb_vector& b) {
+            if (a.empty() || b.empty()) {
+                return {};
+            }
+            limb_vector product(a.size() + b.size(), 0);
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                uint64_t carry = 0;
+                for (std::size_t j = 0; j < b.size(); ++j) {
+                    carry += static_cast<uint64_t>(a[i]) * b[j] + product[i + j];
+                    product[i + j] = static_cast<uint32_t>(carry);
+                    carry >>= 32;
+                }
+                product[i + b.size()] = static_cast<uint32_t>(carry);
+            }
+            trim_limbs(product);
+            return product;
+        }
+
+        /**
+         * @brief Karatsuba multiplication, falling back to schoolbook below KARATSUBA_THRESHOLD limbs
+         */
+        inline limb_vector multiply_limbs(const limb_vector& a, const limb_vector& b) {
+            if (a.size() < b.size()) {
+                return multiply_limbs(b, a);
+            }
+            if (b.size() < KARATSUBA_THRESHOLD) {
+                return multiply_schoolbook(a, b);
+            }
+
+            const std::size_t half = a.size() / 2;
+            limb_vector a_low(a.begin(), a.begin() + static_cast<std::ptrdiff_t>(half));
+            const limb_vector a_high(a.begin() + static_cast<std::ptrdiff_t>(half), a.end());
+            trim_limbs(a_low);
+
+            if (b.size() <= half) {
+                // Unbalanced operands: split only the longer one
+                limb_vector product = multiply_limbs(a_low, b);
+                add_limbs_shifted(product, multiply_limbs(a_high, b), half);
+                trim_limbs(product);
+                return product;
+            }
+
+            limb_vector b_low(b.begin(), b.begin() + static_cast<std::ptrdiff_t>(half));
+            const limb_vector b_high(b.begin() + static_cast<std::ptrdiff_t>(half), b.end());
+            trim_limbs(b_low);
+
+            const limb_vector low = multiply_limbs(a_low, b_low);
+            const limb_vector high = multiply_limbs(a_high, b_high);
+            add_limbs_shifted(a_low, a_high, 0);
+            add_limbs_shifted(b_low, b_high, 0);
+            limb_vector middle = multiply_limbs(a_low, b_low);
+            subtract_limbs(middle, low);
+            subtract_limbs(middle, high);
+
+            limb_vector product = low;
+            add_limbs_shifted(product, middle, half);
+            add_limbs_shifted(product, high, 2 * half);
+            trim_limbs(product);
+            return product;
+        }
+
+        /**
+         * @brief Schoolbook long division (Knuth, TAOCP vol. 2, algorithm D)
+         * @note Requires a divisor of at least two limbs
+         */
+        inline void divmod_limbs(const limb_vector& dividend, const limb_vector& divisor, limb_vector& quotient,
+                                 limb_vector& remainder) {
+            HHC_ASSERT(divisor.size() >= 2);
+            if (compare_limbs(dividend, divisor) < 0) {
+                quotient.clear();
+                remainder = dividend;
+                return;
+            }
+
+            const std::size_t n = divisor.size();
+            const std::size_t m = dividend.size() - n;
+
+            // Normalize so the top bit of the divisor is set
+            unsigned shift = 0;
+            while ((divisor.back() << shift & 0x80000000U) == 0) {
+                ++shift;
+            }
+            const auto shift_in = [shift](uint32_t high, uint32_t low) {
+                return shift == 0 ? high : static_cast<uint32_t>((high << shift) | (low >> (32 - shift)));
+            };
+            limb_vector v(n);
+            for (std::size_t i = n - 1; i > 0; --i) {
+                v[i] = shift_in(divisor[i], divisor[i - 1]);
+            }
+            v[0] = divisor[0] << shift;
+            limb_vector u(m + n + 1);
+            u[m + n] = shift == 0 ? 0 : dividend[m + n - 1] >> (32 - shift);
+            for (std::size_t i = m + n - 1; i > 0; --i) {
+                u[i] = shift_in(dividend[i], dividend[i - 1]);
+            }
+            u[0] = dividend[0] << shift;
+
+            quotient.assign(m + 1, 0);
+            for (std::size_t j = m + 1; j-- > 0;) {
+                const uint64_t numerator = (static_cast<uint64_t>(u[j + n]) << 32) | u[j + n - 1];
+                uint64_t q_hat = numerator / v[n - 1];
+                uint64_t r_hat = numerator % v[n - 1];
+                while (q_hat > 0xFFFFFFFFULL || q_hat * v[n - 2] > ((r_hat << 32) | u[j + n - 2])) {
+                    --q_hat;
+                    r_hat += v[n - 1];
+                    if (r_hat > 0xFFFFFFFFULL) {
+                        break;
+                    }
+                }
+
+                // Multiply and subtract
+                int64_t borrow = 0;
+                uint64_t carry = 0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    const uint64_t product = q_hat * v[i] + carry;
+                    carry = product >> 32;
+                    const int64_t difference = static_cast<int64_t>(u[i + j]) - borrow -
+                                               static_cast<int64_t>(product & 0xFFFFFFFFULL);
+                    u[i + j] = static_cast<uint32_t>(difference);
+                    borrow = difference < 0 ? 1 : 0;
+                }
+                const int64_t top = static_cast<int64_t>(u[j + n]) - borrow - static_cast<int64_t>(carry);
+                u[j + n] = static_cast<uint32_t>(top);
+
+                if (top < 0) {
+                    // q_hat was one too large: add the divisor back
+                    --q_hat;
+                    uint64_t sum = 0;
+                    for (std::size_t i = 0; i < n; ++i) {
+                        sum += static_cast<uint64_t>(u[i + j]) + v[i];
+                        u[i + j] = static_cast<uint32_t>(sum);
+                        sum >>= 32;
+                    }
+                    u[j + n] = static_cast<uint32_t>(u[j + n] + sum);
+                }
+                quotient[j] = static_cast<uint32_t>(q_hat);
+            }
+
+            remainder.assign(n, 0);
+            for (std::size_t i = 0; i < n; ++i) {
+                remainder[i] = shift == 0 ? u[i] : static_cast<uint32_t>((u[i] >> shift) | (u[i + 1] << (32 - shift)));
+            }
+            trim_limbs(quotient);
+            trim_limbs(remainder);
+        }
+
+        /**
+         * @brief Powers 66^(10 * 2^k) and their Barrett reciprocals, shared by every conversion on a thread
+         *
+         * Conversions split values around these powers, so after the first few calls every power
+         * (and reciprocal) a conversion needs is already cached.
+         */
+        class bigint_powers {
+        public:
+            /// 66^(10 * 2^level)
+            const limb_vector& power(std::size_t level) {
+                while (powers_.size() <= level) {
+                    powers_.push_back(powers_.empty() ? limbs_from_u64(1568336880910795776ULL)  // 66^10
+                                                      : multiply_limbs(powers_.back(), powers_.back()));
+                }
+                return powers_[level];
+            }
+
+            /**
+             * @brief Split value into value / power(level) and value % power(level)
+             * @note Requires value < power(level)^2
+             */
+            void divmod(const limb_vector& value, std::size_t level, limb_vector& quotient, limb_vector& remainder) {
+                const limb_vector& divisor = power(level);
+                const limb_vector& reciprocal = this->reciprocal(level);
+                const std::size_t m = divisor.size();
+                HHC_ASSERT(value.size() <= 2 * m);
+
+                // Barrett reduction: q = floor(floor(value / B^(m-1)) * floor(B^(2m) / divisor) / B^(m+1)),
+                // which undershoots the true quotient by at most two
+                if (value.size() <= m - 1) {
+                    quotient.clear();
+                } else {
+                    const limb_vector value_high(value.begin() + static_cast<std::ptrdiff_t>(m - 1), value.end());
+                    quotient = multiply_limbs(value_high, reciprocal);
+                    if (quotient.size() <= m + 1) {
+                        quotient.clear();
+                    } else {
+                        quotient.erase(quotient.begin(), quotient.begin() + static_cast<std::ptrdiff_t>(m + 1));
+                    }
+                }
+
+                remainder = value;
+                subtract_limbs(remainder, multiply_limbs(quotient, divisor));
+                while (compare_limbs(remainder, divisor) >= 0) {
+                    subtract_limbs(remainder, divisor);
+                    add_limbs_shifted(quotient, limb_vector{1}, 0);
+                }
+            }
+
+        private:
+            /// floor(B^(2m) / power(level)) where m is the limb count of the power and B = 2^32
+            const limb_vector& reciprocal(std::size_t level) {
+                while (reciprocals_.size() <= level) {
+                    const limb_vector& divisor = power(reciprocals_.size());
+                    limb_vector numerator(2 * divisor.size() + 1, 0);
+                    numerator.back() = 1;
+                    limb_vector quotient;
+                    limb_vector remainder;
+                    divmod_limbs(numerator, divisor, quotient, remainder);
+                    reciprocals_.push_back(std::move(quotient));
+                }
+                return reciprocals_[level];
+            }
+
+            std::vector<limb_vector> powers_;
+            std::vector<limb_vector> reciprocals_;
+        };
+
+        inline bigint_powers& bigint_power_cache() {
+            thread_local bigint_powers cache;
+            return cache;
+        }
+
+        /**
+         * @brief Write exactly 10 * 2^level digits of value (which must be below 66^(10 * 2^level))
+         */
+        inline void bigint_encode_digits(const limb_vector& value, std::size_t level, bigint_powers& powers,
+                                         char* output_string) {
+            if (value.empty()) {
+                return;  // the output is pre-filled with the zero symbol
+            }
+            if (level == 0) {
+                uint64_t leaf = value[0];
+                if (value.size() > 1) {
+                    leaf |= static_cast<uint64_t>(value[1]) << 32;
+                }
+                encode_digits<BIGINT_LEAF_DIGITS, BASE>(leaf, ALPHABET.data(),
+                                                        alphabet_tables<hhc_alphabet>::PAIRS.data(), output_string);
+                return;
+            }
+            limb_vector quotient;
+            limb_vector remainder;
+            powers.divmod(value, level - 1, quotient, remainder);
+            bigint_encode_digits(quotient, level - 1, powers, output_string);
+            bigint_encode_digits(remainder, level - 1, powers, output_string + (BIGINT_LEAF_DIGITS << (level - 1)));
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Arbitrary-precision unsigned integer for the big-integer HHC codec
+     *
+     * Stores little-endian 32-bit limbs with no leading zero limbs, so zero has no limbs.
+     */
+    class big_uint {
+    public:
+        using limb_type = uint32_t;
+
+        big_uint() = default;
+
+        explicit big_uint(uint64_t value) : limbs_(detail::limbs_from_u64(value)) {}
+
+        /**
+         * @brief Build a value from little-endian limbs (leading zero limbs are dropped)
+         */
+        static big_uint from_limbs(std::vector<limb_type> limbs) {
+            detail::trim_limbs(limbs);
+            big_uint value;
+            value.limbs_ = std::move(limbs);
+            return value;
+        }
+
+        /**
+         * @brief Build a value from big-endian bytes
+         * @param bytes The bytes, most significant first
+         * @param size The number of bytes
+         */
+        static big_uint from_bytes(const uint8_t* bytes, std::size_t size) {
+            HHC_ASSERT(size == 0 || bytes != nullptr);
+            std::vector<limb_type> limbs((size + 3) / 4, 0);
+            for (std::size_t i = 0; i < size; ++i) {
+                const std::size_t position = size - 1 - i;
+                limbs[position / 4] |= static_cast<limb_type>(bytes[i]) << (8 * (position % 4));
+            }
+            return from_limbs(std::move(limbs));
+        }
+
+        /**
+         * @brief Big-endian bytes of the value without leading zero bytes (empty for zero)
+         */
+        std::vector<uint8_t> to_bytes() const {
+            const std::size_t size = (bit_width() + 7) / 8;
+            std::vector<uint8_t> bytes(size);
+            for (std::size_t position = 0; position < size; ++position) {
+                bytes[size - 1 - position] = static_cast<uint8_t>(limbs_[position / 4] >> (8 * (position % 4)));
+            }
+            return bytes;
+        }
+
+        const std::vector<limb_type>& limbs() const noexcept {
+            return limbs_;
+        }
+
+        bool is_zero() const noexcept {
+            return limbs_.empty();
+        }
+
+        /**
+         * @brief Number of significant bits (0 for zero)
+         */
+        std::size_t bit_width() const noexcept {
+            if (limbs_.empty()) {
+                return 0;
+            }
+            std::size_t bits = 32 * (limbs_.size() - 1);
+            for (limb_type top = limbs_.back(); top != 0; top >>= 1) {
+                ++bits;
+            }
+            return bits;
+        }
+
+        friend bool operator==(const big_uint& lhs, const big_uint& rhs) {
+            return lhs.limbs_ == rhs.limbs_;
+        }
+
+        friend bool operator!=(const big_uint& lhs, const big_uint& rhs) {
+            return !(lhs == rhs);
+        }
+
+        friend bool operator<(const big_uint& lhs, const big_uint& rhs) {
+            return detail::compare_limbs(lhs.limbs_, rhs.limbs_) < 0;
+        }
+
+    private:
+        std::vector<limb_type> limbs_;
+    };
+
+    /**
+     * @brief Encode an arbitrary-precision integer into an unpadded HHC string
+     *
+     * Converts divide-and-conquer: the value is split around cached powers 66^(10 * 2^k) with
+     * Barrett division (Karatsuba products), and each 10-digit leaf is emitted by the 64-bit
+     * pair-table kernel, so large values avoid the quadratic digit-by-digit loop.
+     *
+     * @param value The value to encode
+     * @return The encoded string; zero encodes to a single "-"
+     */
+    inline std::string hhc_bigint_encode(const big_uint& value) {
+        const detail::limb_vector& limbs = value.limbs();
+        if (limbs.empty()) {
+            return std::string(1, ALPHABET[0]);
+        }
+
+        detail::bigint_powers& powers = detail::bigint_power_cache();
+        std::size_t level = 0;
+        while (detail::compare_limbs(limbs, powers.power(level)) >= 0) {
+            ++level;
+        }
+
+        std::string output(detail::BIGINT_LEAF_DIGITS << level, ALPHABET[0]);
+        detail::bigint_encode_digits(limbs, level, powers, &output[0]);
+        output.erase(0, output.find_first_not_of(ALPHABET[0]));
+        return output;
+    }
+
+    /**
+     * @brief Decode a padded or unpadded HHC string of any length into an arbitrary-precision integer
+     *
+     * The string is split into 10-digit leaves, which are combined pairwise with the same cached
+     * powers of 66 the encoder uses (Karatsuba products), so large strings avoid the quadratic
+     * multiply-by-66 loop.
+     *
+     * @param input_string The input string to decode
+     * @return The decoded value
+     * @throws std::invalid_argument if the string is invalid
+     */
+    inline big_uint hhc_bigint_decode(const char* input_string) {
+        if (input_string == nullptr) {
+            detail::throw_null_string();
+        }
+        const uint8_t* inverse = detail::alphabet_tables<hhc_alphabet>::INVERSE.data();
+        const std::size_t length = detail::validate_symbols(input_string, inverse);
+        if (length == 0) {
+            detail::throw_invalid_length(length);
+        }
+
+        std::size_t leaves = 1;
+        std::size_t levels = 0;
+        while (leaves * detail::BIGINT_LEAF_DIGITS < length) {
+            leaves *= 2;
+            ++levels;
+        }
+        std::string padded(leaves * detail::BIGINT_LEAF_DIGITS - length, ALPHABET[0]);
+        padded.append(input_string, length);
+
+        std::vector<detail::limb_vector> values(leaves);
+        for (std::size_t i = 0; i < leaves; ++i) {
+            values[i] = detail::limbs_from_u64(detail::decode_digits<detail::BIGINT_LEAF_DIGITS, BASE, uint64_t>(
+                padded.data() + i * detail::BIGINT_LEAF_DIGITS, inverse));
+        }
+
+        detail::bigint_powers& powers = detail::bigint_power_cache();
+        for (std::size_t level = 0; level < levels; ++level) {
+            const detail::limb_vector& power = powers.power(level);
+            for (std::size_t i = 0; i < values.size() / 2; ++i) {
+                detail::limb_vector combined = detail::multiply_limbs(values[2 * i], power);
+                detail::add_limbs_shifted(combined, values[2 * i + 1], 0);
+                values[i] = std::move(combined);
+            }
+            values.resize(values.size() / 2);
+        }
+        return big_uint::from_limbs(std::move(values[0]));
+    }
+
+} // namespace hhc
+
+#endif // HHC_BIGINT_HPP
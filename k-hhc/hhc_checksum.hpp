@@ -0,0 +1,297 @@
+#ifndef HHC_CHECKSUM_HPP
+#define HHC_CHECKSUM_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include "hhc_assert.hpp"
+#include "hhc_codec.hpp"
+
+namespace hhc {
+
+    namespace detail {
+
+        /**
+         * @brief Luhn mod N tables for an alphabet
+         *
+         * Luhn mod N doubles every second digit counting leftwards from the check symbol, folding
+         * doubled values of BASE or more back into range (2d - BASE + 1), and picks the check symbol
+         * that brings the sum to a multiple of BASE. It catches every single-symbol substitution and
+         * every adjacent transposition except swapping the first and last symbols of the alphabet.
+         */
+        template <typename Alphabet>
+        struct luhn_tables {
+            static constexpr uint32_t BASE = alphabet_tables<Alphabet>::BASE;
+
+            /// Fold a doubled digit (below 2 * BASE) back into range; arithmetic, so loops over digits vectorize
+            static constexpr uint32_t fold(uint32_t twice) noexcept { return twice < BASE ? twice : twice - BASE + 1; }
+
+            /// Digit -> doubled and folded digit; entries past BASE are never used for valid input
+            static constexpr std::array<uint8_t, 256> DOUBLED = [] {
+                std::array<uint8_t, 256> doubled{};
+                for (uint32_t digit = 0; digit < BASE; ++digit) {
+                    doubled[digit] = static_cast<uint8_t>(fold(2 * digit));
+                }
+                return doubled;
+            }();
+
+            /// Two-digit value -> high digit plus doubled low digit, matching the pairs encoders emit
+            static constexpr std::array<uint8_t, BASE * BASE> PAIR_SUMS = [] {
+                std::array<uint8_t, BASE * BASE> sums{};
+                for (uint32_t high = 0; high < BASE; ++high) {
+                    for (uint32_t low = 0; low < BASE; ++low) {
+                        sums[high * BASE + low] = static_cast<uint8_t>(high + DOUBLED[low]);
+                    }
+                }
+                return sums;
+            }();
+        };
+
+        [[noreturn]] inline void throw_checksum_mismatch() {
+            throw std::invalid_argument("HHC check symbol does not match");
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief A codec that appends a Luhn mod 66 check symbol to every encoding
+     *
+     * The check symbol is computed in the same loop that produces the digits, and checked in
+     * the same pass that validates and decodes them, so a mistyped ID is rejected before it
+     * reaches a lookup. Leading padding symbols are zero digits and do not change the check
+     * symbol, so padded and unpadded forms of a value end in the same symbol.
+     *
+     * Example:
+     *   char code[hhc::checksum_codec32::ENCODED_LENGTH];
+     *   hhc::checksum_codec32::encode_padded(invite_id, code);
+     *   if (!hhc::checksum_codec32::verify(text, length)) { return bad_request(); }
+     *
+     * @tparam Codec A basic_codec instantiation
+     */
+    template <typename Codec>
+    class basic_checksum_codec {
+        using UInt = typename Codec::value_type;
+        using tables = detail::alphabet_tables<typename Codec::alphabet_type>;
+        using luhn = detail::luhn_tables<typename Codec::alphabet_type>;
+        static constexpr uint32_t BASE = Codec::BASE;
+        static constexpr std::size_t DIGITS = Codec::ENCODED_LENGTH;
+
+    public:
+        using codec_type = Codec;
+        using value_type = UInt;
+
+        /// Characters in a padded encoding, check symbol included
+        static constexpr std::size_t ENCODED_LENGTH = DIGITS + 1;
+        /// Buffer size for an unpadded encoding, check symbol and null terminator included
+        static constexpr std::size_t STRING_LENGTH = Codec::STRING_LENGTH + 1;
+
+        /**
+         * @brief The check symbol for length symbols of the alphabet
+         * @note The symbols are not validated
+         */
+        static constexpr char check_symbol(const char* digits, std::size_t length) {
+            HHC_ASSERT(length == 0 || digits != nullptr);
+            uint32_t sum = 0;
+            for (std::size_t pos = 0; pos < length; ++pos) {
+                const uint8_t digit = tables::INVERSE[static_cast<unsigned char>(digits[pos])];
+                // The symbol just left of the check symbol is doubled
+                sum += (length - 1 - pos) % 2 == 0 ? luhn::DOUBLED[digit] : digit;
+            }
+            return Codec::ALPHABET[(BASE - sum % BASE) % BASE];
+        }
+
+        /**
+         * @brief Encode a value into ENCODED_LENGTH characters: the padded digits, then the check symbol
+         * @note The output string is not null-terminated
+         * @param input The value to encode
+         * @param output_string The output string (at least ENCODED_LENGTH bytes)
+         */
+        static constexpr void encode_padded(UInt input, char* output_string) {
+            HHC_ASSERT(output_string != nullptr);
+            // Pairs are cut from the right, so the low digit of every pair is a doubled one
+            constexpr uint32_t PAIR_BASE = BASE * BASE;
+            uint32_t sum = 0;
+            std::size_t pos = DIGITS;
+            for (; pos >= 2; pos -= 2) {
+                const auto pair = static_cast<uint32_t>(input % PAIR_BASE);
+                input /= PAIR_BASE;
+                if (detail::is_constant_evaluated()) {
+                    output_string[pos - 2] = tables::PAIRS[2 * pair];
+                    output_string[pos - 1] = tables::PAIRS[2 * pair + 1];
+                } else {
+                    std::memcpy(output_string + pos - 2, tables::PAIRS.data() + 2 * pair, 2);
+                }
+                sum += luhn::PAIR_SUMS[pair];
+            }
+            if (pos == 1) {
+                const auto digit = static_cast<uint32_t>(input % BASE);
+                output_string[0] = Codec::ALPHABET[digit];
+                sum += luhn::DOUBLED[digit];
+            }
+            output_string[DIGITS] = Codec::ALPHABET[(BASE - sum % BASE) % BASE];
+        }
+
+        /**
+         * @brief Encode a value without leading padding symbols, followed by the check symbol
+         * @note The output string is null-terminated; zero encodes to the check symbol alone
+         * @param input The value to encode
+         * @param output_string The output string (at least STRING_LENGTH bytes)
+         */
+        static constexpr void encode_unpadded(UInt input, char* output_string) {
+            HHC_ASSERT(output_string != nullptr);
+            char padded[ENCODED_LENGTH] = {};
+            encode_padded(input, padded);
+            std::size_t skip = 0;
+            while (skip < DIGITS && padded[skip] == Codec::ALPHABET[0]) {
+                ++skip;
+            }
+            std::size_t out = 0;
+            for (std::size_t pos = skip; pos < ENCODED_LENGTH; ++pos) {
+                output_string[out++] = padded[pos];
+            }
+            output_string[out] = '\0';
+        }
+
+        /**
+         * @brief Whether length characters are alphabet symbols ending in the right check symbol
+         *
+         * Bounds are not checked; decode does that as well.
+         */
+        static constexpr bool verify(const char* input_string, std::size_t length) noexcept {
+            if (input_string == nullptr || length == 0 || length > ENCODED_LENGTH) {
+                return false;
+            }
+            uint8_t combined = 0;
+            uint32_t sum = 0;
+            for (std::size_t pos = 0; pos < length; ++pos) {
+                const uint8_t digit = tables::INVERSE[static_cast<unsigned char>(input_string[pos])];
+                combined |= digit;
+                sum += (length - 1 - pos) % 2 == 1 ? luhn::fold(2U * digit) : digit;
+            }
+            return (combined & 0x80U) == 0 && sum % BASE == 0;
+        }
+
+        /**
+         * @brief Verify and decode a padded or unpadded string of known length
+         * @param input_string Digits followed by the check symbol (it need not be null-terminated)
+         * @param length The number of characters, check symbol included
+         * @return The decoded value
+         * @throws std::invalid_argument if the string is empty, too long, has a character outside the
+         *                               alphabet or a wrong check symbol
+         * @throws std::out_of_range if the digits exceed the bounds of UInt
+         */
+        static constexpr UInt decode(const char* input_string, std::size_t length) {
+            if (input_string == nullptr) {
+                detail::throw_null_string();
+            }
+            if (length == 0 || length > ENCODED_LENGTH) {
+                detail::throw_invalid_length(length);
+            }
+            if (length == ENCODED_LENGTH) {
+                return decode_record(input_string);
+            }
+            if (!verify(input_string, length)) {
+                throw_verify_failure(input_string, length);
+            }
+            return length == 1 ? UInt{0} : Codec::decode(input_string, length - 1);
+        }
+
+        /**
+         * @brief Verify and decode a padded or unpadded null-terminated string
+         * @throws std::invalid_argument if the string is invalid or its check symbol is wrong
+         * @throws std::out_of_range if the digits exceed the bounds of UInt
+         */
+        static constexpr UInt decode(const char* input_string) {
+            if (input_string == nullptr) {
+                detail::throw_null_string();
+            }
+            std::size_t length = 0;
+            while (length <= ENCODED_LENGTH && input_string[length] != '\0') {
+                ++length;
+            }
+            return decode(input_string, length);
+        }
+
+        /**
+         * @brief Encode count values into back-to-back ENCODED_LENGTH-character records
+         * @note The output is not null-terminated
+         */
+        static void encode_padded_batch(const UInt* inputs, std::size_t count, char* output) {
+            HHC_ASSERT(count == 0 || (inputs != nullptr && output != nullptr));
+            for (std::size_t i = 0; i < count; ++i) {
+                encode_padded(inputs[i], output + i * ENCODED_LENGTH);
+            }
+        }
+
+        /**
+         * @brief Verify and decode count back-to-back ENCODED_LENGTH-character records
+         * @throws std::invalid_argument if a record has a character outside the alphabet or a wrong check symbol
+         * @throws std::out_of_range if a record exceeds the bounds of UInt
+         */
+        static void decode_batch(const char* input, std::size_t count, UInt* outputs) {
+            HHC_ASSERT(count == 0 || (input != nullptr && outputs != nullptr));
+            for (std::size_t i = 0; i < count; ++i) {
+                outputs[i] = decode_record(input + i * ENCODED_LENGTH);
+            }
+        }
+
+        /**
+         * @brief Check count back-to-back records without decoding them, e.g. to scrub stored data
+         * @param input The encoded records
+         * @param count The number of records
+         * @param valid Receives whether each record passes verify (at least count entries)
+         * @return The number of records that pass
+         */
+        static std::size_t verify_batch(const char* input, std::size_t count, bool* valid) {
+            HHC_ASSERT(count == 0 || (input != nullptr && valid != nullptr));
+            std::size_t passed = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                valid[i] = verify(input + i * ENCODED_LENGTH, ENCODED_LENGTH);
+                passed += valid[i];
+            }
+            return passed;
+        }
+
+    private:
+        /**
+         * @brief Validate, verify and decode one padded record in a single pass over its characters
+         */
+        static constexpr UInt decode_record(const char* record) {
+            uint8_t combined = 0;
+            uint32_t sum = 0;
+            for (std::size_t pos = 0; pos < ENCODED_LENGTH; ++pos) {
+                const uint8_t digit = tables::INVERSE[static_cast<unsigned char>(record[pos])];
+                combined |= digit;
+                sum += (DIGITS - pos) % 2 == 1 ? luhn::fold(2U * digit) : digit;
+            }
+            if ((combined & 0x80U) != 0) {
+                detail::throw_invalid_character();
+            }
+            if (sum % BASE != 0) {
+                detail::throw_checksum_mismatch();
+            }
+            if (!detail::digits_within_bounds(record, tables::INVERSE.data(), Codec::MAX_DIGITS)) {
+                detail::throw_out_of_range("HHC string exceeds codec bounds");
+            }
+            return detail::decode_digits<DIGITS, BASE, UInt>(record, tables::INVERSE.data());
+        }
+
+        /// Report why verify rejected a string: a foreign character or a wrong check symbol
+        [[noreturn]] static void throw_verify_failure(const char* input_string, std::size_t length) {
+            for (std::size_t pos = 0; pos < length; ++pos) {
+                if (tables::INVERSE[static_cast<unsigned char>(input_string[pos])] == detail::INVALID_DIGIT) {
+                    detail::throw_invalid_character();
+                }
+            }
+            detail::throw_checksum_mismatch();
+        }
+    };
+
+    using checksum_codec32 = basic_checksum_codec<hhc32_codec>;
+    using checksum_codec64 = basic_checksum_codec<hhc64_codec>;
+
+} // namespace hhc
+
+#endif // HHC_CHECKSUM_HPP
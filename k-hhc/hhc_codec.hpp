@@ -0,0 +1,629 @@
+#ifndef HHC_CODEC_HPP
+#define HHC_CODEC_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "hhc_constants.hpp"
+#include "hhc_assert.hpp"
+
+namespace hhc {
+
+    namespace detail {
+
+        /**
+         * @brief Throw the invalid-length error raised by the safe decoders
+         * @note Kept out of line so the constexpr decoders never evaluate a std::string in constant expressions
+         * @param length The validated length of the rejected string
+         */
+        [[noreturn]] inline void throw_invalid_length(std::size_t length) {
+            throw std::invalid_argument("Invalid HHC string (length " + std::to_string(length) + ")");
+        }
+
+        /**
+         * @brief Throw the nullptr error raised by the safe decoders
+         */
+        [[noreturn]] inline void throw_null_string() {
+            throw std::invalid_argument("Invalid HHC string (nullptr)");
+        }
+
+        /**
+         * @brief Throw the invalid-character error raised by the fixed-width batch decoders
+         */
+        [[noreturn]] inline void throw_invalid_character() {
+            throw std::invalid_argument("Invalid HHC string (character outside alphabet)");
+        }
+
+        /**
+         * @brief Throw the out-of-range error raised by the safe decoders
+         * @param message The bound that was exceeded
+         */
+        [[noreturn]] inline void throw_out_of_range(const char* message) {
+            throw std::out_of_range(message);
+        }
+
+        /**
+         * @brief Portable std::is_constant_evaluated for C++17 builds
+         * @return True while evaluating a constant expression; false at runtime or if the compiler cannot tell
+         */
+        constexpr bool is_constant_evaluated() noexcept {
+#if defined(__cpp_lib_is_constant_evaluated)
+            return std::is_constant_evaluated();
+#elif defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+            return __builtin_is_constant_evaluated();
+#else
+            return false;
+#endif
+        }
+
+        /**
+         * @brief Load Bytes bytes as a big-endian word (the first byte in the top byte)
+         */
+        template <std::size_t Bytes, typename UInt>
+        constexpr UInt load_be(const char* input) {
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            if (!is_constant_evaluated()) {
+                UInt word = 0;
+                std::memcpy(&word, input, Bytes);
+                if constexpr (Bytes == 8) {
+                    return __builtin_bswap64(word);
+                } else {
+                    return __builtin_bswap32(word);
+                }
+            }
+#endif
+            UInt word = 0;
+            for (std::size_t i = 0; i < Bytes; ++i) {
+                word = static_cast<UInt>((word << 8) | static_cast<unsigned char>(input[i]));
+            }
+            return word;
+        }
+
+        /**
+         * @brief Store the low Bytes bytes of a word big-endian (the top byte first)
+         */
+        template <std::size_t Bytes, typename UInt>
+        constexpr void store_be(UInt word, unsigned char* output) {
+            for (std::size_t i = 0; i < Bytes; ++i) {
+                output[i] = static_cast<unsigned char>(word >> (8 * (Bytes - 1 - i)));
+            }
+        }
+
+        /// Marker stored in inverse tables for bytes outside the alphabet (valid digits are always < 128)
+        inline constexpr uint8_t INVALID_DIGIT = 0xFF;
+
+        /**
+         * @brief Build a symbol array from a string literal (the trailing null is dropped)
+         */
+        template <std::size_t N>
+        constexpr std::array<char, N - 1> make_symbols(const char (&chars)[N]) {
+            std::array<char, N - 1> symbols{};
+            for (std::size_t i = 0; i + 1 < N; ++i) {
+                symbols[i] = chars[i];
+            }
+            return symbols;
+        }
+
+        /**
+         * @brief Check whether an alphabet lists its symbols in ascending byte order
+         *
+         * For such alphabets (HHC, base62, base58, base36) equal-length encodings compare like
+         * the values they encode, so a plain byte comparison orders them numerically.
+         */
+        template <std::size_t N>
+        constexpr bool is_ascii_ordered(const std::array<char, N>& symbols) {
+            for (std::size_t i = 1; i < N; ++i) {
+                if (static_cast<unsigned char>(symbols[i - 1]) >= static_cast<unsigned char>(symbols[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Check that an alphabet is ASCII-only and free of duplicates
+         */
+        template <std::size_t N>
+        constexpr bool is_valid_alphabet(const std::array<char, N>& symbols) {
+            std::array<bool, 128> seen{};
+            for (const char symbol : symbols) {
+                const auto c = static_cast<unsigned char>(symbol);
+                if (c == 0 || c >= 128 || seen[c]) {
+                    return false;
+                }
+                seen[c] = true;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Number of digits needed to represent the largest UInt value in the given base
+         */
+        template <typename UInt, uint32_t Base>
+        constexpr std::size_t max_digits() {
+            UInt value = std::numeric_limits<UInt>::max();
+            std::size_t digits = 0;
+            do {
+                value /= Base;
+                ++digits;
+            } while (value != 0);
+            return digits;
+        }
+
+        /**
+         * @brief Buffer size for an encoded string: room for the null terminator, rounded up to a power of two
+         */
+        constexpr std::size_t string_length_for(std::size_t encoded_length) {
+            std::size_t length = 1;
+            while (length < encoded_length + 1) {
+                length *= 2;
+            }
+            return length;
+        }
+
+        /**
+         * @brief Compile-time lookup tables shared by every codec over the same alphabet
+         * @tparam Alphabet A type exposing `static constexpr std::array<char, N> symbols`
+         */
+        template <typename Alphabet>
+        struct alphabet_tables {
+            static constexpr uint32_t BASE = static_cast<uint32_t>(Alphabet::symbols.size());
+            static_assert(BASE >= 2, "An alphabet needs at least two symbols");
+            static_assert(is_valid_alphabet(Alphabet::symbols), "Alphabet symbols must be unique non-null ASCII characters");
+
+            /// Byte -> digit value, INVALID_DIGIT for bytes outside the alphabet
+            static constexpr std::array<uint8_t, 256> INVERSE = [] {
+                std::array<uint8_t, 256> inverse{};
+                for (auto& digit : inverse) {
+                    digit = INVALID_DIGIT;
+                }
+                for (uint32_t i = 0; i < BASE; ++i) {
+                    inverse[static_cast<unsigned char>(Alphabet::symbols[i])] = static_cast<uint8_t>(i);
+                }
+                return inverse;
+            }();
+
+            /// Two-digit value -> two symbols, so encoders emit a pair of characters per division
+            static constexpr std::array<char, 2 * BASE * BASE> PAIRS = [] {
+                std::array<char, 2 * BASE * BASE> pairs{};
+                for (uint32_t high = 0; high < BASE; ++high) {
+                    for (uint32_t low = 0; low < BASE; ++low) {
+                        pairs[2 * (high * BASE + low)] = Alphabet::symbols[high];
+                        pairs[2 * (high * BASE + low) + 1] = Alphabet::symbols[low];
+                    }
+                }
+                return pairs;
+            }();
+        };
+
+        /**
+         * @brief Write the Length least significant base-Base digits of input, most significant first
+         *
+         * Digits are produced two at a time from the pair table, halving the dependent division chain.
+         * Constant evaluation falls back to one digit per step because memcpy is not constexpr.
+         *
+         * @param input The value to encode (digits above Length are dropped)
+         * @param symbols The alphabet, indexed by digit value
+         * @param pairs The pair table for the same alphabet
+         * @param output_string Destination for exactly Length characters
+         */
+        template <std::size_t Length, uint32_t Base, typename UInt>
+        constexpr void encode_digits(UInt input, const char* symbols, const char* pairs, char* output_string) {
+            std::size_t pos = Length;
+            if (is_constant_evaluated()) {
+                for (; pos > 0; --pos) {
+                    output_string[pos - 1] = symbols[input % Base];
+                    input /= Base;
+                }
+                return;
+            }
+            constexpr uint32_t pair_base = Base * Base;
+            for (; pos >= 2; pos -= 2) {
+                const auto pair = static_cast<uint32_t>(input % pair_base);
+                input /= pair_base;
+                std::memcpy(output_string + pos - 2, pairs + 2 * pair, 2);
+            }
+            if (pos == 1) {
+                output_string[0] = symbols[input % Base];
+            }
+        }
+
+        /**
+         * @brief Powers of Base matching each position of a Length-digit string (most significant first)
+         */
+        template <typename UInt, uint32_t Base, std::size_t Length>
+        constexpr std::array<UInt, Length> make_place_values() {
+            std::array<UInt, Length> place_values{};
+            UInt exponent = 1;
+            for (std::size_t pos = Length; pos > 0; --pos) {
+                place_values[pos - 1] = exponent;
+                exponent = static_cast<UInt>(exponent * Base);
+            }
+            return place_values;
+        }
+
+        /**
+         * @brief Decode exactly Length characters without validation
+         * @param input_string The characters to decode
+         * @param inverse The inverse table of the alphabet
+         * @return The decoded value (wraps if the digits exceed UInt)
+         */
+        template <std::size_t Length, uint32_t Base, typename UInt>
+        constexpr UInt decode_digits(const char* input_string, const uint8_t* inverse) {
+            constexpr auto place_values = make_place_values<UInt, Base, Length>();
+            UInt output = 0;
+            for (std::size_t pos = 0; pos < Length; ++pos) {
+                const UInt digit = inverse[static_cast<unsigned char>(input_string[pos])];
+                output = static_cast<UInt>(output + digit * place_values[pos]);
+            }
+            return output;
+        }
+
+        /**
+         * @brief Decode a variable number of characters (at most the encoded length) without validation
+         */
+        template <uint32_t Base, typename UInt>
+        constexpr UInt decode_digits_n(const char* input_string, std::size_t length, const uint8_t* inverse) {
+            UInt output = 0;
+            for (std::size_t pos = 0; pos < length; ++pos) {
+                output = static_cast<UInt>(output * Base + inverse[static_cast<unsigned char>(input_string[pos])]);
+            }
+            return output;
+        }
+
+        /**
+         * @brief Compare a full-length string's digits against the digits of the maximum value
+         * @return True if the string decodes to a value no larger than the maximum
+         */
+        template <std::size_t Length>
+        constexpr bool digits_within_bounds(const char* input_string, const uint8_t* inverse,
+                                            const std::array<uint8_t, Length>& max_digits) {
+            for (std::size_t pos = 0; pos < Length; ++pos) {
+                const uint8_t digit = inverse[static_cast<unsigned char>(input_string[pos])];
+                if (digit != max_digits[pos]) {
+                    return digit < max_digits[pos];
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Compare a string of at most Length digits, right-aligned, against the digits of the maximum value
+         * @return True if the string decodes to a value no larger than the maximum
+         */
+        template <std::size_t Length>
+        constexpr bool digits_within_bounds_n(const char* input_string, std::size_t length, const uint8_t* inverse,
+                                              const std::array<uint8_t, Length>& max_digits) {
+            const std::size_t offset = Length - length;
+            for (std::size_t pos = 0; pos < offset; ++pos) {
+                if (max_digits[pos] != 0) {
+                    return true;
+                }
+            }
+            for (std::size_t pos = 0; pos < length; ++pos) {
+                const uint8_t digit = inverse[static_cast<unsigned char>(input_string[pos])];
+                if (digit != max_digits[offset + pos]) {
+                    return digit < max_digits[offset + pos];
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Encode Length digits and move the significant ones to the start of the output
+         * @note The output string is null-terminated; zero encodes to an empty string
+         * @param output_string Destination (at least Length + 1 bytes)
+         */
+        template <std::size_t Length, uint32_t Base, typename UInt>
+        constexpr void encode_digits_unpadded(UInt input, const char* symbols, const char* pairs, char* output_string) {
+            char padded[Length + 1] = {};
+            encode_digits<Length, Base>(input, symbols, pairs, padded);
+
+            std::size_t padding = 0;
+            while (padding < Length && padded[padding] == symbols[0]) {
+                ++padding;
+            }
+            for (std::size_t pos = padding; pos < Length; ++pos) {
+                output_string[pos - padding] = padded[pos];
+            }
+            output_string[Length - padding] = '\0';
+        }
+
+        /**
+         * @brief Validate a null-terminated string against an inverse table
+         * @return The length of the valid string, 0 if the string is invalid
+         */
+        constexpr std::size_t validate_symbols(const char* input_string, const uint8_t* inverse) {
+            const char* const start = input_string;
+            while (*input_string != '\0') {
+                if (inverse[static_cast<unsigned char>(*input_string++)] == INVALID_DIGIT) {
+                    return 0;
+                }
+            }
+            return static_cast<std::size_t>(input_string - start);
+        }
+
+        /**
+         * @brief Decode a padded or unpadded null-terminated string with validation
+         * @throws std::invalid_argument if the string is invalid
+         * @throws std::out_of_range if the string exceeds max_digits
+         */
+        template <std::size_t Length, uint32_t Base, typename UInt>
+        constexpr UInt decode_checked(const char* input_string, const uint8_t* inverse,
+                                      const std::array<uint8_t, Length>& max_digits) {
+            if (input_string == nullptr) {
+                throw_null_string();
+            }
+
+            const std::size_t length = validate_symbols(input_string, inverse);
+            if (length == 0 || length > Length) {
+                throw_invalid_length(length);
+            }
+
+            // Strings shorter than the most significant non-zero digit of the maximum are always in range
+            if (!digits_within_bounds_n(input_string, length, inverse, max_digits)) {
+                throw_out_of_range("HHC string exceeds codec bounds");
+            }
+            return decode_digits_n<Base, UInt>(input_string, length, inverse);
+        }
+
+        /**
+         * @brief Decode a padded or unpadded string of known length (no terminator needed) with validation
+         * @throws std::invalid_argument if the string is empty, too long or contains a character outside the alphabet
+         * @throws std::out_of_range if the string exceeds max_digits
+         */
+        template <std::size_t Length, uint32_t Base, typename UInt>
+        constexpr UInt decode_checked_n(const char* input_string, std::size_t length, const uint8_t* inverse,
+                                        const std::array<uint8_t, Length>& max_digits) {
+            if (length == 0 || length > Length) {
+                throw_invalid_length(length);
+            }
+            if (input_string == nullptr) {
+                throw_null_string();
+            }
+            for (std::size_t pos = 0; pos < length; ++pos) {
+                if (inverse[static_cast<unsigned char>(input_string[pos])] == INVALID_DIGIT) {
+                    throw_invalid_character();
+                }
+            }
+            if (!digits_within_bounds_n(input_string, length, inverse, max_digits)) {
+                throw_out_of_range("HHC string exceeds codec bounds");
+            }
+            return decode_digits_n<Base, UInt>(input_string, length, inverse);
+        }
+
+        /**
+         * @brief Decode one fixed-width record with validation
+         * @throws std::invalid_argument if the record contains a character outside the alphabet
+         * @throws std::out_of_range if the record exceeds max_digits
+         */
+        template <std::size_t Length, uint32_t Base, typename UInt>
+        inline UInt decode_record_checked(const char* record, const uint8_t* inverse,
+                                          const std::array<uint8_t, Length>& max_digits) {
+            // Invalid digits have the high bit set, so one OR-reduction validates the whole record
+            uint8_t combined = 0;
+            for (std::size_t pos = 0; pos < Length; ++pos) {
+                combined |= inverse[static_cast<unsigned char>(record[pos])];
+            }
+            if ((combined & 0x80U) != 0) {
+                throw_invalid_character();
+            }
+            if (!digits_within_bounds(record, inverse, max_digits)) {
+                throw_out_of_range("HHC string exceeds codec bounds");
+            }
+            return decode_digits<Length, Base, UInt>(record, inverse);
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief The default HHC (base66) alphabet
+     */
+    struct hhc_alphabet {
+        static constexpr std::array<char, BASE> symbols = ALPHABET;
+    };
+
+    /**
+     * @brief Base62 alphabet (digits, upper case, lower case; ASCII ordered)
+     */
+    struct base62_alphabet {
+        static constexpr auto symbols = detail::make_symbols(
+            "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz");
+    };
+
+    /**
+     * @brief Base58 alphabet as used by Bitcoin (no 0, O, I or l)
+     */
+    struct base58_alphabet {
+        static constexpr auto symbols = detail::make_symbols(
+            "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz");
+    };
+
+    /**
+     * @brief Base36 alphabet (digits and lower case letters)
+     */
+    struct base36_alphabet {
+        static constexpr auto symbols = detail::make_symbols("0123456789abcdefghijklmnopqrstuvwxyz");
+    };
+
+    /**
+     * @brief Fixed-width codec over an arbitrary alphabet and unsigned integer type
+     *
+     * Everything that depends on the alphabet and the integer width (encoded length, maximum
+     * string, inverse and pair tables, place values) is derived at compile time, so every
+     * instantiation runs the same kernels as the built-in HHC functions.
+     *
+     * Example:
+     *   using base62_64 = hhc::basic_codec<hhc::base62_alphabet, uint64_t>;
+     *   char buffer[base62_64::STRING_LENGTH];
+     *   base62_64::encode_padded(42, buffer);
+     *
+     * @tparam Alphabet A type exposing `static constexpr std::array<char, N> symbols`
+     * @tparam UInt The unsigned integer type to encode
+     */
+    template <typename Alphabet, typename UInt>
+    class basic_codec {
+        static_assert(std::is_integral_v<UInt> && std::is_unsigned_v<UInt> && !std::is_same_v<UInt, bool>,
+                      "basic_codec requires an unsigned integer type");
+
+        using tables = detail::alphabet_tables<Alphabet>;
+
+    public:
+        using alphabet_type = Alphabet;
+        using value_type = UInt;
+
+        static constexpr uint32_t BASE = tables::BASE;
+        static constexpr const auto& ALPHABET = Alphabet::symbols;
+        static constexpr std::size_t ENCODED_LENGTH = detail::max_digits<UInt, BASE>();
+        static constexpr std::size_t STRING_LENGTH = detail::string_length_for(ENCODED_LENGTH);
+
+        /// Digit values of the largest encodable value
+        static constexpr std::array<uint8_t, ENCODED_LENGTH> MAX_DIGITS = [] {
+            std::array<uint8_t, ENCODED_LENGTH> digits{};
+            UInt value = std::numeric_limits<UInt>::max();
+            for (std::size_t pos = ENCODED_LENGTH; pos > 0; --pos) {
+                digits[pos - 1] = static_cast<uint8_t>(value % BASE);
+                value /= BASE;
+            }
+            return digits;
+        }();
+
+        /// Padded encoding of the largest encodable value (null-terminated)
+        static constexpr std::array<char, ENCODED_LENGTH + 1> MAX_STRING = [] {
+            std::array<char, ENCODED_LENGTH + 1> max_string{};
+            for (std::size_t pos = 0; pos < ENCODED_LENGTH; ++pos) {
+                max_string[pos] = Alphabet::symbols[MAX_DIGITS[pos]];
+            }
+            return max_string;
+        }();
+
+        /**
+         * @brief Encode a value into an ENCODED_LENGTH-character string
+         * @note The output string is not null-terminated
+         * @param input The value to encode
+         * @param output_string The output string (at least ENCODED_LENGTH bytes)
+         */
+        static constexpr void encode_padded(UInt input, char* output_string) {
+            HHC_ASSERT(output_string != nullptr);
+            detail::encode_digits<ENCODED_LENGTH, BASE>(input, ALPHABET.data(), tables::PAIRS.data(), output_string);
+        }
+
+        /**
+         * @brief Encode a value without leading padding symbols
+         * @note The output string is null-terminated; zero encodes to an empty string
+         * @param input The value to encode
+         * @param output_string The output string (at least STRING_LENGTH bytes)
+         */
+        static constexpr void encode_unpadded(UInt input, char* output_string) {
+            HHC_ASSERT(output_string != nullptr);
+            detail::encode_digits_unpadded<ENCODED_LENGTH, BASE>(input, ALPHABET.data(), tables::PAIRS.data(), output_string);
+        }
+
+        /**
+         * @brief Decode an ENCODED_LENGTH-character string without validation
+         * @param input_string The input string to decode
+         * @return The decoded value
+         */
+        static constexpr UInt decode_unsafe(const char* input_string) {
+            HHC_ASSERT(input_string != nullptr);
+            return detail::decode_digits<ENCODED_LENGTH, BASE, UInt>(input_string, tables::INVERSE.data());
+        }
+
+        /**
+         * @brief Validate a null-terminated string against the alphabet
+         * @param input_string The input string to validate
+         * @return The length of the valid string, 0 if the string is invalid
+         */
+        static constexpr std::size_t validate(const char* input_string) {
+            HHC_ASSERT(input_string != nullptr);
+            return detail::validate_symbols(input_string, tables::INVERSE.data());
+        }
+
+        /**
+         * @brief Decode a padded or unpadded null-terminated string
+         * @param input_string The input string to decode
+         * @return The decoded value
+         * @throws std::invalid_argument if the string is invalid
+         * @throws std::out_of_range if the string exceeds the bounds of UInt
+         */
+        static constexpr UInt decode(const char* input_string) {
+            return detail::decode_checked<ENCODED_LENGTH, BASE, UInt>(input_string, tables::INVERSE.data(), MAX_DIGITS);
+        }
+
+        /**
+         * @brief Decode a padded or unpadded string of known length (it need not be null-terminated)
+         * @param input_string The input string to decode
+         * @param length The number of characters to decode
+         * @return The decoded value
+         * @throws std::invalid_argument if the string is invalid
+         * @throws std::out_of_range if the string exceeds the bounds of UInt
+         */
+        static constexpr UInt decode(const char* input_string, std::size_t length) {
+            return detail::decode_checked_n<ENCODED_LENGTH, BASE, UInt>(input_string, length, tables::INVERSE.data(),
+                                                                        MAX_DIGITS);
+        }
+
+        /**
+         * @brief Encode count values into back-to-back ENCODED_LENGTH-character records
+         * @note The output is not null-terminated
+         * @param inputs The values to encode
+         * @param count The number of values
+         * @param output The output buffer (at least count * ENCODED_LENGTH bytes)
+         */
+        static void encode_padded_batch(const UInt* inputs, std::size_t count, char* output) {
+            HHC_ASSERT(count == 0 || (inputs != nullptr && output != nullptr));
+            for (std::size_t i = 0; i < count; ++i) {
+                detail::encode_digits<ENCODED_LENGTH, BASE>(inputs[i], ALPHABET.data(), tables::PAIRS.data(),
+                                                            output + i * ENCODED_LENGTH);
+            }
+        }
+
+        /**
+         * @brief Decode count back-to-back ENCODED_LENGTH-character records without validation
+         * @param input The encoded records
+         * @param count The number of records
+         * @param outputs The decoded values (at least count entries)
+         */
+        static void decode_unsafe_batch(const char* input, std::size_t count, UInt* outputs) {
+            HHC_ASSERT(count == 0 || (input != nullptr && outputs != nullptr));
+            for (std::size_t i = 0; i < count; ++i) {
+                outputs[i] = detail::decode_digits<ENCODED_LENGTH, BASE, UInt>(input + i * ENCODED_LENGTH,
+                                                                               tables::INVERSE.data());
+            }
+        }
+
+        /**
+         * @brief Decode count back-to-back ENCODED_LENGTH-character records with validation
+         * @param input The encoded records
+         * @param count The number of records
+         * @param outputs The decoded values (at least count entries)
+         * @throws std::invalid_argument if a record contains a character outside the alphabet
+         * @throws std::out_of_range if a record exceeds the bounds of UInt
+         */
+        static void decode_batch(const char* input, std::size_t count, UInt* outputs) {
+            HHC_ASSERT(count == 0 || (input != nullptr && outputs != nullptr));
+            for (std::size_t i = 0; i < count; ++i) {
+                outputs[i] = detail::decode_record_checked<ENCODED_LENGTH, BASE, UInt>(
+                    input + i * ENCODED_LENGTH, tables::INVERSE.data(), MAX_DIGITS);
+            }
+        }
+    };
+
+    /// The built-in 32-bit HHC codec (6 characters)
+    using hhc32_codec = basic_codec<hhc_alphabet, uint32_t>;
+    /// The built-in 64-bit HHC codec (11 characters)
+    using hhc64_codec = basic_codec<hhc_alphabet, uint64_t>;
+
+    static_assert(hhc32_codec::ENCODED_LENGTH == HHC_32BIT_ENCODED_LENGTH);
+    static_assert(hhc64_codec::ENCODED_LENGTH == HHC_64BIT_ENCODED_LENGTH);
+    static_assert(hhc32_codec::STRING_LENGTH == HHC_32BIT_STRING_LENGTH);
+    static_assert(hhc64_codec::STRING_LENGTH == HHC_64BIT_STRING_LENGTH);
+
+} // namespace hhc
+
+#endif // HHC_CODEC_HPP
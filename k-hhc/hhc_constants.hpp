@@ -35,6 +35,9 @@ namespace hhc {
     constexpr size_t HHC_64BIT_ENCODED_LENGTH = 11;
     constexpr auto HHC_32BIT_ENCODED_MAX_STRING = "1QLCp1";
     constexpr auto HHC_64BIT_ENCODED_MAX_STRING = "9lH9ebONzYD";
+    constexpr size_t HHC_128BIT_STRING_LENGTH = 32;
+    constexpr size_t HHC_128BIT_ENCODED_LENGTH = 22;
+    constexpr auto HHC_128BIT_ENCODED_MAX_STRING = "04Ki.mH9tLeAcRProAhwVs";
 } // namespace hhc
 
 #endif
\ No newline at end of file
@@ -0,0 +1,381 @@
+#ifndef HHC_COROUTINE_HPP
+#define HHC_COROUTINE_HPP
+
+#if defined(__has_include)
+#  if __has_include(<version>)
+#    include <version>
+#  endif
+#endif
+
+#if defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine) && defined(__cpp_lib_span) && defined(__cpp_concepts)
+
+#include <algorithm>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "hhc_constants.hpp"
+#include "hhc_codec.hpp"
+
+namespace hhc::co {
+
+    /**
+     * @brief Minimal synchronous generator: a lazily evaluated input range of `const T&`
+     *
+     * The yielded reference is valid until the iterator is advanced.
+     */
+    template <typename T>
+    class generator {
+    public:
+        struct promise_type {
+            const T* value_ = nullptr;
+            std::exception_ptr exception_;
+
+            generator get_return_object() { return generator(handle_type::from_promise(*this)); }
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            std::suspend_always final_suspend() const noexcept { return {}; }
+            std::suspend_always yield_value(const T& value) noexcept {
+                value_ = std::addressof(value);
+                return {};
+            }
+            void return_void() const noexcept {}
+            void unhandled_exception() { exception_ = std::current_exception(); }
+        };
+
+        using handle_type = std::coroutine_handle<promise_type>;
+
+        class iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using reference = const T&;
+            using pointer = const T*;
+
+            iterator() = default;
+            explicit iterator(handle_type handle) : handle_(handle) {}
+
+            reference operator*() const { return *handle_.promise().value_; }
+            pointer operator->() const { return handle_.promise().value_; }
+
+            iterator& operator++() {
+                advance(handle_);
+                return *this;
+            }
+
+            void operator++(int) { ++*this; }
+
+            friend bool operator==(const iterator& it, std::default_sentinel_t) noexcept {
+                return !it.handle_ || it.handle_.done();
+            }
+
+        private:
+            handle_type handle_;
+        };
+
+        generator(generator&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+
+        generator& operator=(generator&& other) noexcept {
+            if (this != &other) {
+                if (handle_) {
+                    handle_.destroy();
+                }
+                handle_ = std::exchange(other.handle_, {});
+            }
+            return *this;
+        }
+
+        ~generator() {
+            if (handle_) {
+                handle_.destroy();
+            }
+        }
+
+        /// Runs the body up to the first co_yield; call once
+        iterator begin() {
+            advance(handle_);
+            return iterator(handle_);
+        }
+
+        std::default_sentinel_t end() const noexcept { return {}; }
+
+    private:
+        explicit generator(handle_type handle) : handle_(handle) {}
+
+        static void advance(handle_type handle) {
+            handle.resume();
+            if (handle.promise().exception_) {
+                std::rethrow_exception(std::exchange(handle.promise().exception_, nullptr));
+            }
+        }
+
+        handle_type handle_;
+    };
+
+    /**
+     * @brief Minimal asynchronous generator whose body may co_await (e.g. a socket read)
+     *
+     * Consumed from another coroutine with `while (const T* chunk = co_await gen.next()) { ... }`;
+     * next() yields nullptr once the body returns. Control passes between consumer and producer by
+     * symmetric transfer, so a chain of generators never grows the stack. The yielded value is
+     * valid until the next call to next().
+     */
+    template <typename T>
+    class async_generator {
+    public:
+        struct promise_type;
+        using handle_type = std::coroutine_handle<promise_type>;
+
+        /// Hands control back to whichever coroutine is awaiting next()
+        struct resume_consumer {
+            bool await_ready() const noexcept { return false; }
+            std::coroutine_handle<> await_suspend(handle_type handle) const noexcept {
+                return handle.promise().consumer_;
+            }
+            void await_resume() const noexcept {}
+        };
+
+        struct promise_type {
+            const T* value_ = nullptr;
+            std::exception_ptr exception_;
+            std::coroutine_handle<> consumer_ = std::noop_coroutine();
+
+            async_generator get_return_object() { return async_generator(handle_type::from_promise(*this)); }
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            resume_consumer final_suspend() const noexcept { return {}; }
+            resume_consumer yield_value(const T& value) noexcept {
+                value_ = std::addressof(value);
+                return {};
+            }
+            void return_void() noexcept { value_ = nullptr; }
+            void unhandled_exception() {
+                exception_ = std::current_exception();
+                value_ = nullptr;
+            }
+        };
+
+        /// Awaitable returned by next(): resumes the producer until its next co_yield or return
+        class next_awaiter {
+        public:
+            explicit next_awaiter(handle_type handle) : handle_(handle) {}
+
+            bool await_ready() const noexcept { return !handle_ || handle_.done(); }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> consumer) const noexcept {
+                handle_.promise().consumer_ = consumer;
+                return handle_;
+            }
+
+            const T* await_resume() const {
+                if (!handle_) {
+                    return nullptr;
+                }
+                auto& promise = handle_.promise();
+                if (promise.exception_) {
+                    std::rethrow_exception(std::exchange(promise.exception_, nullptr));
+                }
+                return handle_.done() ? nullptr : promise.value_;
+            }
+
+        private:
+            handle_type handle_;
+        };
+
+        async_generator(async_generator&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+
+        async_generator& operator=(async_generator&& other) noexcept {
+            if (this != &other) {
+                if (handle_) {
+                    handle_.destroy();
+                }
+                handle_ = std::exchange(other.handle_, {});
+            }
+            return *this;
+        }
+
+        ~async_generator() {
+            if (handle_) {
+                handle_.destroy();
+            }
+        }
+
+        next_awaiter next() const noexcept { return next_awaiter(handle_); }
+
+    private:
+        explicit async_generator(handle_type handle) : handle_(handle) {}
+
+        handle_type handle_;
+    };
+
+    /**
+     * @brief A source whose chunks are pulled with `co_await source.next()`, which yields something
+     *        pointer-like (T*, std::optional<T>) that is empty at the end of the stream
+     */
+    template <typename Source>
+    concept async_chunk_source = requires(Source& source) { source.next(); };
+
+    namespace detail {
+
+        /**
+         * @brief Encode one contiguous chunk of values into back-to-back padded records
+         */
+        template <typename Codec, typename Chunk>
+        std::string_view encode_chunk(const Chunk& chunk, std::string& buffer) {
+            using UInt = typename Codec::value_type;
+            static_assert(std::is_same_v<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(chunk))>>, UInt>,
+                          "encode_stream chunks must be contiguous ranges of the codec's integer type");
+            const std::size_t count = std::size(chunk);
+            buffer.resize(count * Codec::ENCODED_LENGTH);
+            Codec::encode_padded_batch(std::data(chunk), count, buffer.data());
+            return buffer;
+        }
+
+        /**
+         * @brief Decodes chunks of back-to-back padded records, carrying records split across chunks
+         */
+        template <typename Codec>
+        class chunk_decoder {
+            using UInt = typename Codec::value_type;
+            static constexpr std::size_t LENGTH = Codec::ENCODED_LENGTH;
+
+        public:
+            std::span<const UInt> decode(std::string_view chunk) {
+                values_.clear();
+                if (!pending_.empty()) {
+                    const std::size_t take = std::min(LENGTH - pending_.size(), chunk.size());
+                    pending_.append(chunk.substr(0, take));
+                    chunk.remove_prefix(take);
+                    if (pending_.size() < LENGTH) {
+                        return values_;
+                    }
+                    values_.push_back(0);
+                    Codec::decode_batch(pending_.data(), 1, values_.data());
+                    pending_.clear();
+                }
+
+                const std::size_t count = chunk.size() / LENGTH;
+                const std::size_t offset = values_.size();
+                values_.resize(offset + count);
+                Codec::decode_batch(chunk.data(), count, values_.data() + offset);
+                pending_.assign(chunk.substr(count * LENGTH));
+                return values_;
+            }
+
+            /// @throws std::invalid_argument if the stream ended inside a record
+            void finish() const {
+                if (!pending_.empty()) {
+                    hhc::detail::throw_invalid_length(pending_.size());
+                }
+            }
+
+        private:
+            std::vector<UInt> values_;
+            std::string pending_;
+        };
+
+        template <typename Chunk>
+        std::string_view chunk_text(const Chunk& chunk) {
+            return std::string_view(std::data(chunk), std::size(chunk));
+        }
+
+        template <typename Codec, typename Source>
+        generator<std::string_view> encode_stream_sync(Source source) {
+            std::string buffer;
+            for (const auto& chunk : source) {
+                if (std::size(chunk) != 0) {
+                    co_yield encode_chunk<Codec>(chunk, buffer);
+                }
+            }
+        }
+
+        template <typename Codec, typename Source>
+        async_generator<std::string_view> encode_stream_async(Source source) {
+            std::string buffer;
+            while (auto chunk = co_await source.next()) {
+                if (std::size(*chunk) != 0) {
+                    co_yield encode_chunk<Codec>(*chunk, buffer);
+                }
+            }
+        }
+
+        template <typename Codec, typename Source>
+        generator<std::span<const typename Codec::value_type>> decode_stream_sync(Source source) {
+            chunk_decoder<Codec> decoder;
+            for (const auto& chunk : source) {
+                const auto values = decoder.decode(chunk_text(chunk));
+                if (!values.empty()) {
+                    co_yield values;
+                }
+            }
+            decoder.finish();
+        }
+
+        template <typename Codec, typename Source>
+        async_generator<std::span<const typename Codec::value_type>> decode_stream_async(Source source) {
+            chunk_decoder<Codec> decoder;
+            while (auto chunk = co_await source.next()) {
+                const auto values = decoder.decode(chunk_text(*chunk));
+                if (!values.empty()) {
+                    co_yield values;
+                }
+            }
+            decoder.finish();
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Encode a stream of chunks of values, yielding each chunk as back-to-back padded records
+     *
+     * Each chunk (any contiguous range of Codec::value_type) goes through encode_padded_batch in one
+     * call, so the generator suspends once per chunk rather than once per value. The yielded
+     * std::string_view points at a buffer reused between chunks.
+     *
+     * If source is an async_chunk_source the result is an async_generator and the source is
+     * awaited between chunks; otherwise source is iterated as a range of chunks and the result is
+     * a generator. An lvalue source is referenced, an rvalue source is moved into the coroutine.
+     *
+     * @tparam Codec A basic_codec instantiation (defaults to 64-bit HHC)
+     */
+    template <typename Codec = hhc64_codec, typename Source>
+    auto encode_stream(Source&& source) {
+        if constexpr (async_chunk_source<std::remove_reference_t<Source>>) {
+            return detail::encode_stream_async<Codec, Source>(std::forward<Source>(source));
+        } else {
+            return detail::encode_stream_sync<Codec, Source>(std::forward<Source>(source));
+        }
+    }
+
+    /**
+     * @brief Decode a stream of character chunks holding back-to-back padded records, yielding each chunk's values
+     *
+     * Chunks need not be record aligned: a record split across chunks is decoded once its last
+     * character arrives. The yielded std::span points at a buffer reused between chunks.
+     *
+     * @tparam Codec A basic_codec instantiation (defaults to 64-bit HHC)
+     * @throws std::invalid_argument if a record contains a character outside the alphabet, or the
+     *         stream ends inside a record
+     * @throws std::out_of_range if a record exceeds the bounds of the codec
+     */
+    template <typename Codec = hhc64_codec, typename Source>
+    auto decode_stream(Source&& source) {
+        if constexpr (async_chunk_source<std::remove_reference_t<Source>>) {
+            return detail::decode_stream_async<Codec, Source>(std::forward<Source>(source));
+        } else {
+            return detail::decode_stream_sync<Codec, Source>(std::forward<Source>(source));
+        }
+    }
+
+} // namespace hhc::co
+
+#endif // coroutine support
+
+#endif // HHC_COROUTINE_HPP
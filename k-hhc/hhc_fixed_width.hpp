@@ -0,0 +1,160 @@
+#ifndef HHC_FIXED_WIDTH_HPP
+#define HHC_FIXED_WIDTH_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "hhc_constants.hpp"
+#include "hhc_assert.hpp"
+#include "hhc_codec.hpp"
+
+namespace hhc {
+
+    namespace detail {
+
+        /**
+         * @brief Smallest standard unsigned integer type holding Bits bits
+         */
+        template <unsigned Bits>
+        using uint_for_bits_t = std::conditional_t<(Bits <= 8), uint8_t,
+                                std::conditional_t<(Bits <= 16), uint16_t,
+                                std::conditional_t<(Bits <= 32), uint32_t, uint64_t>>>;
+
+        /**
+         * @brief Largest value representable in Bits bits
+         */
+        template <unsigned Bits>
+        constexpr uint64_t max_value_for_bits() {
+            return Bits == 64 ? std::numeric_limits<uint64_t>::max() : (uint64_t{1} << Bits) - 1;
+        }
+
+        /**
+         * @brief Number of HHC digits needed for every Bits-bit value
+         */
+        template <unsigned Bits>
+        constexpr std::size_t natural_width_for_bits() {
+            uint64_t value = max_value_for_bits<Bits>();
+            std::size_t digits = 0;
+            do {
+                value /= BASE;
+                ++digits;
+            } while (value != 0);
+            return digits;
+        }
+
+        /**
+         * @brief Largest value representable in Width HHC digits, saturated at the 64-bit maximum
+         */
+        constexpr uint64_t max_value_for_width(std::size_t width) {
+            uint64_t value = 1;
+            for (std::size_t i = 0; i < width; ++i) {
+                if (value > std::numeric_limits<uint64_t>::max() / BASE) {
+                    return std::numeric_limits<uint64_t>::max();
+                }
+                value *= BASE;
+            }
+            return value - 1;
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Compile-time constants for a Bits-bit value encoded into Width HHC characters
+     *
+     * Width defaults to the number of characters needed for every Bits-bit value (2 for 8-bit,
+     * 3 for 16-bit, 4 for 24-bit, 6 for 32-bit, 7 for 40-bit, 8 for 48-bit, 11 for 64-bit).
+     * A narrower Width restricts the encodable range to values below 66^Width.
+     *
+     * @tparam Bits The integer width in bits (a multiple of 8, at most 64)
+     * @tparam Width The number of encoded characters
+     */
+    template <unsigned Bits, std::size_t Width = detail::natural_width_for_bits<Bits>()>
+    struct fixed_width {
+        static_assert(Bits >= 8 && Bits <= 64 && Bits % 8 == 0, "Bits must be a multiple of 8 between 8 and 64");
+        static_assert(Width >= 1, "Width must be at least one character");
+
+        using value_type = detail::uint_for_bits_t<Bits>;
+
+        static constexpr std::size_t ENCODED_LENGTH = Width;
+        static constexpr std::size_t STRING_LENGTH = detail::string_length_for(Width);
+
+        /// Largest value accepted by encode and produced by decode
+        static constexpr value_type MAX_VALUE = static_cast<value_type>(
+            detail::max_value_for_bits<Bits>() < detail::max_value_for_width(Width)
+                ? detail::max_value_for_bits<Bits>()
+                : detail::max_value_for_width(Width));
+
+        /// Digit values of MAX_VALUE
+        static constexpr std::array<uint8_t, Width> MAX_DIGITS = [] {
+            std::array<uint8_t, Width> digits{};
+            uint64_t value = MAX_VALUE;
+            for (std::size_t pos = Width; pos > 0; --pos) {
+                digits[pos - 1] = static_cast<uint8_t>(value % BASE);
+                value /= BASE;
+            }
+            return digits;
+        }();
+
+        /// Padded encoding of MAX_VALUE (null-terminated)
+        static constexpr std::array<char, Width + 1> MAX_STRING = [] {
+            std::array<char, Width + 1> max_string{};
+            for (std::size_t pos = 0; pos < Width; ++pos) {
+                max_string[pos] = ALPHABET[MAX_DIGITS[pos]];
+            }
+            return max_string;
+        }();
+    };
+
+    /**
+     * @brief Encode a Bits-bit integer into a Width-character string
+     * @note The output string is not null-terminated
+     * @note The input must not exceed fixed_width<Bits, Width>::MAX_VALUE
+     * @param input The value to encode
+     * @param output_string The output string (at least Width bytes)
+     */
+    template <unsigned Bits, std::size_t Width = detail::natural_width_for_bits<Bits>()>
+    constexpr void encode(detail::uint_for_bits_t<Bits> input, char* output_string) {
+        using traits = fixed_width<Bits, Width>;
+        HHC_ASSERT(output_string != nullptr);
+        if constexpr (traits::MAX_VALUE < std::numeric_limits<typename traits::value_type>::max()) {
+            HHC_ASSERT(input <= traits::MAX_VALUE);
+        }
+        detail::encode_digits<Width, BASE>(input, ALPHABET.data(),
+                                           detail::alphabet_tables<hhc_alphabet>::PAIRS.data(), output_string);
+    }
+
+    /**
+     * @brief Decode a Width-character string without validation
+     * @param input_string The input string to decode
+     * @return The decoded value
+     */
+    template <unsigned Bits, std::size_t Width = detail::natural_width_for_bits<Bits>()>
+    constexpr detail::uint_for_bits_t<Bits> decode_unsafe(const char* input_string) {
+        HHC_ASSERT(input_string != nullptr);
+        using value_type = typename fixed_width<Bits, Width>::value_type;
+        return detail::decode_digits<Width, BASE, value_type>(input_string,
+                                                             detail::alphabet_tables<hhc_alphabet>::INVERSE.data());
+    }
+
+    /**
+     * @brief Decode a padded or unpadded string of at most Width characters
+     * @param input_string The input string to decode
+     * @return The decoded value
+     * @throws std::invalid_argument if the string is invalid
+     * @throws std::out_of_range if the string exceeds fixed_width<Bits, Width>::MAX_VALUE
+     */
+    template <unsigned Bits, std::size_t Width = detail::natural_width_for_bits<Bits>()>
+    constexpr detail::uint_for_bits_t<Bits> decode(const char* input_string) {
+        using traits = fixed_width<Bits, Width>;
+        return detail::decode_checked<Width, BASE, typename traits::value_type>(
+            input_string, detail::alphabet_tables<hhc_alphabet>::INVERSE.data(), traits::MAX_DIGITS);
+    }
+
+    static_assert(fixed_width<32>::ENCODED_LENGTH == HHC_32BIT_ENCODED_LENGTH);
+    static_assert(fixed_width<64>::ENCODED_LENGTH == HHC_64BIT_ENCODED_LENGTH);
+
+} // namespace hhc
+
+#endif // HHC_FIXED_WIDTH_HPP
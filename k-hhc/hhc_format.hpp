@@ -0,0 +1,241 @@
+#ifndef HHC_FORMAT_HPP
+#define HHC_FORMAT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "hhc_constants.hpp"
+#include "hhc_codec.hpp"
+
+#if defined(__has_include)
+#  if __has_include(<version>)
+#    include <version>
+#  endif
+#endif
+
+#if defined(__cpp_lib_format)
+#  include <format>
+#endif
+
+#if defined(HHC_ENABLE_FMT)
+#  include <fmt/format.h>
+#endif
+
+namespace hhc {
+
+    /**
+     * @brief A 32-bit value to be formatted as HHC (see as_hhc)
+     */
+    struct encoded32 {
+        uint32_t value;
+    };
+
+    /**
+     * @brief A 64-bit value to be formatted as HHC (see as_hhc)
+     */
+    struct encoded64 {
+        uint64_t value;
+    };
+
+    /**
+     * @brief Wrap an unsigned integer so std::format / fmt::format print it as HHC
+     *
+     * Values of 32 bits or fewer become encoded32 (6 characters padded), wider values encoded64
+     * (11 characters padded).
+     *
+     * Format spec: `{}` or `{:p}` padded, `{:u}` unpadded, `{:u8}` / `{:8}` at least 8 characters
+     * (filled with the zero symbol '-', so the value is unchanged).
+     */
+    template <typename UInt>
+    constexpr auto as_hhc(UInt value) {
+        static_assert(std::is_integral_v<UInt> && std::is_unsigned_v<UInt> && !std::is_same_v<UInt, bool>,
+                      "as_hhc requires an unsigned integer type");
+        if constexpr (sizeof(UInt) <= sizeof(uint32_t)) {
+            return encoded32{static_cast<uint32_t>(value)};
+        } else {
+            return encoded64{static_cast<uint64_t>(value)};
+        }
+    }
+
+    namespace detail {
+
+        /**
+         * @brief Parsed HHC format spec
+         */
+        struct format_spec {
+            bool padded = true;     ///< Emit the full encoded length ('p', the default) or only significant digits ('u')
+            std::size_t width = 0;  ///< Minimum number of characters, filled with the zero symbol
+        };
+
+        /**
+         * @brief Parse `[p|u][width]` up to the closing brace
+         * @param it The first spec character; advanced past the parsed characters
+         * @return nullptr on success, otherwise a description of the error
+         */
+        template <typename CharIt>
+        constexpr const char* parse_format_spec(CharIt& it, CharIt end, format_spec& spec) {
+            bool explicit_flag = false;
+            if (it != end && (*it == 'p' || *it == 'u')) {
+                spec.padded = *it == 'p';
+                explicit_flag = true;
+                ++it;
+            }
+            if (it != end && *it >= '0' && *it <= '9') {
+                if (!explicit_flag) {
+                    spec.padded = false;  // a bare width replaces the natural padding
+                }
+                std::size_t width = 0;
+                while (it != end && *it >= '0' && *it <= '9') {
+                    width = width * 10 + static_cast<std::size_t>(*it - '0');
+                    if (width > 64) {
+                        return "HHC format width must not exceed 64";
+                    }
+                    ++it;
+                }
+                spec.width = width;
+            }
+            if (it != end && *it != '}') {
+                return "Invalid HHC format spec (expected [p|u][width])";
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Write value straight to an output iterator according to spec
+         */
+        template <std::size_t Length, typename UInt, typename OutputIt>
+        constexpr OutputIt format_encoded(UInt value, const format_spec& spec, OutputIt out) {
+            char digits[Length] = {};
+            encode_digits<Length, BASE>(value, ALPHABET.data(), alphabet_tables<hhc_alphabet>::PAIRS.data(), digits);
+
+            std::size_t first = 0;
+            if (!spec.padded) {
+                while (first < Length && digits[first] == ALPHABET[0]) {
+                    ++first;
+                }
+            }
+            for (std::size_t fill = Length - first; fill < spec.width; ++fill) {
+                *out++ = ALPHABET[0];
+            }
+            for (std::size_t pos = first; pos < Length; ++pos) {
+                *out++ = digits[pos];
+            }
+            return out;
+        }
+
+        template <typename OutputIt>
+        constexpr OutputIt format_encoded(encoded32 encoded, const format_spec& spec, OutputIt out) {
+            return format_encoded<HHC_32BIT_ENCODED_LENGTH>(encoded.value, spec, out);
+        }
+
+        template <typename OutputIt>
+        constexpr OutputIt format_encoded(encoded64 encoded, const format_spec& spec, OutputIt out) {
+            return format_encoded<HHC_64BIT_ENCODED_LENGTH>(encoded.value, spec, out);
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Write an HHC-wrapped value to an output iterator without any intermediate string
+     *
+     * The same path the std::format and fmt formatters use; usable without either library.
+     *
+     * @param out The output iterator
+     * @param encoded The wrapped value (see as_hhc)
+     * @param padded Emit the full encoded length instead of only the significant digits
+     * @param width Minimum number of characters, filled with the zero symbol
+     * @return The iterator past the last character written
+     */
+    template <typename OutputIt, typename Encoded>
+    constexpr OutputIt format_to(OutputIt out, Encoded encoded, bool padded = true, std::size_t width = 0) {
+        detail::format_spec spec;
+        spec.padded = padded;
+        spec.width = width;
+        return detail::format_encoded(encoded, spec, out);
+    }
+
+    namespace detail {
+
+        /**
+         * @brief Shared parse/format logic for the std::format and fmt formatter specializations
+         */
+        template <typename Encoded>
+        struct formatter_base {
+            format_spec spec;
+
+            template <typename ParseContext, typename Error>
+            constexpr auto parse_spec(ParseContext& ctx) {
+                auto it = ctx.begin();
+                if (const char* error = parse_format_spec(it, ctx.end(), spec)) {
+                    throw Error(error);
+                }
+                return it;
+            }
+
+            template <typename FormatContext>
+            auto format_value(Encoded encoded, FormatContext& ctx) const {
+                return format_encoded(encoded, spec, ctx.out());
+            }
+        };
+
+    } // namespace detail
+
+} // namespace hhc
+
+#if defined(__cpp_lib_format)
+
+template <>
+struct std::formatter<hhc::encoded32, char> : hhc::detail::formatter_base<hhc::encoded32> {
+    constexpr auto parse(std::format_parse_context& ctx) {
+        return parse_spec<std::format_parse_context, std::format_error>(ctx);
+    }
+
+    template <typename FormatContext>
+    auto format(hhc::encoded32 encoded, FormatContext& ctx) const {
+        return format_value(encoded, ctx);
+    }
+};
+
+template <>
+struct std::formatter<hhc::encoded64, char> : hhc::detail::formatter_base<hhc::encoded64> {
+    constexpr auto parse(std::format_parse_context& ctx) {
+        return parse_spec<std::format_parse_context, std::format_error>(ctx);
+    }
+
+    template <typename FormatContext>
+    auto format(hhc::encoded64 encoded, FormatContext& ctx) const {
+        return format_value(encoded, ctx);
+    }
+};
+
+#endif // __cpp_lib_format
+
+#if defined(HHC_ENABLE_FMT)
+
+template <>
+struct fmt::formatter<hhc::encoded32> : hhc::detail::formatter_base<hhc::encoded32> {
+    constexpr auto parse(fmt::format_parse_context& ctx) {
+        return parse_spec<fmt::format_parse_context, fmt::format_error>(ctx);
+    }
+
+    template <typename FormatContext>
+    auto format(hhc::encoded32 encoded, FormatContext& ctx) const {
+        return format_value(encoded, ctx);
+    }
+};
+
+template <>
+struct fmt::formatter<hhc::encoded64> : hhc::detail::formatter_base<hhc::encoded64> {
+    constexpr auto parse(fmt::format_parse_context& ctx) {
+        return parse_spec<fmt::format_parse_context, fmt::format_error>(ctx);
+    }
+
+    template <typename FormatContext>
+    auto format(hhc::encoded64 encoded, FormatContext& ctx) const {
+        return format_value(encoded, ctx);
+    }
+};
+
+#endif // HHC_ENABLE_FMT
+
+#endif // HHC_FORMAT_HPP
@@ -0,0 +1,303 @@
+#ifndef HHC_FRONT_CODED_HPP
+#define HHC_FRONT_CODED_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+#include "hhc_assert.hpp"
+#include "hhc_codec.hpp"
+#include "hhc_arithmetic.hpp"
+
+namespace hhc {
+
+    /**
+     * @brief Front-coded, immutable-order list of sorted padded records
+     *
+     * Entries are grouped into blocks of BlockSize. Each block starts with its first record
+     * stored in full (the restart point); every later entry stores one byte with the length of
+     * the prefix it shares with the previous entry, followed by the remaining suffix. Sorted
+     * 64-bit IDs share their leading padding and high digits, so most entries shrink to a few
+     * bytes.
+     *
+     * The decoded value of each block head is also kept in a flat array. Lookups search it with a
+     * branch-free binary search on integers, then decode at most one block.
+     *
+     * Example:
+     *   hhc::front_coded_list ids;
+     *   for (uint64_t id : sorted_ids) {
+     *       ids.push_back_value(id);
+     *   }
+     *   bool found = ids.contains(hhc_string);
+     *
+     * @tparam Codec A basic_codec instantiation
+     * @tparam BlockSize Entries per block; larger blocks save space, smaller ones speed up lookups
+     */
+    template <typename Codec, std::size_t BlockSize = 16>
+    class basic_front_coded_list {
+        static_assert(BlockSize >= 1 && BlockSize <= 256, "BlockSize must be between 1 and 256");
+
+        using UInt = typename Codec::value_type;
+        static constexpr std::size_t LENGTH = Codec::ENCODED_LENGTH;
+
+    public:
+        using codec_type = Codec;
+        using record_type = std::array<char, LENGTH>;
+
+        static constexpr std::size_t BLOCK_SIZE = BlockSize;
+
+        /**
+         * @brief Streams the records in order, reconstructing each from the previous one
+         */
+        class const_iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = record_type;
+            using difference_type = std::ptrdiff_t;
+            using reference = const record_type&;
+            using pointer = const record_type*;
+
+            const_iterator() = default;
+
+            reference operator*() const { return record_; }
+            pointer operator->() const { return &record_; }
+
+            const_iterator& operator++() {
+                ++index_;
+                if (index_ < list_->size_) {
+                    cursor_ = list_->read_entry(index_, cursor_, record_);
+                }
+                return *this;
+            }
+
+            void operator++(int) { ++*this; }
+
+            friend bool operator==(const const_iterator& a, const const_iterator& b) noexcept {
+                return a.index_ == b.index_;
+            }
+            friend bool operator!=(const const_iterator& a, const const_iterator& b) noexcept { return !(a == b); }
+
+        private:
+            friend class basic_front_coded_list;
+
+            const_iterator(const basic_front_coded_list* list, std::size_t index) : list_(list), index_(index) {
+                if (index_ < list_->size_) {
+                    cursor_ = list_->read_entry(index_, nullptr, record_);
+                }
+            }
+
+            const basic_front_coded_list* list_ = nullptr;
+            std::size_t index_ = 0;
+            const unsigned char* cursor_ = nullptr;
+            record_type record_{};
+        };
+
+        basic_front_coded_list() = default;
+
+        /**
+         * @brief Build from count back-to-back padded records in ascending order
+         * @throws std::invalid_argument if a record contains a character outside the alphabet or the records are not sorted
+         * @throws std::out_of_range if a record exceeds the bounds of the codec
+         */
+        basic_front_coded_list(const char* records, std::size_t count) {
+            HHC_ASSERT(count == 0 || records != nullptr);
+            for (std::size_t i = 0; i < count; ++i) {
+                push_back(records + i * LENGTH);
+            }
+        }
+
+        /**
+         * @brief Append a padded record no smaller than the last one
+         * @param record ENCODED_LENGTH characters
+         * @throws std::invalid_argument if the record contains a character outside the alphabet or is out of order
+         * @throws std::out_of_range if the record exceeds the bounds of the codec
+         */
+        void push_back(const char* record) {
+            HHC_ASSERT(record != nullptr);
+            UInt value = 0;
+            Codec::decode_batch(record, 1, &value);
+            append(record, value);
+        }
+
+        /**
+         * @brief Append a value no smaller than the last one
+         * @throws std::invalid_argument if the value is out of order
+         */
+        void push_back_value(UInt value) {
+            record_type record{};
+            Codec::encode_padded(value, record.data());
+            append(record.data(), value);
+        }
+
+        /// Number of records
+        std::size_t size() const noexcept { return size_; }
+        bool empty() const noexcept { return size_ == 0; }
+
+        /// Bytes of heap memory held by the list
+        std::size_t memory_usage() const noexcept {
+            return data_.capacity() + offsets_.capacity() * sizeof(std::size_t) + heads_.capacity() * sizeof(UInt);
+        }
+
+        /// Release spare capacity left over from building
+        void shrink_to_fit() {
+            data_.shrink_to_fit();
+            offsets_.shrink_to_fit();
+            heads_.shrink_to_fit();
+        }
+
+        /**
+         * @brief The record at index (decodes up to BlockSize entries)
+         */
+        record_type operator[](std::size_t index) const {
+            HHC_ASSERT(index < size_);
+            record_type record{};
+            const std::size_t block_first = index - index % BlockSize;
+            const unsigned char* cursor = read_entry(block_first, nullptr, record);
+            for (std::size_t i = block_first + 1; i <= index; ++i) {
+                cursor = read_entry(i, cursor, record);
+            }
+            return record;
+        }
+
+        /**
+         * @brief The value of the record at index
+         */
+        UInt value(std::size_t index) const {
+            const record_type record = (*this)[index];
+            return detail::decode_digits<LENGTH, Codec::BASE, UInt>(
+                record.data(), detail::alphabet_tables<typename Codec::alphabet_type>::INVERSE.data());
+        }
+
+        /**
+         * @brief Index of the first record not less than value (size() if there is none)
+         */
+        std::size_t lower_bound(UInt value) const {
+            if (size_ == 0) {
+                return 0;
+            }
+            // Branch-free search for the last block whose head is below value; the first record
+            // not less than value is then in that block or is the next block's head
+            const UInt* base = heads_.data();
+            std::size_t length = heads_.size();
+            while (length > 1) {
+                const std::size_t half = length / 2;
+                base = base[half] < value ? base + half : base;
+                length -= half;
+            }
+            if (!(*base < value)) {
+                return 0;
+            }
+
+            record_type target{};
+            Codec::encode_padded(value, target.data());
+            const std::string_view target_view(target.data(), LENGTH);
+
+            const std::size_t block_first = static_cast<std::size_t>(base - heads_.data()) * BlockSize;
+            const std::size_t block_end = block_first + BlockSize < size_ ? block_first + BlockSize : size_;
+            record_type record{};
+            const unsigned char* cursor = read_entry(block_first, nullptr, record);
+            for (std::size_t i = block_first + 1; i < block_end; ++i) {
+                cursor = read_entry(i, cursor, record);
+                if (detail::compare_digits<Codec>(std::string_view(record.data(), LENGTH), target_view) >= 0) {
+                    return i;
+                }
+            }
+            return block_end;
+        }
+
+        /**
+         * @brief Index of the first record not less than a padded or unpadded encoded value
+         * @throws std::invalid_argument if encoded is not a valid encoding
+         * @throws std::out_of_range if encoded exceeds the bounds of the codec
+         */
+        std::size_t lower_bound(std::string_view encoded) const {
+            return lower_bound(Codec::decode(encoded.data(), encoded.size()));
+        }
+
+        /// Whether a record with the given value is present
+        bool contains(UInt value) const {
+            const std::size_t index = lower_bound(value);
+            return index < size_ && this->value(index) == value;
+        }
+
+        /**
+         * @brief Whether a padded or unpadded encoded value is present
+         * @throws std::invalid_argument if encoded is not a valid encoding
+         * @throws std::out_of_range if encoded exceeds the bounds of the codec
+         */
+        bool contains(std::string_view encoded) const {
+            return contains(Codec::decode(encoded.data(), encoded.size()));
+        }
+
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, size_); }
+
+        /**
+         * @brief Write every record back-to-back into output in one streaming pass
+         * @param output The output buffer (at least size() * ENCODED_LENGTH bytes)
+         */
+        void copy_to(char* output) const {
+            HHC_ASSERT(size_ == 0 || output != nullptr);
+            for (const auto& record : *this) {
+                std::memcpy(output, record.data(), LENGTH);
+                output += LENGTH;
+            }
+        }
+
+    private:
+        void append(const char* record, UInt value) {
+            if (size_ != 0 && value < last_value_) {
+                throw std::invalid_argument("front_coded_list records must be appended in ascending order");
+            }
+            if (size_ % BlockSize == 0) {
+                offsets_.push_back(data_.size());
+                heads_.push_back(value);
+                data_.insert(data_.end(), record, record + LENGTH);
+            } else {
+                std::size_t shared = 0;
+                while (shared < LENGTH && last_[shared] == record[shared]) {
+                    ++shared;
+                }
+                data_.push_back(static_cast<unsigned char>(shared));
+                data_.insert(data_.end(), record + shared, record + LENGTH);
+            }
+            std::memcpy(last_.data(), record, LENGTH);
+            last_value_ = value;
+            ++size_;
+        }
+
+        /**
+         * @brief Reconstruct entry index into record
+         * @param cursor Position of the entry's bytes, with record holding the previous entry
+         *               (ignored when index starts a block)
+         * @return Position of the next entry's bytes
+         */
+        const unsigned char* read_entry(std::size_t index, const unsigned char* cursor, record_type& record) const {
+            if (index % BlockSize == 0) {
+                cursor = data_.data() + offsets_[index / BlockSize];
+                std::memcpy(record.data(), cursor, LENGTH);
+                return cursor + LENGTH;
+            }
+            const std::size_t shared = *cursor++;
+            std::memcpy(record.data() + shared, cursor, LENGTH - shared);
+            return cursor + (LENGTH - shared);
+        }
+
+        std::vector<unsigned char> data_;
+        std::vector<std::size_t> offsets_;
+        std::vector<UInt> heads_;
+        std::size_t size_ = 0;
+        record_type last_{};
+        UInt last_value_ = 0;
+    };
+
+    using front_coded_list = basic_front_coded_list<hhc64_codec>;
+    using front_coded_list32 = basic_front_coded_list<hhc32_codec>;
+
+} // namespace hhc
+
+#endif // HHC_FRONT_CODED_HPP
@@ -0,0 +1,246 @@
+#ifndef HHC_OBFUSCATE_HPP
+#define HHC_OBFUSCATE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "hhc_assert.hpp"
+#include "hhc_codec.hpp"
+
+namespace hhc {
+
+    namespace detail {
+
+        /**
+         * @brief SplitMix64 step, used to expand a key into round constants
+         */
+        constexpr uint64_t splitmix64(uint64_t& state) {
+            state += 0x9e3779b97f4a7c15ULL;
+            uint64_t z = state;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            return z ^ (z >> 31);
+        }
+
+        /**
+         * @brief Multiplicative inverse of an odd number modulo 2^bits (Newton's iteration)
+         */
+        template <typename UInt>
+        constexpr UInt odd_inverse(UInt odd) {
+            // odd * odd == 1 (mod 8), and every step doubles the number of correct low bits
+            UInt inverse = odd;
+            for (int i = 0; i < 5; ++i) {
+                inverse = static_cast<UInt>(inverse * static_cast<UInt>(2 - odd * inverse));
+            }
+            return inverse;
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Keyed bijection on UInt that hides the order of sequential IDs
+     *
+     * A keyed variant of the MurmurHash3 finalizer: each round adds a round key, folds the high
+     * half into the low half and multiplies by a key-derived odd constant. Every step is
+     * invertible, so unpermute recovers the ID exactly. Consecutive IDs map to unrelated-looking
+     * values, and a few multiplies per call keep the cost to a few nanoseconds.
+     *
+     * @note This obscures growth rates and enumeration order. It is not encryption: an attacker
+     *       holding many (ID, output) pairs can recover the key. Use a block cipher when the IDs
+     *       themselves are secret.
+     * @tparam UInt uint32_t or uint64_t
+     */
+    template <typename UInt>
+    class basic_obfuscator {
+        static_assert(std::is_same_v<UInt, uint32_t> || std::is_same_v<UInt, uint64_t>,
+                      "Obfuscators permute 32-bit or 64-bit values");
+
+        static constexpr int ROUNDS = 2;
+        static constexpr unsigned SHIFT = sizeof(UInt) * 4;
+
+    public:
+        using value_type = UInt;
+
+        /**
+         * @brief Derive round keys and multipliers from key
+         */
+        constexpr explicit basic_obfuscator(uint64_t key) {
+            uint64_t state = key;
+            for (int round = 0; round < ROUNDS; ++round) {
+                adds_[round] = static_cast<UInt>(detail::splitmix64(state));
+                multipliers_[round] = static_cast<UInt>(detail::splitmix64(state) | 1U);
+                inverses_[round] = detail::odd_inverse(multipliers_[round]);
+            }
+        }
+
+        /// The obfuscated form of value
+        constexpr UInt permute(UInt value) const noexcept {
+            for (int round = 0; round < ROUNDS; ++round) {
+                value = static_cast<UInt>(value + adds_[round]);
+                value ^= value >> SHIFT;
+                value = static_cast<UInt>(value * multipliers_[round]);
+            }
+            value ^= value >> SHIFT;
+            return value;
+        }
+
+        /// The value whose obfuscated form is permuted
+        constexpr UInt unpermute(UInt permuted) const noexcept {
+            // Folding by half the width undoes itself in one step
+            permuted ^= permuted >> SHIFT;
+            for (int round = ROUNDS - 1; round >= 0; --round) {
+                permuted = static_cast<UInt>(permuted * inverses_[round]);
+                permuted ^= permuted >> SHIFT;
+                permuted = static_cast<UInt>(permuted - adds_[round]);
+            }
+            return permuted;
+        }
+
+        /**
+         * @brief permute count values (outputs may alias inputs)
+         */
+        void permute_batch(const UInt* inputs, std::size_t count, UInt* outputs) const {
+            HHC_ASSERT(count == 0 || (inputs != nullptr && outputs != nullptr));
+            for (std::size_t i = 0; i < count; ++i) {
+                outputs[i] = permute(inputs[i]);
+            }
+        }
+
+        /**
+         * @brief unpermute count values (outputs may alias inputs)
+         */
+        void unpermute_batch(const UInt* inputs, std::size_t count, UInt* outputs) const {
+            HHC_ASSERT(count == 0 || (inputs != nullptr && outputs != nullptr));
+            for (std::size_t i = 0; i < count; ++i) {
+                outputs[i] = unpermute(inputs[i]);
+            }
+        }
+
+    private:
+        std::array<UInt, ROUNDS> adds_{};
+        std::array<UInt, ROUNDS> multipliers_{};
+        std::array<UInt, ROUNDS> inverses_{};
+    };
+
+    using obfuscator32 = basic_obfuscator<uint32_t>;
+    using obfuscator64 = basic_obfuscator<uint64_t>;
+
+    /**
+     * @brief A codec that obfuscates values before encoding and restores them after decoding
+     *
+     * Mirrors the basic_codec interface with member functions, since each instance carries a key.
+     * Strings it produces are ordinary encodings of the permuted values, so they have the usual
+     * length and alphabet; only the same key decodes them back to the original IDs.
+     *
+     * Example:
+     *   const hhc::obfuscated_codec64 public_ids(secret_key);
+     *   char slug[hhc::hhc64_codec::ENCODED_LENGTH];
+     *   public_ids.encode_padded(order_id, slug);
+     *   uint64_t order_id = public_ids.decode(slug, sizeof(slug));
+     *
+     * @tparam Codec A basic_codec instantiation over uint32_t or uint64_t
+     */
+    template <typename Codec>
+    class basic_obfuscated_codec {
+        using UInt = typename Codec::value_type;
+        using tables = detail::alphabet_tables<typename Codec::alphabet_type>;
+
+    public:
+        using codec_type = Codec;
+        using value_type = UInt;
+
+        static constexpr std::size_t ENCODED_LENGTH = Codec::ENCODED_LENGTH;
+        static constexpr std::size_t STRING_LENGTH = Codec::STRING_LENGTH;
+
+        constexpr explicit basic_obfuscated_codec(uint64_t key) : obfuscator_(key) {}
+
+        constexpr const basic_obfuscator<UInt>& obfuscator() const noexcept { return obfuscator_; }
+
+        /**
+         * @brief Encode the obfuscated form of input into an ENCODED_LENGTH-character string
+         * @note The output string is not null-terminated
+         */
+        constexpr void encode_padded(UInt input, char* output_string) const {
+            Codec::encode_padded(obfuscator_.permute(input), output_string);
+        }
+
+        /**
+         * @brief Encode the obfuscated form of input without leading padding symbols
+         * @note The output string is null-terminated
+         */
+        constexpr void encode_unpadded(UInt input, char* output_string) const {
+            Codec::encode_unpadded(obfuscator_.permute(input), output_string);
+        }
+
+        /**
+         * @brief Decode an ENCODED_LENGTH-character string without validation and restore the value
+         */
+        constexpr UInt decode_unsafe(const char* input_string) const {
+            return obfuscator_.unpermute(Codec::decode_unsafe(input_string));
+        }
+
+        /**
+         * @brief Decode a padded or unpadded null-terminated string and restore the value
+         * @throws std::invalid_argument if the string is invalid
+         * @throws std::out_of_range if the string exceeds the bounds of UInt
+         */
+        constexpr UInt decode(const char* input_string) const {
+            return obfuscator_.unpermute(Codec::decode(input_string));
+        }
+
+        /**
+         * @brief Decode a padded or unpadded string of known length and restore the value
+         * @throws std::invalid_argument if the string is invalid
+         * @throws std::out_of_range if the string exceeds the bounds of UInt
+         */
+        constexpr UInt decode(const char* input_string, std::size_t length) const {
+            return obfuscator_.unpermute(Codec::decode(input_string, length));
+        }
+
+        /**
+         * @brief Obfuscate and encode count values into back-to-back records
+         * @note The output is not null-terminated
+         */
+        void encode_padded_batch(const UInt* inputs, std::size_t count, char* output) const {
+            HHC_ASSERT(count == 0 || (inputs != nullptr && output != nullptr));
+            for (std::size_t i = 0; i < count; ++i) {
+                detail::encode_digits<ENCODED_LENGTH, Codec::BASE>(obfuscator_.permute(inputs[i]), Codec::ALPHABET.data(),
+                                                                   tables::PAIRS.data(), output + i * ENCODED_LENGTH);
+            }
+        }
+
+        /**
+         * @brief Decode count back-to-back records without validation and restore the values
+         */
+        void decode_unsafe_batch(const char* input, std::size_t count, UInt* outputs) const {
+            HHC_ASSERT(count == 0 || (input != nullptr && outputs != nullptr));
+            for (std::size_t i = 0; i < count; ++i) {
+                outputs[i] = obfuscator_.unpermute(detail::decode_digits<ENCODED_LENGTH, Codec::BASE, UInt>(
+                    input + i * ENCODED_LENGTH, tables::INVERSE.data()));
+            }
+        }
+
+        /**
+         * @brief Decode count back-to-back records with validation and restore the values
+         * @throws std::invalid_argument if a record contains a character outside the alphabet
+         * @throws std::out_of_range if a record exceeds the bounds of UInt
+         */
+        void decode_batch(const char* input, std::size_t count, UInt* outputs) const {
+            HHC_ASSERT(count == 0 || (input != nullptr && outputs != nullptr));
+            for (std::size_t i = 0; i < count; ++i) {
+                outputs[i] = obfuscator_.unpermute(detail::decode_record_checked<ENCODED_LENGTH, Codec::BASE, UInt>(
+                    input + i * ENCODED_LENGTH, tables::INVERSE.data(), Codec::MAX_DIGITS));
+            }
+        }
+
+    private:
+        basic_obfuscator<UInt> obfuscator_;
+    };
+
+    using obfuscated_codec32 = basic_obfuscated_codec<hhc32_codec>;
+    using obfuscated_codec64 = basic_obfuscated_codec<hhc64_codec>;
+
+} // namespace hhc
+
+#endif // HHC_OBFUSCATE_HPP
@@ -0,0 +1,203 @@
+#ifndef HHC_ORDERED_HPP
+#define HHC_ORDERED_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include "hhc_assert.hpp"
+#include "hhc_codec.hpp"
+
+#if defined(__cpp_lib_bit_cast)
+#  include <bit>
+#endif
+
+namespace hhc {
+
+    namespace detail {
+
+        /**
+         * @brief Portable std::bit_cast for C++17 builds (constexpr where the compiler has a builtin)
+         */
+        template <typename To, typename From>
+        constexpr To bit_cast(const From& from) noexcept {
+            static_assert(sizeof(To) == sizeof(From), "bit_cast requires types of the same size");
+#if defined(__cpp_lib_bit_cast)
+            return std::bit_cast<To>(from);
+#elif defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1927)
+            return __builtin_bit_cast(To, from);
+#else
+            To to;
+            std::memcpy(&to, &from, sizeof(To));
+            return to;
+#endif
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Maps a signed integer or IEEE floating point type onto an unsigned type of the same
+     *        width so that unsigned order matches the order of the original values
+     *
+     * Signed integers flip the sign bit. Floating point values flip the sign bit when positive
+     * and all bits when negative, which orders -inf < negative values < -0 < +0 < positive
+     * values < +inf; NaNs land beyond the infinities on the side of their sign bit. Both mappings
+     * are bijections, so every value (every NaN payload included) round-trips exactly.
+     *
+     * @tparam T int32_t, int64_t, float or double
+     */
+    template <typename T>
+    struct ordered_traits {
+        static_assert((std::is_integral_v<T> && std::is_signed_v<T>) || std::is_floating_point_v<T>,
+                      "ordered_traits maps signed integers and floating point types");
+        static_assert(sizeof(T) == sizeof(uint32_t) || sizeof(T) == sizeof(uint64_t),
+                      "ordered_traits maps 32-bit and 64-bit types");
+        static_assert(!std::is_floating_point_v<T> || std::numeric_limits<T>::is_iec559,
+                      "Floating point types must be IEEE 754");
+
+        using value_type = T;
+        using unsigned_type = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+
+        static constexpr unsigned_type SIGN_BIT = unsigned_type{1} << (sizeof(T) * 8 - 1);
+
+        /// The unsigned key for value
+        static constexpr unsigned_type to_unsigned(T value) noexcept {
+            const auto bits = detail::bit_cast<unsigned_type>(value);
+            if constexpr (std::is_integral_v<T>) {
+                return bits ^ SIGN_BIT;
+            } else {
+                // Negative values count down in magnitude, so inverting them reverses their order
+                return (bits & SIGN_BIT) != 0 ? static_cast<unsigned_type>(~bits) : bits | SIGN_BIT;
+            }
+        }
+
+        /// The value whose key is key
+        static constexpr T from_unsigned(unsigned_type key) noexcept {
+            if constexpr (std::is_integral_v<T>) {
+                return detail::bit_cast<T>(static_cast<unsigned_type>(key ^ SIGN_BIT));
+            } else {
+                return detail::bit_cast<T>((key & SIGN_BIT) != 0 ? key ^ SIGN_BIT : static_cast<unsigned_type>(~key));
+            }
+        }
+    };
+
+    /**
+     * @brief A codec for signed integers and floating point values whose padded encodings sort
+     *        in the same order as the values
+     *
+     * Values go through ordered_traits before encoding and come back through it after decoding,
+     * with the same single and batch functions as basic_codec. Only padded encodings sort
+     * correctly; unpadded ones are shorter for small keys and compare by length first.
+     *
+     * Example:
+     *   char key[hhc::ordered_int64_codec::ENCODED_LENGTH];
+     *   hhc::ordered_int64_codec::encode_padded(balance, key);
+     *   int64_t balance = hhc::ordered_int64_codec::decode(key, sizeof(key));
+     *
+     * @tparam T int32_t, int64_t, float or double
+     * @tparam Alphabet The alphabet to encode with (its symbols must be in ascending byte order)
+     */
+    template <typename T, typename Alphabet = hhc_alphabet>
+    class basic_ordered_codec {
+        static_assert(detail::is_ascii_ordered(Alphabet::symbols),
+                      "basic_ordered_codec requires an alphabet in ascending byte order, or encodings would not sort");
+
+        using traits = ordered_traits<T>;
+        using UInt = typename traits::unsigned_type;
+        using tables = detail::alphabet_tables<Alphabet>;
+
+    public:
+        using codec_type = basic_codec<Alphabet, UInt>;
+        using value_type = T;
+
+        static constexpr std::size_t ENCODED_LENGTH = codec_type::ENCODED_LENGTH;
+        static constexpr std::size_t STRING_LENGTH = codec_type::STRING_LENGTH;
+
+        /**
+         * @brief Encode a value into an ENCODED_LENGTH-character string that sorts like the value
+         * @note The output string is not null-terminated
+         */
+        static constexpr void encode_padded(T input, char* output_string) {
+            codec_type::encode_padded(traits::to_unsigned(input), output_string);
+        }
+
+        /**
+         * @brief Encode a value without leading padding symbols (these encodings do not sort)
+         * @note The output string is null-terminated; the lowest value (whose key is zero) encodes to an empty string
+         */
+        static constexpr void encode_unpadded(T input, char* output_string) {
+            codec_type::encode_unpadded(traits::to_unsigned(input), output_string);
+        }
+
+        /**
+         * @brief Decode an ENCODED_LENGTH-character string without validation
+         */
+        static constexpr T decode_unsafe(const char* input_string) {
+            return traits::from_unsigned(codec_type::decode_unsafe(input_string));
+        }
+
+        /**
+         * @brief Decode a padded or unpadded null-terminated string
+         * @throws std::invalid_argument if the string is invalid
+         * @throws std::out_of_range if the string exceeds the bounds of the unsigned type
+         */
+        static constexpr T decode(const char* input_string) {
+            return traits::from_unsigned(codec_type::decode(input_string));
+        }
+
+        /**
+         * @brief Decode a padded or unpadded string of known length
+         * @throws std::invalid_argument if the string is invalid
+         * @throws std::out_of_range if the string exceeds the bounds of the unsigned type
+         */
+        static constexpr T decode(const char* input_string, std::size_t length) {
+            return traits::from_unsigned(codec_type::decode(input_string, length));
+        }
+
+        /**
+         * @brief Encode count values into back-to-back ENCODED_LENGTH-character records
+         * @note The output is not null-terminated
+         */
+        static void encode_padded_batch(const T* inputs, std::size_t count, char* output) {
+            HHC_ASSERT(count == 0 || (inputs != nullptr && output != nullptr));
+            for (std::size_t i = 0; i < count; ++i) {
+                detail::encode_digits<ENCODED_LENGTH, codec_type::BASE>(traits::to_unsigned(inputs[i]),
+                                                                        codec_type::ALPHABET.data(), tables::PAIRS.data(),
+                                                                        output + i * ENCODED_LENGTH);
+            }
+        }
+
+        /**
+         * @brief Decode count back-to-back records without validation
+         */
+        static void decode_unsafe_batch(const char* input, std::size_t count, T* outputs) {
+            HHC_ASSERT(count == 0 || (input != nullptr && outputs != nullptr));
+            for (std::size_t i = 0; i < count; ++i) {
+                outputs[i] = traits::from_unsigned(detail::decode_digits<ENCODED_LENGTH, codec_type::BASE, UInt>(
+                    input + i * ENCODED_LENGTH, tables::INVERSE.data()));
+            }
+        }
+
+        /**
+         * @brief Decode count back-to-back records with validation
+         * @throws std::invalid_argument if a record contains a character outside the alphabet
+         * @throws std::out_of_range if a record exceeds the bounds of the unsigned type
+         */
+        static void decode_batch(const char* input, std::size_t count, T* outputs) {
+            HHC_ASSERT(count == 0 || (input != nullptr && outputs != nullptr));
+            for (std::size_t i = 0; i < count; ++i) {
+                outputs[i] = traits::from_unsigned(detail::decode_record_checked<ENCODED_LENGTH, codec_type::BASE, UInt>(
+                    input + i * ENCODED_LENGTH, tables::INVERSE.data(), codec_type::MAX_DIGITS));
+            }
+        }
+    };
+
+    using ordered_int32_codec = basic_ordered_codec<int32_t>;
+    using ordered_int64_codec = basic_ordered_codec<int64_t>;
+    using ordered_float_codec = basic_ordered_codec<float>;
+    using ordered_double_codec = basic_ordered_codec<double>;
+
+} // namespace hhc
+
+#endif // HHC_ORDERED_HPP
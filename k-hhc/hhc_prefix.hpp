@@ -0,0 +1,188 @@
+#ifndef HHC_PREFIX_HPP
+#define HHC_PREFIX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "hhc_codec.hpp"
+
+namespace hhc {
+
+    /**
+     * @brief Inclusive range of values [first, last]
+     */
+    template <typename UInt>
+    struct value_range {
+        UInt first;
+        UInt last;
+
+        constexpr bool contains(UInt value) const noexcept { return first <= value && value <= last; }
+
+        friend constexpr bool operator==(const value_range& a, const value_range& b) noexcept {
+            return a.first == b.first && a.last == b.last;
+        }
+        friend constexpr bool operator!=(const value_range& a, const value_range& b) noexcept { return !(a == b); }
+    };
+
+    namespace detail {
+
+        /**
+         * @brief Validate that text is at most Codec::ENCODED_LENGTH symbols of the codec's alphabet
+         */
+        template <typename Codec>
+        constexpr void check_prefix(std::string_view prefix) {
+            if (prefix.size() > Codec::ENCODED_LENGTH) {
+                throw_invalid_length(prefix.size());
+            }
+            const uint8_t* inverse = alphabet_tables<typename Codec::alphabet_type>::INVERSE.data();
+            for (const char symbol : prefix) {
+                if (inverse[static_cast<unsigned char>(symbol)] == INVALID_DIGIT) {
+                    throw_invalid_character();
+                }
+            }
+        }
+
+        [[noreturn]] inline void throw_invalid_width(unsigned width) {
+            throw std::invalid_argument("Invalid HHC width " + std::to_string(width) + " (expected 32 or 64)");
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief The values whose padded encodings start with prefix
+     *
+     * Padded encodings sort like the values they encode, so the values sharing a prefix form one
+     * contiguous range: the prefix followed by all zero symbols, up to the prefix followed by all
+     * last symbols (clamped to the largest value). A prefix search becomes a range scan on an
+     * integer index.
+     *
+     * @tparam Codec A basic_codec instantiation (defaults to 64-bit HHC)
+     * @param prefix Leading symbols of a padded encoding (empty matches every value)
+     * @return The inclusive range of matching values
+     * @throws std::invalid_argument if the prefix is longer than ENCODED_LENGTH or has a character outside the alphabet
+     * @throws std::out_of_range if no value of the codec starts with prefix
+     */
+    template <typename Codec = hhc64_codec>
+    constexpr value_range<typename Codec::value_type> prefix_to_range(std::string_view prefix) {
+        using UInt = typename Codec::value_type;
+        constexpr std::size_t LENGTH = Codec::ENCODED_LENGTH;
+        const uint8_t* inverse = detail::alphabet_tables<typename Codec::alphabet_type>::INVERSE.data();
+        detail::check_prefix<Codec>(prefix);
+
+        char first[LENGTH] = {};
+        char last[LENGTH] = {};
+        for (std::size_t pos = 0; pos < LENGTH; ++pos) {
+            const bool in_prefix = pos < prefix.size();
+            first[pos] = in_prefix ? prefix[pos] : Codec::ALPHABET[0];
+            last[pos] = in_prefix ? prefix[pos] : Codec::ALPHABET[Codec::BASE - 1];
+        }
+        if (!detail::digits_within_bounds(first, inverse, Codec::MAX_DIGITS)) {
+            detail::throw_out_of_range("HHC prefix exceeds codec bounds");
+        }
+        const UInt last_value = detail::digits_within_bounds(last, inverse, Codec::MAX_DIGITS)
+                                    ? detail::decode_digits<LENGTH, Codec::BASE, UInt>(last, inverse)
+                                    : std::numeric_limits<UInt>::max();
+        return {detail::decode_digits<LENGTH, Codec::BASE, UInt>(first, inverse), last_value};
+    }
+
+    /**
+     * @brief prefix_to_range for a width chosen at runtime
+     * @param prefix Leading symbols of a padded encoding
+     * @param width 32 or 64
+     * @throws std::invalid_argument if width is not 32 or 64, or the prefix is invalid
+     * @throws std::out_of_range if no value of that width starts with prefix
+     */
+    inline value_range<uint64_t> prefix_to_range(std::string_view prefix, unsigned width) {
+        if (width == 32) {
+            const auto range = prefix_to_range<hhc32_codec>(prefix);
+            return {range.first, range.last};
+        }
+        if (width == 64) {
+            return prefix_to_range<hhc64_codec>(prefix);
+        }
+        detail::throw_invalid_width(width);
+    }
+
+    /**
+     * @brief The fewest prefixes whose value ranges exactly tile [first, last]
+     *
+     * Each prefix stands for an aligned block of BASE^k values. Walking up from first, the
+     * largest aligned block that still fits is always part of a minimal cover, so the result
+     * has at most 2 * (BASE - 1) prefixes per digit and comes out in ascending order.
+     *
+     * @tparam Codec A basic_codec instantiation (defaults to 64-bit HHC)
+     * @param first The smallest value to cover
+     * @param last The largest value to cover
+     * @return The prefixes in ascending order (empty if first > last)
+     */
+    template <typename Codec = hhc64_codec>
+    std::vector<std::string> range_to_prefixes(typename Codec::value_type first, typename Codec::value_type last) {
+        using UInt = typename Codec::value_type;
+        constexpr std::size_t LENGTH = Codec::ENCODED_LENGTH;
+        constexpr UInt MAX = std::numeric_limits<UInt>::max();
+
+        std::vector<std::string> prefixes;
+        if (first > last) {
+            return prefixes;
+        }
+        if (first == 0 && last == MAX) {
+            prefixes.emplace_back();
+            return prefixes;
+        }
+
+        char encoded[LENGTH] = {};
+        UInt current = first;
+        while (true) {
+            // Grow the block while it stays aligned and ends by last. BASE^(LENGTH - 1) never
+            // exceeds MAX, so block sizes up to one-symbol prefixes cannot overflow; a block
+            // reaching past MAX only holds values up to MAX, which is fine when last == MAX.
+            std::size_t digits = 0;
+            UInt size = 1;
+            while (digits + 1 < LENGTH) {
+                const UInt next = static_cast<UInt>(size * Codec::BASE);
+                const UInt remaining = static_cast<UInt>(last - current);
+                if (current % next != 0 || (next - 1 > remaining && last != MAX)) {
+                    break;
+                }
+                size = next;
+                ++digits;
+            }
+
+            Codec::encode_padded(current, encoded);
+            prefixes.emplace_back(encoded, LENGTH - digits);
+            if (size - 1 >= static_cast<UInt>(last - current)) {
+                return prefixes;
+            }
+            current = static_cast<UInt>(current + size);
+        }
+    }
+
+    /**
+     * @brief range_to_prefixes for a width chosen at runtime
+     * @param width 32 or 64
+     * @throws std::invalid_argument if width is not 32 or 64
+     * @throws std::out_of_range if width is 32 and last does not fit in 32 bits
+     */
+    inline std::vector<std::string> range_to_prefixes(uint64_t first, uint64_t last, unsigned width) {
+        if (width == 32) {
+            if (first > last) {
+                return {};
+            }
+            if (last > std::numeric_limits<uint32_t>::max()) {
+                detail::throw_out_of_range("Range exceeds 32-bit bounds");
+            }
+            return range_to_prefixes<hhc32_codec>(static_cast<uint32_t>(first), static_cast<uint32_t>(last));
+        }
+        if (width == 64) {
+            return range_to_prefixes<hhc64_codec>(first, last);
+        }
+        detail::throw_invalid_width(width);
+    }
+
+} // namespace hhc
+
+#endif // HHC_PREFIX_HPP
@@ -0,0 +1,222 @@
+#ifndef HHC_RANDOM_HPP
+#define HHC_RANDOM_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+#include "hhc_assert.hpp"
+#include "hhc_codec.hpp"
+
+namespace hhc {
+
+    namespace detail {
+
+        /**
+         * @brief multiply_high from four 32x32-bit products, for compilers without a 128-bit type (MSVC)
+         */
+        constexpr uint64_t multiply_high_portable(uint64_t a, uint64_t b, uint64_t& low) {
+            const uint64_t a_low = a & 0xFFFFFFFFULL;
+            const uint64_t a_high = a >> 32;
+            const uint64_t b_low = b & 0xFFFFFFFFULL;
+            const uint64_t b_high = b >> 32;
+            const uint64_t low_low = a_low * b_low;
+            const uint64_t high_low = a_high * b_low;
+            const uint64_t low_high = a_low * b_high;
+            const uint64_t middle = (low_low >> 32) + (high_low & 0xFFFFFFFFULL) + low_high;
+            low = (middle << 32) | (low_low & 0xFFFFFFFFULL);
+            return a_high * b_high + (high_low >> 32) + (middle >> 32);
+        }
+
+        /**
+         * @brief The high 64 bits of a * b, with the low 64 bits stored in low
+         */
+        constexpr uint64_t multiply_high(uint64_t a, uint64_t b, uint64_t& low) {
+#if defined(__SIZEOF_INT128__)
+            const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+            low = static_cast<uint64_t>(product);
+            return static_cast<uint64_t>(product >> 64);
+#else
+            return multiply_high_portable(a, b, low);
+#endif
+        }
+
+        /**
+         * @brief How many digits of an alphabet one uniform 64-bit word is turned into
+         *
+         * The word is mapped onto [0, Base^Digits) with the largest power that fits in 64 bits
+         * (66^10 for HHC), so each word yields about 60 bits of tokens.
+         */
+        template <typename Alphabet>
+        struct random_digit_chunk {
+            static constexpr uint32_t BASE = alphabet_tables<Alphabet>::BASE;
+
+            static constexpr std::size_t DIGITS = [] {
+                std::size_t digits = 0;
+                for (uint64_t range = 1; range <= std::numeric_limits<uint64_t>::max() / BASE; range *= BASE) {
+                    ++digits;
+                }
+                return digits;
+            }();
+
+            static constexpr uint64_t RANGE = [] {
+                uint64_t range = 1;
+                for (std::size_t i = 0; i < DIGITS; ++i) {
+                    range *= BASE;
+                }
+                return range;
+            }();
+
+            /// 2^64 mod RANGE: products whose low half falls below this are rejected to avoid bias
+            static constexpr uint64_t THRESHOLD = (0 - RANGE) % RANGE;
+        };
+
+        /**
+         * @brief Draw 64 uniform bits from a UniformRandomBitGenerator producing 32 or 64 bits per call
+         */
+        template <typename Rng>
+        uint64_t random_word(Rng& rng) {
+            using result_type = typename Rng::result_type;
+            static_assert(Rng::min() == 0, "The random generator must produce full-range words");
+            if constexpr (Rng::max() == std::numeric_limits<uint64_t>::max()) {
+                return static_cast<uint64_t>(rng());
+            } else {
+                static_assert(Rng::max() == std::numeric_limits<uint32_t>::max(),
+                              "The random generator must produce 32 or 64 uniform bits per call");
+                const uint64_t high = static_cast<result_type>(rng());
+                return (high << 32) | static_cast<result_type>(rng());
+            }
+        }
+
+        /**
+         * @brief A value uniform on [0, Chunk::RANGE) (Lemire's multiply-and-reject, rarely redrawing)
+         */
+        template <typename Chunk, typename Rng>
+        uint64_t random_chunk(Rng& rng) {
+            uint64_t low = 0;
+            uint64_t value = multiply_high(random_word(rng), Chunk::RANGE, low);
+            while (low < Chunk::THRESHOLD) {
+                value = multiply_high(random_word(rng), Chunk::RANGE, low);
+            }
+            return value;
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Fast keyed generator for random_tokens (wyrand); NOT cryptographically secure
+     *
+     * Good for test data, sampling and IDs that only need to be spread out. Tokens that must be
+     * unguessable (invite codes, session keys) should come from a CSPRNG through byte_stream_engine.
+     * Satisfies UniformRandomBitGenerator.
+     */
+    class token_engine {
+    public:
+        using result_type = uint64_t;
+
+        constexpr explicit token_engine(uint64_t key) noexcept : state_(key) {}
+
+        static constexpr result_type min() noexcept { return 0; }
+        static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+        constexpr result_type operator()() noexcept {
+            state_ += 0xa0761d6478bd642fULL;
+            uint64_t low = 0;
+            const uint64_t high = detail::multiply_high(state_, state_ ^ 0xe7037ed1a0b428dbULL, low);
+            return high ^ low;
+        }
+
+    private:
+        uint64_t state_;
+    };
+
+    /**
+     * @brief Adapts a CSPRNG byte source to a UniformRandomBitGenerator, refilling 512 bytes at a time
+     *
+     * Example:
+     *   hhc::byte_stream_engine csprng([](void* buffer, std::size_t size) { getrandom(buffer, size, 0); });
+     *   std::string codes = hhc::random_tokens(1000000, 12, csprng);
+     *
+     * @tparam Fill A callable fill(void* buffer, std::size_t size) that writes size random bytes
+     */
+    template <typename Fill>
+    class byte_stream_engine {
+        static constexpr std::size_t WORDS = 64;
+
+    public:
+        using result_type = uint64_t;
+
+        explicit byte_stream_engine(Fill fill) : fill_(std::move(fill)) {}
+
+        static constexpr result_type min() noexcept { return 0; }
+        static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+        result_type operator()() {
+            if (next_ == WORDS) {
+                fill_(static_cast<void*>(buffer_.data()), sizeof(buffer_));
+                next_ = 0;
+            }
+            return buffer_[next_++];
+        }
+
+    private:
+        Fill fill_;
+        std::array<uint64_t, WORDS> buffer_{};
+        std::size_t next_ = WORDS;
+    };
+
+    /**
+     * @brief Fill output with count uniformly random tokens of length symbols each, back to back
+     *
+     * Every 64-bit word drawn from rng is mapped without modulo bias onto ten base-66 digits
+     * (Lemire's multiply-and-reject, which redraws about one word in sixteen) and written with
+     * the pair table of the codecs, so a token costs about length / 10 draws instead of one
+     * rejection loop per character.
+     *
+     * @note The output is not null-terminated
+     * @tparam Alphabet The alphabet to draw symbols from (defaults to HHC)
+     * @param output The output buffer (at least count * length bytes)
+     * @param count The number of tokens
+     * @param length The symbols per token
+     * @param rng A UniformRandomBitGenerator producing 32 or 64 bits per call (token_engine, byte_stream_engine, std::mt19937_64)
+     */
+    template <typename Alphabet = hhc_alphabet, typename Rng>
+    void random_tokens(char* output, std::size_t count, std::size_t length, Rng& rng) {
+        using chunk = detail::random_digit_chunk<Alphabet>;
+        using tables = detail::alphabet_tables<Alphabet>;
+        HHC_ASSERT(count == 0 || length == 0 || output != nullptr);
+
+        // Symbols are independent, so the tokens are one run of uniform symbols split every length
+        std::size_t remaining = count * length;
+        while (remaining >= chunk::DIGITS) {
+            detail::encode_digits<chunk::DIGITS, chunk::BASE>(detail::random_chunk<chunk>(rng), Alphabet::symbols.data(),
+                                                              tables::PAIRS.data(), output);
+            output += chunk::DIGITS;
+            remaining -= chunk::DIGITS;
+        }
+        if (remaining != 0) {
+            char tail[chunk::DIGITS];
+            detail::encode_digits<chunk::DIGITS, chunk::BASE>(detail::random_chunk<chunk>(rng), Alphabet::symbols.data(),
+                                                              tables::PAIRS.data(), tail);
+            for (std::size_t i = 0; i < remaining; ++i) {
+                output[i] = tail[i];
+            }
+        }
+    }
+
+    /**
+     * @brief count random tokens of length symbols each, back to back in one string
+     * @see random_tokens(char*, std::size_t, std::size_t, Rng&)
+     */
+    template <typename Alphabet = hhc_alphabet, typename Rng>
+    std::string random_tokens(std::size_t count, std::size_t length, Rng& rng) {
+        std::string tokens(count * length, '\0');
+        random_tokens<Alphabet>(tokens.data(), count, length, rng);
+        return tokens;
+    }
+
+} // namespace hhc
+
+#endif // HHC_RANDOM_HPP
@@ -0,0 +1,223 @@
+#ifndef HHC_RUNTIME_CODEC_HPP
+#define HHC_RUNTIME_CODEC_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include "hhc_constants.hpp"
+#include "hhc_assert.hpp"
+#include "hhc_codec.hpp"
+
+namespace hhc {
+
+    /**
+     * @brief HHC codec over an alphabet chosen at runtime
+     *
+     * The alphabet must contain exactly BASE (66) unique, non-null ASCII characters, typically a
+     * shuffled copy of ALPHABET. The inverse and pair tables are built once in the constructor;
+     * afterwards every call runs the same kernels as hhc32_codec / hhc64_codec, with the tables
+     * read from the object instead of from compile-time constants. Keeping the base fixed keeps
+     * every division a division by a constant.
+     *
+     * @note Padded strings only sort numerically if the alphabet is in ASCII order, so bounds
+     *       checks compare digit values instead of characters.
+     */
+    class codec {
+    public:
+        /**
+         * @brief Build the lookup tables for an alphabet
+         * @param alphabet Exactly BASE unique, non-null ASCII characters
+         * @throws std::invalid_argument if the alphabet is malformed
+         */
+        explicit codec(std::string_view alphabet) {
+            if (alphabet.size() != BASE) {
+                throw std::invalid_argument("HHC alphabet must contain exactly 66 characters");
+            }
+            for (std::size_t i = 0; i < BASE; ++i) {
+                symbols_[i] = alphabet[i];
+            }
+            if (!detail::is_valid_alphabet(symbols_)) {
+                throw std::invalid_argument("HHC alphabet must contain unique non-null ASCII characters");
+            }
+
+            for (auto& digit : inverse_) {
+                digit = detail::INVALID_DIGIT;
+            }
+            for (uint32_t i = 0; i < BASE; ++i) {
+                inverse_[static_cast<unsigned char>(symbols_[i])] = static_cast<uint8_t>(i);
+            }
+            for (uint32_t high = 0; high < BASE; ++high) {
+                for (uint32_t low = 0; low < BASE; ++low) {
+                    pairs_[2 * (high * BASE + low)] = symbols_[high];
+                    pairs_[2 * (high * BASE + low) + 1] = symbols_[low];
+                }
+            }
+        }
+
+        /**
+         * @brief The alphabet this codec was built from
+         */
+        const std::array<char, BASE>& alphabet() const noexcept {
+            return symbols_;
+        }
+
+        /**
+         * @brief Encode a 32-bit integer into a 6-character string
+         * @note The output string is not null-terminated
+         * @param input The 32-bit integer to encode
+         * @param output_string The output string (at least HHC_32BIT_STRING_LENGTH bytes)
+         */
+        void encode_32bit_padded(uint32_t input, char* output_string) const {
+            HHC_ASSERT(output_string != nullptr);
+            detail::encode_digits<HHC_32BIT_ENCODED_LENGTH, BASE>(input, symbols_.data(), pairs_.data(), output_string);
+        }
+
+        /**
+         * @brief Encode a 32-bit integer without leading padding
+         * @note The output string is null-terminated; zero encodes to an empty string
+         * @param input The 32-bit integer to encode
+         * @param output_string The output string (at least HHC_32BIT_STRING_LENGTH bytes)
+         */
+        void encode_32bit_unpadded(uint32_t input, char* output_string) const {
+            HHC_ASSERT(output_string != nullptr);
+            detail::encode_digits_unpadded<HHC_32BIT_ENCODED_LENGTH, BASE>(input, symbols_.data(), pairs_.data(),
+                                                                           output_string);
+        }
+
+        /**
+         * @brief Decode a 32-bit integer from a 6-character string without validation
+         * @param input_string The input string to decode
+         * @return The decoded 32-bit integer
+         */
+        uint32_t decode_32bit_unsafe(const char* input_string) const {
+            HHC_ASSERT(input_string != nullptr);
+            return detail::decode_digits<HHC_32BIT_ENCODED_LENGTH, BASE, uint32_t>(input_string, inverse_.data());
+        }
+
+        /**
+         * @brief Decode a 32-bit integer from a padded or unpadded string
+         * @param input_string The input string to decode
+         * @return The decoded 32-bit integer
+         * @throws std::invalid_argument if the string is invalid
+         * @throws std::out_of_range if the string exceeds 32-bit bounds
+         */
+        uint32_t decode_32bit(const char* input_string) const {
+            return detail::decode_checked<HHC_32BIT_ENCODED_LENGTH, BASE, uint32_t>(input_string, inverse_.data(),
+                                                                                    hhc32_codec::MAX_DIGITS);
+        }
+
+        /**
+         * @brief Encode a 64-bit integer into an 11-character string
+         * @note The output string is not null-terminated
+         * @param input The 64-bit integer to encode
+         * @param output_string The output string (at least HHC_64BIT_STRING_LENGTH bytes)
+         */
+        void encode_64bit_padded(uint64_t input, char* output_string) const {
+            HHC_ASSERT(output_string != nullptr);
+            detail::encode_digits<HHC_64BIT_ENCODED_LENGTH, BASE>(input, symbols_.data(), pairs_.data(), output_string);
+        }
+
+        /**
+         * @brief Encode a 64-bit integer without leading padding
+         * @note The output string is null-terminated; zero encodes to an empty string
+         * @param input The 64-bit integer to encode
+         * @param output_string The output string (at least HHC_64BIT_STRING_LENGTH bytes)
+         */
+        void encode_64bit_unpadded(uint64_t input, char* output_string) const {
+            HHC_ASSERT(output_string != nullptr);
+            detail::encode_digits_unpadded<HHC_64BIT_ENCODED_LENGTH, BASE>(input, symbols_.data(), pairs_.data(),
+                                                                           output_string);
+        }
+
+        /**
+         * @brief Decode a 64-bit integer from an 11-character string without validation
+         * @param input_string The input string to decode
+         * @return The decoded 64-bit integer
+         */
+        uint64_t decode_64bit_unsafe(const char* input_string) const {
+            HHC_ASSERT(input_string != nullptr);
+            return detail::decode_digits<HHC_64BIT_ENCODED_LENGTH, BASE, uint64_t>(input_string, inverse_.data());
+        }
+
+        /**
+         * @brief Decode a 64-bit integer from a padded or unpadded string
+         * @param input_string The input string to decode
+         * @return The decoded 64-bit integer
+         * @throws std::invalid_argument if the string is invalid
+         * @throws std::out_of_range if the string exceeds 64-bit bounds
+         */
+        uint64_t decode_64bit(const char* input_string) const {
+            return detail::decode_checked<HHC_64BIT_ENCODED_LENGTH, BASE, uint64_t>(input_string, inverse_.data(),
+                                                                                    hhc64_codec::MAX_DIGITS);
+        }
+
+        /**
+         * @brief Validate a null-terminated string against this codec's alphabet
+         * @return The length of the valid string, 0 if the string is invalid
+         */
+        std::size_t validate(const char* input_string) const {
+            HHC_ASSERT(input_string != nullptr);
+            return detail::validate_symbols(input_string, inverse_.data());
+        }
+
+        /**
+         * @brief Encode count 32-bit values into back-to-back 6-character records
+         * @param output The output buffer (at least count * HHC_32BIT_ENCODED_LENGTH bytes)
+         */
+        void encode_32bit_padded_batch(const uint32_t* inputs, std::size_t count, char* output) const {
+            HHC_ASSERT(count == 0 || (inputs != nullptr && output != nullptr));
+            for (std::size_t i = 0; i < count; ++i) {
+                detail::encode_digits<HHC_32BIT_ENCODED_LENGTH, BASE>(inputs[i], symbols_.data(), pairs_.data(),
+                                                                      output + i * HHC_32BIT_ENCODED_LENGTH);
+            }
+        }
+
+        /**
+         * @brief Decode count back-to-back 6-character records with validation
+         * @throws std::invalid_argument if a record contains a character outside the alphabet
+         * @throws std::out_of_range if a record exceeds 32-bit bounds
+         */
+        void decode_32bit_batch(const char* input, std::size_t count, uint32_t* outputs) const {
+            HHC_ASSERT(count == 0 || (input != nullptr && outputs != nullptr));
+            for (std::size_t i = 0; i < count; ++i) {
+                outputs[i] = detail::decode_record_checked<HHC_32BIT_ENCODED_LENGTH, BASE, uint32_t>(
+                    input + i * HHC_32BIT_ENCODED_LENGTH, inverse_.data(), hhc32_codec::MAX_DIGITS);
+            }
+        }
+
+        /**
+         * @brief Encode count 64-bit values into back-to-back 11-character records
+         * @param output The output buffer (at least count * HHC_64BIT_ENCODED_LENGTH bytes)
+         */
+        void encode_64bit_padded_batch(const uint64_t* inputs, std::size_t count, char* output) const {
+            HHC_ASSERT(count == 0 || (inputs != nullptr && output != nullptr));
+            for (std::size_t i = 0; i < count; ++i) {
+                detail::encode_digits<HHC_64BIT_ENCODED_LENGTH, BASE>(inputs[i], symbols_.data(), pairs_.data(),
+                                                                      output + i * HHC_64BIT_ENCODED_LENGTH);
+            }
+        }
+
+        /**
+         * @brief Decode count back-to-back 11-character records with validation
+         * @throws std::invalid_argument if a record contains a character outside the alphabet
+         * @throws std::out_of_range if a record exceeds 64-bit bounds
+         */
+        void decode_64bit_batch(const char* input, std::size_t count, uint64_t* outputs) const {
+            HHC_ASSERT(count == 0 || (input != nullptr && outputs != nullptr));
+            for (std::size_t i = 0; i < count; ++i) {
+                outputs[i] = detail::decode_record_checked<HHC_64BIT_ENCODED_LENGTH, BASE, uint64_t>(
+                    input + i * HHC_64BIT_ENCODED_LENGTH, inverse_.data(), hhc64_codec::MAX_DIGITS);
+            }
+        }
+
+    private:
+        std::array<char, BASE> symbols_{};
+        std::array<uint8_t, 256> inverse_{};
+        std::array<char, 2 * BASE * BASE> pairs_{};
+    };
+
+} // namespace hhc
+
+#endif // HHC_RUNTIME_CODEC_HPP
@@ -0,0 +1,448 @@
+#ifndef HHC_SHM_ALLOCATOR_HPP
+#define HHC_SHM_ALLOCATOR_HPP
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define HHC_HAVE_SHM_ALLOCATOR 1
+#else
+    // POSIX shared memory is not available (e.g. Windows)
+    #define HHC_HAVE_SHM_ALLOCATOR 0
+#endif
+
+#if HHC_HAVE_SHM_ALLOCATOR
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "hhc_assert.hpp"
+#include "hhc_codec.hpp"
+#include "hhc_sequence.hpp"
+
+namespace hhc {
+
+    /**
+     * @brief Settings for shm_id_allocator; every process sharing a segment should use the same ones
+     */
+    struct shm_allocator_options {
+        /// IDs each local() allocator takes from the segment at a time
+        uint64_t block_size = 4096;
+        /// File that keeps the high-water mark across restarts (empty: IDs restart from first_id with the segment)
+        std::string checkpoint_path;
+        /// IDs reserved by each checkpoint write; a crash skips at most this many
+        uint64_t checkpoint_interval = uint64_t{1} << 20;
+        /// The first ID of a new segment (a checkpoint, when present and larger, takes precedence)
+        uint64_t first_id = 0;
+        /// How long to wait for another process to finish creating the segment
+        std::chrono::milliseconds open_timeout{1000};
+    };
+
+    /**
+     * @brief A run of consecutive IDs [first, first + count)
+     */
+    struct id_block {
+        uint64_t first;
+        uint64_t count;
+    };
+
+    namespace detail {
+
+        /// "HHCALLOC" in ASCII, stored last by the process that creates a segment
+        inline constexpr uint64_t SHM_SEGMENT_MAGIC = 0x434F4C4C41434848ULL;
+
+        /**
+         * @brief Layout of the shared segment; the counters get their own cache lines
+         */
+        struct shm_segment {
+            std::atomic<uint64_t> magic;
+            alignas(64) std::atomic<uint64_t> next;
+            alignas(64) std::atomic<uint64_t> reserved;
+        };
+        static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                      "Cross-process atomics must be lock-free");
+
+        [[noreturn]] inline void throw_system_error(const char* what) {
+            throw std::system_error(errno, std::generic_category(), what);
+        }
+
+        /// Closes a file descriptor (and drops its flock) on scope exit
+        struct fd_guard {
+            int fd;
+            ~fd_guard() {
+                if (fd >= 0) {
+                    ::close(fd);
+                }
+            }
+        };
+
+        /// Holds an exclusive flock on a file descriptor until scope exit
+        struct flock_guard {
+            int fd;
+            explicit flock_guard(int lock_fd) : fd(lock_fd) {
+                if (::flock(fd, LOCK_EX) != 0) {
+                    throw_system_error("flock checkpoint");
+                }
+            }
+            ~flock_guard() { ::flock(fd, LOCK_UN); }
+            flock_guard(const flock_guard&) = delete;
+            flock_guard& operator=(const flock_guard&) = delete;
+        };
+
+        /**
+         * @brief The high-water mark stored at path, or 0 if there is no checkpoint yet
+         * @throws std::invalid_argument if the file does not hold a padded 64-bit HHC value
+         */
+        inline uint64_t read_checkpoint(const std::string& path) {
+            const fd_guard file{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+            if (file.fd < 0) {
+                if (errno == ENOENT) {
+                    return 0;
+                }
+                throw_system_error("open checkpoint");
+            }
+            char text[hhc64_codec::ENCODED_LENGTH + 1] = {};
+            const ssize_t length = ::read(file.fd, text, sizeof(text));
+            if (length < 0) {
+                throw_system_error("read checkpoint");
+            }
+            return hhc64_codec::decode(text, static_cast<std::size_t>(length) < hhc64_codec::ENCODED_LENGTH
+                                                 ? static_cast<std::size_t>(length)
+                                                 : hhc64_codec::ENCODED_LENGTH);
+        }
+
+        /**
+         * @brief Durably replace the checkpoint at path with mark (write, fsync, rename, fsync the directory)
+         */
+        inline void write_checkpoint(const std::string& path, uint64_t mark) {
+            const std::string temporary = path + ".tmp";
+            {
+                const fd_guard file{::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)};
+                if (file.fd < 0) {
+                    throw_system_error("open checkpoint");
+                }
+                char text[hhc64_codec::ENCODED_LENGTH + 1];
+                hhc64_codec::encode_padded(mark, text);
+                text[hhc64_codec::ENCODED_LENGTH] = '\n';
+                if (::write(file.fd, text, sizeof(text)) != static_cast<ssize_t>(sizeof(text)) || ::fsync(file.fd) != 0) {
+                    throw_system_error("write checkpoint");
+                }
+            }
+            if (::rename(temporary.c_str(), path.c_str()) != 0) {
+                throw_system_error("rename checkpoint");
+            }
+            const std::size_t slash = path.rfind('/');
+            const std::string directory = slash == std::string::npos ? "." : slash == 0 ? "/" : path.substr(0, slash);
+            const fd_guard parent{::open(directory.c_str(), O_RDONLY | O_CLOEXEC)};
+            if (parent.fd >= 0) {
+                ::fsync(parent.fd);
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Hands out unique, increasing IDs to every process on a host through a POSIX shared memory segment
+     *
+     * The segment holds one atomic counter. Allocating a block is a single fetch-add on it, with
+     * no lock and no round trip to a central service. local() allocators take blocks of
+     * block_size IDs and increment the padded encoding in place within a block, so encoding a
+     * new ID is an odometer step.
+     *
+     * With a checkpoint_path, the segment also holds a high-water mark that is written to that
+     * file before any ID above it is handed out. Each write reserves checkpoint_interval more IDs,
+     * so writes are rare and the hot path never touches the file. After a crash or reboot, a new
+     * segment starts from the checkpointed mark: IDs are never reused, and at most one interval
+     * is skipped. Checkpoint writers are serialized with flock on path + ".lock", which the
+     * kernel releases if a writer dies.
+     *
+     * A process that dies while creating the segment leaves it uninitialized. With a checkpoint,
+     * segments are created under the same lock, so the next process to open the segment replaces
+     * it. Without one, opening fails with ETIMEDOUT until the segment is remove()d.
+     *
+     * Example:
+     *   hhc::shm_id_allocator allocator("/orders-ids", {4096, "/var/lib/orders/ids.checkpoint"});
+     *   auto ids = allocator.local();
+     *   char key[hhc::hhc64_codec::ENCODED_LENGTH];
+     *   uint64_t id = ids.next(key);
+     *
+     * @note Available where HHC_HAVE_SHM_ALLOCATOR is 1 (POSIX systems); link librt on glibc before 2.34
+     */
+    class shm_id_allocator {
+    public:
+        /**
+         * @brief Takes IDs block by block from the segment; use from one thread only
+         */
+        class local_allocator {
+        public:
+            /// The moved-from allocator gives up its block, so no ID is handed out twice
+            local_allocator(local_allocator&& other) noexcept
+                : shared_(other.shared_), next_(other.next_), end_(other.end_), encoder_(other.encoder_) {
+                other.next_ = other.end_;
+            }
+            local_allocator& operator=(local_allocator&&) = delete;
+
+            /**
+             * @brief The next ID
+             * @throws std::out_of_range if the 64-bit ID space is exhausted
+             * @throws std::system_error if a checkpoint cannot be written
+             */
+            uint64_t next() {
+                advance();
+                return encoder_.value();
+            }
+
+            /**
+             * @brief The next ID, with its padded encoding written to output
+             * @note The output string is not null-terminated
+             * @param output The output string (at least 11 bytes)
+             */
+            uint64_t next(char* output) {
+                advance();
+                encoder_.write(output);
+                return encoder_.value();
+            }
+
+        private:
+            friend class shm_id_allocator;
+
+            explicit local_allocator(shm_id_allocator* shared) : shared_(shared) {}
+
+            void advance() {
+                if (next_ != end_) {
+                    ++next_;
+                    ++encoder_;
+                    return;
+                }
+                const id_block block = shared_->allocate(shared_->options_.block_size);
+                next_ = block.first + 1;
+                end_ = block.first + block.count;
+                encoder_.reset(block.first);
+            }
+
+            shm_id_allocator* shared_;
+            /// IDs still to hand out: [next_, end_)
+            uint64_t next_ = 0;
+            uint64_t end_ = 0;
+            sequence_encoder encoder_;
+        };
+
+        /**
+         * @brief Open the segment called name, creating it if no other process has
+         * @param name A shm_open name such as "/my-ids"
+         * @param options Block size, checkpoint file and starting ID
+         * @throws std::invalid_argument if block_size or checkpoint_interval is 0, or the checkpoint file is corrupt
+         * @throws std::system_error if the segment or checkpoint file cannot be opened, or (without a
+         *                           checkpoint) another process does not finish creating the segment
+         *                           within open_timeout
+         */
+        explicit shm_id_allocator(const std::string& name, shm_allocator_options options = {})
+            : options_(std::move(options)) {
+            if (options_.block_size == 0 || options_.checkpoint_interval == 0) {
+                throw std::invalid_argument("shm_id_allocator block_size and checkpoint_interval must be positive");
+            }
+            if (!options_.checkpoint_path.empty()) {
+                lock_fd_ = ::open((options_.checkpoint_path + ".lock").c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+                if (lock_fd_ < 0) {
+                    detail::throw_system_error("open checkpoint lock");
+                }
+            }
+            try {
+                open_segment(name);
+            } catch (...) {
+                release();
+                throw;
+            }
+        }
+
+        ~shm_id_allocator() { release(); }
+
+        shm_id_allocator(const shm_id_allocator&) = delete;
+        shm_id_allocator& operator=(const shm_id_allocator&) = delete;
+
+        /**
+         * @brief Delete the segment called name; processes that have it open keep using it
+         * @return Whether a segment was removed
+         */
+        static bool remove(const std::string& name) { return ::shm_unlink(name.c_str()) == 0; }
+
+        /**
+         * @brief Take count consecutive IDs
+         * @throws std::out_of_range if the 64-bit ID space is exhausted
+         * @throws std::system_error if a checkpoint cannot be written
+         */
+        id_block allocate(uint64_t count) {
+            HHC_ASSERT(count > 0);
+            // Never let the counter wrap: later callers would be handed IDs from the start again
+            uint64_t first = segment_->next.load(std::memory_order_relaxed);
+            do {
+                if (first > std::numeric_limits<uint64_t>::max() - count) {
+                    detail::throw_out_of_range("shm_id_allocator ID space exhausted");
+                }
+            } while (!segment_->next.compare_exchange_weak(first, first + count, std::memory_order_relaxed));
+            if (first + count > segment_->reserved.load(std::memory_order_acquire)) {
+                checkpoint(first + count);
+            }
+            return {first, count};
+        }
+
+        /**
+         * @brief An allocator for the calling thread that takes block_size IDs at a time
+         * @note The local allocator refers to this one, which must outlive it
+         */
+        local_allocator local() { return local_allocator(this); }
+
+        /// The next ID the segment will hand out
+        uint64_t peek() const noexcept { return segment_->next.load(std::memory_order_relaxed); }
+
+        /// IDs below this mark are covered by the checkpoint file
+        uint64_t high_water_mark() const noexcept { return segment_->reserved.load(std::memory_order_acquire); }
+
+        const shm_allocator_options& options() const noexcept { return options_; }
+
+    private:
+        void open_segment(const std::string& name) {
+            if (lock_fd_ < 0) {
+                if (!map_segment(name, std::chrono::steady_clock::now() + options_.open_timeout)) {
+                    throw_uninitialized(name);
+                }
+                return;
+            }
+            // Segments are created under the checkpoint lock, so one that is still uninitialized
+            // once this process holds the lock belongs to a creator that died: replace it. The new
+            // segment starts from the checkpoint, so no ID the dead one handed out is reused.
+            const detail::flock_guard lock(lock_fd_);
+            if (!map_segment(name, std::chrono::steady_clock::now())) {
+                ::shm_unlink(name.c_str());
+                if (!map_segment(name, std::chrono::steady_clock::now())) {
+                    throw_uninitialized(name);
+                }
+            }
+        }
+
+        /**
+         * @brief Map the segment called name, creating and initializing it if it does not exist
+         * @return false if the segment exists but is still uninitialized at deadline
+         */
+        bool map_segment(const std::string& name, std::chrono::steady_clock::time_point deadline) {
+            // Read the checkpoint first, so a bad file cannot leave a created but uninitialized segment
+            const uint64_t start = options_.checkpoint_path.empty()
+                                       ? options_.first_id
+                                       : std::max(options_.first_id, detail::read_checkpoint(options_.checkpoint_path));
+            bool created = true;
+            int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+            if (fd < 0 && errno == EEXIST) {
+                created = false;
+                fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+            }
+            if (fd < 0) {
+                detail::throw_system_error("shm_open");
+            }
+            const detail::fd_guard segment_fd{fd};
+
+            if (created) {
+                if (::ftruncate(fd, sizeof(detail::shm_segment)) != 0) {
+                    detail::throw_system_error("ftruncate");
+                }
+            } else {
+                // The creating process may not have sized the segment yet
+                struct stat info {};
+                while (::fstat(fd, &info) == 0 && static_cast<std::size_t>(info.st_size) < sizeof(detail::shm_segment)) {
+                    if (!wait_until(deadline)) {
+                        return false;
+                    }
+                }
+            }
+            void* mapping = ::mmap(nullptr, sizeof(detail::shm_segment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (mapping == MAP_FAILED) {
+                detail::throw_system_error("mmap");
+            }
+            auto* segment = static_cast<detail::shm_segment*>(mapping);
+
+            if (created) {
+                // ftruncate zero-fills the segment, so only the counters need setting
+                segment->next.store(start, std::memory_order_relaxed);
+                segment->reserved.store(options_.checkpoint_path.empty() ? std::numeric_limits<uint64_t>::max() : start,
+                                        std::memory_order_relaxed);
+                segment->magic.store(detail::SHM_SEGMENT_MAGIC, std::memory_order_release);
+            } else {
+                while (segment->magic.load(std::memory_order_acquire) != detail::SHM_SEGMENT_MAGIC) {
+                    if (!wait_until(deadline)) {
+                        ::munmap(mapping, sizeof(detail::shm_segment));
+                        return false;
+                    }
+                }
+            }
+            segment_ = segment;
+            return true;
+        }
+
+        /// Sleeps briefly, or returns false once deadline has passed
+        static bool wait_until(std::chrono::steady_clock::time_point deadline) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            return true;
+        }
+
+        [[noreturn]] static void throw_uninitialized(const std::string& name) {
+            throw std::system_error(ETIMEDOUT, std::generic_category(),
+                                    "shm_id_allocator segment " + name +
+                                        " was not initialized (remove() it if its creator died)");
+        }
+
+        /**
+         * @brief Make the checkpoint cover every ID below end before any of them is handed out
+         */
+        void checkpoint(uint64_t end) {
+            // flock locks belong to the open file, which every thread of this process shares
+            const std::lock_guard<std::mutex> thread_lock(checkpoint_mutex_);
+            const detail::flock_guard process_lock(lock_fd_);
+
+            // Another thread or process may have moved the mark past end while this one waited for the locks
+            const uint64_t reserved = segment_->reserved.load(std::memory_order_acquire);
+            if (reserved >= end) {
+                return;
+            }
+            const uint64_t headroom = std::numeric_limits<uint64_t>::max() - end;
+            const uint64_t mark = end + (options_.checkpoint_interval < headroom ? options_.checkpoint_interval : headroom);
+            detail::write_checkpoint(options_.checkpoint_path, mark);
+            segment_->reserved.store(mark, std::memory_order_release);
+        }
+
+        void release() noexcept {
+            if (segment_ != nullptr) {
+                ::munmap(segment_, sizeof(detail::shm_segment));
+                segment_ = nullptr;
+            }
+            if (lock_fd_ >= 0) {
+                ::close(lock_fd_);
+                lock_fd_ = -1;
+            }
+        }
+
+        shm_allocator_options options_;
+        detail::shm_segment* segment_ = nullptr;
+        int lock_fd_ = -1;
+        /// Serializes checkpoints between threads; lock_fd_ serializes them between processes
+        std::mutex checkpoint_mutex_;
+    };
+
+} // namespace hhc
+
+#endif // HHC_HAVE_SHM_ALLOCATOR
+
+#endif // HHC_SHM_ALLOCATOR_HPP
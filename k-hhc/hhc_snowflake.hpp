@@ -0,0 +1,231 @@
+#ifndef HHC_SNOWFLAKE_HPP
+#define HHC_SNOWFLAKE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include "hhc_assert.hpp"
+#include "hhc_codec.hpp"
+#include "hhc_sequence.hpp"
+
+namespace hhc {
+
+    /// Bits of a snowflake ID holding milliseconds since the generator's epoch
+    inline constexpr unsigned SNOWFLAKE_TIMESTAMP_BITS = 41;
+    /// Bits of a snowflake ID holding the worker number
+    inline constexpr unsigned SNOWFLAKE_WORKER_BITS = 10;
+    /// Bits of a snowflake ID holding the per-millisecond sequence number
+    inline constexpr unsigned SNOWFLAKE_SEQUENCE_BITS = 12;
+
+    /// Default epoch: 2020-01-01T00:00:00Z, in milliseconds since the Unix epoch
+    inline constexpr int64_t SNOWFLAKE_DEFAULT_EPOCH = 1577836800000;
+
+    /// IDs a local generator reserves from the shared counter at a time
+    inline constexpr uint64_t SNOWFLAKE_BLOCK_SIZE = 64;
+
+    /**
+     * @brief The fields of a snowflake ID
+     */
+    struct snowflake_parts {
+        int64_t timestamp; ///< Milliseconds since the Unix epoch
+        uint32_t worker;
+        uint32_t sequence;
+    };
+
+    /**
+     * @brief Time-ordered 64-bit IDs (timestamp, worker, sequence) with their padded HHC encoding
+     *
+     * An ID is 41 bits of milliseconds since the epoch, 10 bits of worker number and 12 bits of
+     * sequence, with the top bit clear. IDs sort by creation time, and so do their padded
+     * encodings.
+     *
+     * The generator is lock-free. Its only shared state is one atomic counter over (timestamp,
+     * sequence) pairs, which never moves backwards: it jumps forward to the clock when the clock
+     * is ahead, stays put when the clock steps back, and runs into the next millisecond when 4096
+     * IDs are taken in one. Threads call local() once and take IDs from the returned generator.
+     * It reserves blocks of up to 64 consecutive IDs with a single compare-and-swap and
+     * increments the padded encoding in place within a block, so only the first ID of a block is
+     * fully encoded.
+     *
+     * Example:
+     *   static hhc::snowflake_generator generator(worker_id);
+     *   thread_local auto ids = generator.local();
+     *   char key[hhc::hhc64_codec::ENCODED_LENGTH];
+     *   uint64_t id = ids.next(key);
+     *
+     * @tparam Clock A clock whose now() is measured from the Unix epoch (for tests)
+     */
+    template <typename Clock = std::chrono::system_clock>
+    class basic_snowflake_generator {
+        static constexpr uint64_t SEQUENCE_COUNT = uint64_t{1} << SNOWFLAKE_SEQUENCE_BITS;
+        static constexpr int64_t MAX_TIMESTAMP = (int64_t{1} << SNOWFLAKE_TIMESTAMP_BITS) - 1;
+
+    public:
+        using clock_type = Clock;
+
+        static constexpr uint32_t MAX_WORKER = (uint32_t{1} << SNOWFLAKE_WORKER_BITS) - 1;
+
+        /**
+         * @brief Hands out IDs from blocks reserved on the shared generator; use from one thread only
+         */
+        class local_generator {
+        public:
+            /// The moved-from generator gives up its block, so no ID is handed out twice
+            local_generator(local_generator&& other) noexcept
+                : shared_(other.shared_), next_(other.next_), end_(other.end_), encoder_(other.encoder_) {
+                other.next_ = other.end_;
+            }
+            local_generator& operator=(local_generator&&) = delete;
+
+            /**
+             * @brief The next ID
+             * @throws std::out_of_range if the clock is before the epoch or the timestamp field is exhausted
+             */
+            uint64_t next() {
+                advance();
+                return encoder_.value();
+            }
+
+            /**
+             * @brief The next ID, with its padded encoding written to output
+             * @note The output string is not null-terminated
+             * @param output The output string (at least 11 bytes)
+             * @throws std::out_of_range if the clock is before the epoch or the timestamp field is exhausted
+             */
+            uint64_t next(char* output) {
+                advance();
+                encoder_.write(output);
+                return encoder_.value();
+            }
+
+            /**
+             * @brief The padded encoding of the ID most recently returned by next()
+             */
+            std::string_view view() const noexcept { return encoder_.view(); }
+
+        private:
+            friend class basic_snowflake_generator;
+
+            explicit local_generator(basic_snowflake_generator* shared) : shared_(shared) {}
+
+            void advance() {
+                // A block stays usable while its timestamp has not fallen behind the clock
+                const int64_t now = shared_->elapsed();
+                if (next_ != end_ && static_cast<int64_t>(next_ / SEQUENCE_COUNT) >= now) {
+                    ++next_;
+                    ++encoder_;
+                    return;
+                }
+                const uint64_t start = shared_->reserve(now, SNOWFLAKE_BLOCK_SIZE);
+                end_ = start + std::min(SNOWFLAKE_BLOCK_SIZE, SEQUENCE_COUNT - start % SEQUENCE_COUNT);
+                next_ = start + 1;
+                encoder_.reset(shared_->compose(start));
+            }
+
+            basic_snowflake_generator* shared_;
+            /// Counter values still to hand out: [next_, end_)
+            uint64_t next_ = 0;
+            uint64_t end_ = 0;
+            sequence_encoder encoder_;
+        };
+
+        /**
+         * @param worker This process's worker number (0 to 1023), unique among concurrent generators
+         * @param epoch Milliseconds since the Unix epoch that timestamps count from
+         * @throws std::out_of_range if worker is above 1023
+         */
+        explicit basic_snowflake_generator(uint32_t worker, int64_t epoch = SNOWFLAKE_DEFAULT_EPOCH)
+            : worker_(worker), epoch_(epoch) {
+            if (worker > MAX_WORKER) {
+                detail::throw_out_of_range("Snowflake worker number exceeds 10 bits");
+            }
+        }
+
+        basic_snowflake_generator(const basic_snowflake_generator&) = delete;
+        basic_snowflake_generator& operator=(const basic_snowflake_generator&) = delete;
+
+        uint32_t worker() const noexcept { return worker_; }
+        int64_t epoch() const noexcept { return epoch_; }
+
+        /**
+         * @brief A generator for the calling thread that takes IDs in blocks
+         * @note The local generator refers to this one, which must outlive it
+         */
+        local_generator local() { return local_generator(this); }
+
+        /**
+         * @brief The next ID, taken straight from the shared counter (one compare-and-swap per ID)
+         * @throws std::out_of_range if the clock is before the epoch or the timestamp field is exhausted
+         */
+        uint64_t next() { return compose(reserve(elapsed(), 1)); }
+
+        /**
+         * @brief The next ID, with its padded encoding written to output
+         * @note The output string is not null-terminated
+         * @param output The output string (at least 11 bytes)
+         */
+        uint64_t next(char* output) {
+            const uint64_t id = next();
+            hhc64_codec::encode_padded(id, output);
+            return id;
+        }
+
+        /**
+         * @brief Split an ID made by a generator with the given epoch into its fields
+         */
+        static constexpr snowflake_parts parse(uint64_t id, int64_t epoch = SNOWFLAKE_DEFAULT_EPOCH) noexcept {
+            return {static_cast<int64_t>(id >> (SNOWFLAKE_WORKER_BITS + SNOWFLAKE_SEQUENCE_BITS)) + epoch,
+                    static_cast<uint32_t>((id >> SNOWFLAKE_SEQUENCE_BITS) & MAX_WORKER),
+                    static_cast<uint32_t>(id & (SEQUENCE_COUNT - 1))};
+        }
+
+    private:
+        /// Milliseconds since the epoch according to Clock
+        int64_t elapsed() const {
+            const auto since_unix = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now().time_since_epoch());
+            const int64_t now = static_cast<int64_t>(since_unix.count()) - epoch_;
+            if (now < 0) {
+                detail::throw_out_of_range("Snowflake clock is before the epoch");
+            }
+            return now;
+        }
+
+        /**
+         * @brief Reserve up to count consecutive IDs of one millisecond, no earlier than now
+         * @return The counter value (timestamp * 4096 + sequence) of the first reserved ID
+         */
+        uint64_t reserve(int64_t now, uint64_t count) {
+            const uint64_t floor = static_cast<uint64_t>(now) * SEQUENCE_COUNT;
+            uint64_t current = counter_.load(std::memory_order_relaxed);
+            uint64_t start = 0;
+            uint64_t end = 0;
+            do {
+                start = std::max(current, floor);
+                end = start + std::min(count, SEQUENCE_COUNT - start % SEQUENCE_COUNT);
+            } while (!counter_.compare_exchange_weak(current, end, std::memory_order_relaxed));
+            if (static_cast<int64_t>(start / SEQUENCE_COUNT) > MAX_TIMESTAMP) {
+                detail::throw_out_of_range("Snowflake timestamp exceeds 41 bits");
+            }
+            return start;
+        }
+
+        /// The ID for a counter value
+        uint64_t compose(uint64_t counter) const noexcept {
+            return (counter / SEQUENCE_COUNT) << (SNOWFLAKE_WORKER_BITS + SNOWFLAKE_SEQUENCE_BITS) |
+                   uint64_t{worker_} << SNOWFLAKE_SEQUENCE_BITS | counter % SEQUENCE_COUNT;
+        }
+
+        const uint32_t worker_;
+        const int64_t epoch_;
+        /// Next free (timestamp * 4096 + sequence); only ever moves forward
+        std::atomic<uint64_t> counter_{0};
+    };
+
+    using snowflake_generator = basic_snowflake_generator<>;
+
+} // namespace hhc
+
+#endif // HHC_SNOWFLAKE_HPP
@@ -0,0 +1,239 @@
+#ifndef HHC_SORT_HPP
+#define HHC_SORT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "hhc_assert.hpp"
+#include "hhc_codec.hpp"
+
+namespace hhc {
+
+    namespace detail {
+
+        /// Records below which sort_encoded stays on the calling thread by default
+        inline constexpr std::size_t SORT_PARALLEL_THRESHOLD = std::size_t{1} << 20;
+
+        /// Keys below which a comparison sort beats the radix passes
+        inline constexpr std::size_t SORT_RADIX_THRESHOLD = 256;
+
+        /// Bits of the key consumed per radix pass
+        inline constexpr unsigned RADIX_BITS = 8;
+        inline constexpr std::size_t RADIX_BUCKETS = std::size_t{1} << RADIX_BITS;
+
+        /**
+         * @brief First index of slice `worker` when count items are split evenly over workers
+         */
+        constexpr std::size_t slice_begin(std::size_t count, unsigned worker, unsigned workers) {
+            return count / workers * worker + std::min<std::size_t>(worker, count % workers);
+        }
+
+        /**
+         * @brief Run function(worker) for every worker in [0, workers), worker 0 on the calling thread
+         *
+         * Workers whose thread cannot be started run on the calling thread instead, so every
+         * worker runs exactly once.
+         *
+         * @throws Whatever the first failing worker threw, after every worker has finished
+         */
+        template <typename Function>
+        void parallel_for(unsigned workers, const Function& function) {
+            if (workers <= 1) {
+                function(0U);
+                return;
+            }
+            std::vector<std::exception_ptr> errors(workers);
+            const auto guarded = [&](unsigned worker) {
+                try {
+                    function(worker);
+                } catch (...) {
+                    errors[worker] = std::current_exception();
+                }
+            };
+
+            // Joins on every exit, so no path destroys a joinable thread (which would call std::terminate)
+            struct joiner {
+                std::vector<std::thread> threads;
+                ~joiner() {
+                    for (auto& thread : threads) {
+                        if (thread.joinable()) {
+                            thread.join();
+                        }
+                    }
+                }
+            } started;
+
+            unsigned spawned = 1;
+            try {
+                started.threads.reserve(workers - 1);
+                for (; spawned < workers; ++spawned) {
+                    started.threads.emplace_back(guarded, spawned);
+                }
+            } catch (...) {
+                // Out of threads or memory: the remaining workers run here
+            }
+            for (unsigned worker = spawned; worker < workers; ++worker) {
+                guarded(worker);
+            }
+            guarded(0U);
+            for (auto& thread : started.threads) {
+                thread.join();
+            }
+            for (const auto& error : errors) {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
+        }
+
+        /**
+         * @brief Stable LSD radix sort of unsigned keys, one byte per pass
+         *
+         * Every pass splits the keys into one slice per worker: each worker counts its slice,
+         * the counts are turned into per-worker bucket offsets, and each worker scatters its
+         * slice. Passes whose byte is the same for every key (the high bytes of sequential IDs)
+         * are skipped.
+         *
+         * @param keys The keys to sort
+         * @param scratch A buffer of count keys
+         * @param count The number of keys
+         * @param workers The number of threads to use
+         */
+        template <typename UInt>
+        void radix_sort(UInt* keys, UInt* scratch, std::size_t count, unsigned workers) {
+            constexpr unsigned PASSES = sizeof(UInt) * 8 / RADIX_BITS;
+            using histogram = std::array<std::size_t, RADIX_BUCKETS>;
+
+            // Bucket totals are the same whatever the order, so one read finds the passes to skip
+            std::vector<std::array<histogram, PASSES>> totals(workers);
+            parallel_for(workers, [&](unsigned worker) {
+                auto& counts = totals[worker];
+                for (auto& pass_counts : counts) {
+                    pass_counts.fill(0);
+                }
+                const std::size_t end = slice_begin(count, worker + 1, workers);
+                for (std::size_t i = slice_begin(count, worker, workers); i < end; ++i) {
+                    for (unsigned pass = 0; pass < PASSES; ++pass) {
+                        ++counts[pass][(keys[i] >> (pass * RADIX_BITS)) & (RADIX_BUCKETS - 1)];
+                    }
+                }
+            });
+            for (unsigned worker = 1; worker < workers; ++worker) {
+                for (unsigned pass = 0; pass < PASSES; ++pass) {
+                    for (std::size_t bucket = 0; bucket < RADIX_BUCKETS; ++bucket) {
+                        totals[0][pass][bucket] += totals[worker][pass][bucket];
+                    }
+                }
+            }
+
+            UInt* source = keys;
+            UInt* destination = scratch;
+            std::vector<histogram> offsets(workers);
+            for (unsigned pass = 0; pass < PASSES; ++pass) {
+                const histogram& total = totals[0][pass];
+                if (std::find(total.begin(), total.end(), count) != total.end()) {
+                    continue;
+                }
+                const unsigned shift = pass * RADIX_BITS;
+
+                if (workers == 1) {
+                    offsets[0] = total;
+                } else {
+                    parallel_for(workers, [&](unsigned worker) {
+                        histogram& counts = offsets[worker];
+                        counts.fill(0);
+                        const std::size_t end = slice_begin(count, worker + 1, workers);
+                        for (std::size_t i = slice_begin(count, worker, workers); i < end; ++i) {
+                            ++counts[(source[i] >> shift) & (RADIX_BUCKETS - 1)];
+                        }
+                    });
+                }
+
+                // Exclusive prefix sum, bucket-major then worker-major, keeps the sort stable
+                std::size_t running = 0;
+                for (std::size_t bucket = 0; bucket < RADIX_BUCKETS; ++bucket) {
+                    for (unsigned worker = 0; worker < workers; ++worker) {
+                        const std::size_t bucket_count = offsets[worker][bucket];
+                        offsets[worker][bucket] = running;
+                        running += bucket_count;
+                    }
+                }
+
+                parallel_for(workers, [&](unsigned worker) {
+                    histogram& next = offsets[worker];
+                    const std::size_t end = slice_begin(count, worker + 1, workers);
+                    for (std::size_t i = slice_begin(count, worker, workers); i < end; ++i) {
+                        const UInt key = source[i];
+                        destination[next[(key >> shift) & (RADIX_BUCKETS - 1)]++] = key;
+                    }
+                });
+                std::swap(source, destination);
+            }
+
+            if (source != keys) {
+                std::copy(source, source + count, keys);
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Sort back-to-back padded records in ascending numeric order
+     *
+     * The records are decoded into integer keys, radix sorted, and encoded back in place. For
+     * the ASCII-ordered HHC alphabet numeric order is also byte order, so the result matches a
+     * std::sort of the records as strings. Inputs of at least 2^20 records are sorted on every
+     * hardware thread unless threads says otherwise.
+     *
+     * @tparam Codec A basic_codec instantiation (defaults to 64-bit HHC)
+     * @param records The records to sort (count * ENCODED_LENGTH bytes)
+     * @param count The number of records
+     * @param threads The number of threads to use (0 picks one from the input size)
+     * @throws std::invalid_argument if a record contains a character outside the alphabet
+     * @throws std::out_of_range if a record exceeds the bounds of the codec
+     * @note The records are left untouched if this throws
+     */
+    template <typename Codec = hhc64_codec>
+    void sort_encoded(char* records, std::size_t count, unsigned threads = 0) {
+        using UInt = typename Codec::value_type;
+        constexpr std::size_t LENGTH = Codec::ENCODED_LENGTH;
+
+        HHC_ASSERT(count == 0 || records != nullptr);
+        if (count == 0) {
+            return;
+        }
+        unsigned workers = threads;
+        if (workers == 0) {
+            workers = count >= detail::SORT_PARALLEL_THRESHOLD ? std::max(1U, std::thread::hardware_concurrency()) : 1U;
+        }
+        workers = static_cast<unsigned>(std::min<std::size_t>(workers, count));
+
+        std::vector<UInt> keys(count);
+        detail::parallel_for(workers, [&](unsigned worker) {
+            const std::size_t begin = detail::slice_begin(count, worker, workers);
+            const std::size_t end = detail::slice_begin(count, worker + 1, workers);
+            Codec::decode_batch(records + begin * LENGTH, end - begin, keys.data() + begin);
+        });
+
+        if (count < detail::SORT_RADIX_THRESHOLD) {
+            std::sort(keys.begin(), keys.end());
+        } else {
+            std::vector<UInt> scratch(count);
+            detail::radix_sort(keys.data(), scratch.data(), count, workers);
+        }
+
+        detail::parallel_for(workers, [&](unsigned worker) {
+            const std::size_t begin = detail::slice_begin(count, worker, workers);
+            const std::size_t end = detail::slice_begin(count, worker + 1, workers);
+            Codec::encode_padded_batch(keys.data() + begin, end - begin, records + begin * LENGTH);
+        });
+    }
+
+} // namespace hhc
+
+#endif // HHC_SORT_HPP
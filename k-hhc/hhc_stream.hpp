@@ -0,0 +1,325 @@
+#ifndef HHC_STREAM_HPP
+#define HHC_STREAM_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include "hhc_constants.hpp"
+#include "hhc_assert.hpp"
+#include "hhc_codec.hpp"
+
+namespace hhc {
+
+    /// Bytes per full input block of the stream format
+    constexpr size_t HHC_STREAM_BLOCK_BYTES = 8;
+    /// Characters per full output block of the stream format
+    constexpr size_t HHC_STREAM_BLOCK_LENGTH = HHC_64BIT_ENCODED_LENGTH;
+
+    namespace detail {
+
+        /// Characters used for a trailing block of n bytes (index n), the fewest digits covering 256^n values
+        inline constexpr std::array<uint8_t, HHC_STREAM_BLOCK_BYTES> STREAM_TAIL_LENGTH = {0, 2, 3, 4, 6, 7, 8, 10};
+
+        /// Bytes encoded by a trailing block of n characters (index n), 0xFF for lengths no tail produces
+        inline constexpr std::array<uint8_t, HHC_STREAM_BLOCK_LENGTH> STREAM_TAIL_BYTES = [] {
+            std::array<uint8_t, HHC_STREAM_BLOCK_LENGTH> bytes{};
+            for (auto& count : bytes) {
+                count = 0xFF;
+            }
+            for (uint8_t count = 0; count < HHC_STREAM_BLOCK_BYTES; ++count) {
+                bytes[STREAM_TAIL_LENGTH[count]] = count;
+            }
+            return bytes;
+        }();
+
+        [[noreturn]] inline void throw_invalid_stream_length(std::size_t length) {
+            throw std::invalid_argument("Invalid HHC stream (trailing block of " + std::to_string(length) +
+                                        " characters)");
+        }
+
+        /**
+         * @brief Encode count full blocks, reusing the 64-bit pair-table kernel
+         */
+        inline void stream_encode_blocks(const uint8_t* input, std::size_t count, char* output) {
+            const char* pairs = alphabet_tables<hhc_alphabet>::PAIRS.data();
+            for (std::size_t i = 0; i < count; ++i) {
+                const auto block = load_be<HHC_STREAM_BLOCK_BYTES, uint64_t>(
+                    reinterpret_cast<const char*>(input + i * HHC_STREAM_BLOCK_BYTES));
+                encode_digits<HHC_STREAM_BLOCK_LENGTH, BASE>(block, ALPHABET.data(), pairs,
+                                                             output + i * HHC_STREAM_BLOCK_LENGTH);
+            }
+        }
+
+        /**
+         * @brief Decode count full blocks with validation
+         * @throws std::invalid_argument if a block contains a character outside the alphabet
+         * @throws std::out_of_range if a block exceeds 64-bit bounds
+         */
+        inline void stream_decode_blocks(const char* input, std::size_t count, uint8_t* output) {
+            const uint8_t* inverse = alphabet_tables<hhc_alphabet>::INVERSE.data();
+            for (std::size_t i = 0; i < count; ++i) {
+                const auto block = decode_record_checked<HHC_STREAM_BLOCK_LENGTH, BASE, uint64_t>(
+                    input + i * HHC_STREAM_BLOCK_LENGTH, inverse, hhc64_codec::MAX_DIGITS);
+                store_be<HHC_STREAM_BLOCK_BYTES>(block, output + i * HHC_STREAM_BLOCK_BYTES);
+            }
+        }
+
+        /**
+         * @brief Encode a trailing block of 1-7 bytes into STREAM_TAIL_LENGTH[size] characters
+         */
+        inline void stream_encode_tail(const uint8_t* input, std::size_t size, char* output) {
+            uint64_t value = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                value = (value << 8) | input[i];
+            }
+            const char* pairs = alphabet_tables<hhc_alphabet>::PAIRS.data();
+            switch (size) {
+                case 1: encode_digits<2, BASE>(value, ALPHABET.data(), pairs, output); break;
+                case 2: encode_digits<3, BASE>(value, ALPHABET.data(), pairs, output); break;
+                case 3: encode_digits<4, BASE>(value, ALPHABET.data(), pairs, output); break;
+                case 4: encode_digits<6, BASE>(value, ALPHABET.data(), pairs, output); break;
+                case 5: encode_digits<7, BASE>(value, ALPHABET.data(), pairs, output); break;
+                case 6: encode_digits<8, BASE>(value, ALPHABET.data(), pairs, output); break;
+                case 7: encode_digits<10, BASE>(value, ALPHABET.data(), pairs, output); break;
+                default: break;
+            }
+        }
+
+        /**
+         * @brief Decode a trailing block of length characters
+         * @return The number of bytes written
+         * @throws std::invalid_argument if the length is not a tail length or a character is outside the alphabet
+         * @throws std::out_of_range if the block exceeds the bytes it stands for
+         */
+        inline std::size_t stream_decode_tail(const char* input, std::size_t length, uint8_t* output) {
+            const uint8_t size = STREAM_TAIL_BYTES[length];
+            if (size == 0xFF) {
+                throw_invalid_stream_length(length);
+            }
+            const uint8_t* inverse = alphabet_tables<hhc_alphabet>::INVERSE.data();
+            uint8_t combined = 0;
+            for (std::size_t pos = 0; pos < length; ++pos) {
+                combined |= inverse[static_cast<unsigned char>(input[pos])];
+            }
+            if ((combined & 0x80U) != 0) {
+                throw_invalid_character();
+            }
+            const auto value = decode_digits_n<BASE, uint64_t>(input, length, inverse);
+            if (size != 0 && (value >> (8 * size)) != 0) {
+                throw_out_of_range("HHC stream trailing block exceeds its byte count");
+            }
+            for (std::size_t i = 0; i < size; ++i) {
+                output[i] = static_cast<uint8_t>(value >> (8 * (size - 1 - i)));
+            }
+            return size;
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Number of characters the stream format produces for size input bytes
+     */
+    constexpr std::size_t hhc_stream_encoded_length(std::size_t size) {
+        return (size / HHC_STREAM_BLOCK_BYTES) * HHC_STREAM_BLOCK_LENGTH +
+               detail::STREAM_TAIL_LENGTH[size % HHC_STREAM_BLOCK_BYTES];
+    }
+
+    /**
+     * @brief Number of bytes a stream of length characters decodes to
+     * @throws std::invalid_argument if no input produces that many characters
+     */
+    constexpr std::size_t hhc_stream_decoded_length(std::size_t length) {
+        const uint8_t tail = detail::STREAM_TAIL_BYTES[length % HHC_STREAM_BLOCK_LENGTH];
+        if (tail == 0xFF) {
+            detail::throw_invalid_stream_length(length % HHC_STREAM_BLOCK_LENGTH);
+        }
+        return (length / HHC_STREAM_BLOCK_LENGTH) * HHC_STREAM_BLOCK_BYTES + tail;
+    }
+
+    /**
+     * @brief Encode a byte buffer in the stream format
+     *
+     * Every 8-byte block becomes the 11-character padded encoding of its big-endian value, so
+     * encoded blocks sort like the bytes they hold. A trailing block of n < 8 bytes becomes the
+     * fewest characters that cover 256^n values (2, 3, 4, 6, 7, 8 or 10).
+     *
+     * @note The output string is not null-terminated
+     * @param input The bytes to encode
+     * @param size The number of bytes
+     * @param output_string The output string (at least hhc_stream_encoded_length(size) bytes)
+     * @return The number of characters written
+     */
+    inline std::size_t hhc_stream_encode(const uint8_t* input, std::size_t size, char* output_string) {
+        HHC_ASSERT(size == 0 || (input != nullptr && output_string != nullptr));
+        const std::size_t blocks = size / HHC_STREAM_BLOCK_BYTES;
+        detail::stream_encode_blocks(input, blocks, output_string);
+        detail::stream_encode_tail(input + blocks * HHC_STREAM_BLOCK_BYTES, size % HHC_STREAM_BLOCK_BYTES,
+                                   output_string + blocks * HHC_STREAM_BLOCK_LENGTH);
+        return hhc_stream_encoded_length(size);
+    }
+
+    /**
+     * @brief Decode a stream-format string
+     * @param input_string The characters to decode (need not be null-terminated)
+     * @param length The number of characters
+     * @param output The output buffer (at least hhc_stream_decoded_length(length) bytes)
+     * @return The number of bytes written
+     * @throws std::invalid_argument if the length or a character is invalid
+     * @throws std::out_of_range if a block exceeds the bytes it stands for
+     */
+    inline std::size_t hhc_stream_decode(const char* input_string, std::size_t length, uint8_t* output) {
+        HHC_ASSERT(length == 0 || (input_string != nullptr && output != nullptr));
+        const std::size_t blocks = length / HHC_STREAM_BLOCK_LENGTH;
+        if (detail::STREAM_TAIL_BYTES[length % HHC_STREAM_BLOCK_LENGTH] == 0xFF) {
+            detail::throw_invalid_stream_length(length % HHC_STREAM_BLOCK_LENGTH);
+        }
+        detail::stream_decode_blocks(input_string, blocks, output);
+        return blocks * HHC_STREAM_BLOCK_BYTES +
+               detail::stream_decode_tail(input_string + blocks * HHC_STREAM_BLOCK_LENGTH,
+                                          length % HHC_STREAM_BLOCK_LENGTH, output + blocks * HHC_STREAM_BLOCK_BYTES);
+    }
+
+    /**
+     * @brief Incremental stream-format encoder accepting input in chunks of any size
+     *
+     * At most one partial block (7 bytes) is held between calls, so memory stays constant
+     * regardless of the total input size. Concatenating every update() output and the
+     * finish() output yields exactly hhc_stream_encode() of the whole input.
+     */
+    class stream_encoder {
+    public:
+        /// Largest number of characters a single update() of size bytes can write
+        std::size_t max_update_length(std::size_t size) const noexcept {
+            return ((pending_size_ + size) / HHC_STREAM_BLOCK_BYTES) * HHC_STREAM_BLOCK_LENGTH;
+        }
+
+        /**
+         * @brief Encode every block completed by the given bytes
+         * @param output_string The output string (at least max_update_length(size) bytes)
+         * @return The number of characters written
+         */
+        std::size_t update(const uint8_t* input, std::size_t size, char* output_string) {
+            HHC_ASSERT(size == 0 || input != nullptr);
+            HHC_ASSERT(max_update_length(size) == 0 || output_string != nullptr);
+            std::size_t written = 0;
+            if (pending_size_ != 0) {
+                const std::size_t take = std::min(size, HHC_STREAM_BLOCK_BYTES - pending_size_);
+                for (std::size_t i = 0; i < take; ++i) {
+                    pending_[pending_size_ + i] = input[i];
+                }
+                pending_size_ += take;
+                input += take;
+                size -= take;
+                if (pending_size_ < HHC_STREAM_BLOCK_BYTES) {
+                    return 0;
+                }
+                detail::stream_encode_blocks(pending_.data(), 1, output_string);
+                written = HHC_STREAM_BLOCK_LENGTH;
+                pending_size_ = 0;
+            }
+
+            const std::size_t blocks = size / HHC_STREAM_BLOCK_BYTES;
+            detail::stream_encode_blocks(input, blocks, output_string + written);
+            written += blocks * HHC_STREAM_BLOCK_LENGTH;
+
+            pending_size_ = size % HHC_STREAM_BLOCK_BYTES;
+            for (std::size_t i = 0; i < pending_size_; ++i) {
+                pending_[i] = input[blocks * HHC_STREAM_BLOCK_BYTES + i];
+            }
+            return written;
+        }
+
+        /**
+         * @brief Encode the trailing partial block and reset the encoder
+         * @param output_string The output string (at least 10 bytes)
+         * @return The number of characters written
+         */
+        std::size_t finish(char* output_string) {
+            HHC_ASSERT(output_string != nullptr);
+            detail::stream_encode_tail(pending_.data(), pending_size_, output_string);
+            const std::size_t written = detail::STREAM_TAIL_LENGTH[pending_size_];
+            pending_size_ = 0;
+            return written;
+        }
+
+    private:
+        std::array<uint8_t, HHC_STREAM_BLOCK_BYTES> pending_{};
+        std::size_t pending_size_ = 0;
+    };
+
+    /**
+     * @brief Incremental stream-format decoder accepting input in chunks of any size
+     *
+     * At most one partial block (10 characters) is held between calls. A partial block can only
+     * be told apart from a trailing block at the end of the input, so it is decoded by finish().
+     */
+    class stream_decoder {
+    public:
+        /// Largest number of bytes a single update() of length characters can write
+        std::size_t max_update_size(std::size_t length) const noexcept {
+            return ((pending_length_ + length) / HHC_STREAM_BLOCK_LENGTH) * HHC_STREAM_BLOCK_BYTES;
+        }
+
+        /**
+         * @brief Decode every block completed by the given characters
+         * @param output The output buffer (at least max_update_size(length) bytes)
+         * @return The number of bytes written
+         * @throws std::invalid_argument if a block contains a character outside the alphabet
+         * @throws std::out_of_range if a block exceeds 64-bit bounds
+         */
+        std::size_t update(const char* input_string, std::size_t length, uint8_t* output) {
+            HHC_ASSERT(length == 0 || input_string != nullptr);
+            HHC_ASSERT(max_update_size(length) == 0 || output != nullptr);
+            std::size_t written = 0;
+            if (pending_length_ != 0) {
+                const std::size_t take = std::min(length, HHC_STREAM_BLOCK_LENGTH - pending_length_);
+                for (std::size_t i = 0; i < take; ++i) {
+                    pending_[pending_length_ + i] = input_string[i];
+                }
+                pending_length_ += take;
+                input_string += take;
+                length -= take;
+                if (pending_length_ < HHC_STREAM_BLOCK_LENGTH) {
+                    return 0;
+                }
+                detail::stream_decode_blocks(pending_.data(), 1, output);
+                written = HHC_STREAM_BLOCK_BYTES;
+                pending_length_ = 0;
+            }
+
+            const std::size_t blocks = length / HHC_STREAM_BLOCK_LENGTH;
+            detail::stream_decode_blocks(input_string, blocks, output + written);
+            written += blocks * HHC_STREAM_BLOCK_BYTES;
+
+            pending_length_ = length % HHC_STREAM_BLOCK_LENGTH;
+            for (std::size_t i = 0; i < pending_length_; ++i) {
+                pending_[i] = input_string[blocks * HHC_STREAM_BLOCK_LENGTH + i];
+            }
+            return written;
+        }
+
+        /**
+         * @brief Decode the trailing block and reset the decoder
+         * @param output The output buffer (at least 7 bytes)
+         * @return The number of bytes written
+         * @throws std::invalid_argument if the input ended inside a block
+         * @throws std::out_of_range if the trailing block exceeds the bytes it stands for
+         */
+        std::size_t finish(uint8_t* output) {
+            HHC_ASSERT(output != nullptr);
+            const std::size_t length = pending_length_;
+            pending_length_ = 0;
+            return detail::stream_decode_tail(pending_.data(), length, output);
+        }
+
+    private:
+        std::array<char, HHC_STREAM_BLOCK_LENGTH> pending_{};
+        std::size_t pending_length_ = 0;
+    };
+
+} // namespace hhc
+
+#endif // HHC_STREAM_HPP
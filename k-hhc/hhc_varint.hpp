@@ -0,0 +1,238 @@
+#ifndef HHC_VARINT_HPP
+#define HHC_VARINT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "hhc_assert.hpp"
+#include "hhc_codec.hpp"
+
+namespace hhc {
+
+    namespace detail {
+
+        using varint_tables = alphabet_tables<hhc_alphabet>;
+
+        /// Each varint symbol carries one base-33 digit; the half of the alphabet it comes from marks the end
+        inline constexpr uint32_t VARINT_RADIX = varint_tables::BASE / 2;
+
+        /**
+         * @brief Number of base-33 digits needed for the largest UInt
+         */
+        template <typename UInt>
+        constexpr std::size_t varint_digits() {
+            std::size_t digits = 1;
+            for (UInt max = std::numeric_limits<UInt>::max(); max >= VARINT_RADIX; max /= VARINT_RADIX) {
+                ++digits;
+            }
+            return digits;
+        }
+
+        [[noreturn]] inline void throw_truncated_varint() {
+            throw std::invalid_argument("Truncated HHC varint (missing terminal symbol)");
+        }
+
+        [[noreturn]] inline void throw_noncanonical_varint() {
+            throw std::invalid_argument("Non-canonical HHC varint (leading zero digit)");
+        }
+
+        [[noreturn]] inline void throw_unsorted_varints() {
+            throw std::invalid_argument("Delta-encoded HHC varints require values in ascending order");
+        }
+
+    } // namespace detail
+
+    /// Longest varint encoding of a UInt, in symbols
+    template <typename UInt>
+    inline constexpr std::size_t VARINT_MAX_LENGTH = detail::varint_digits<UInt>();
+
+    /**
+     * @brief How a list of values is laid out as varints
+     */
+    enum class varint_mode {
+        plain, ///< Every value is written as is
+        delta, ///< The first value, then the gap to each next value (input must be ascending)
+    };
+
+    /**
+     * @brief Write one value as a self-delimiting varint over the HHC alphabet
+     *
+     * The value is written in base 33, most significant digit first. The last digit uses the
+     * first 33 symbols of the alphabet ("-.0-9A-U") and every earlier digit uses the other 33
+     * ("V-Z_a-z~"), so a reader knows where each value ends without separators. Values below 33
+     * take one symbol, below 1089 two, and a full 64-bit value 13. Every symbol is URL-safe.
+     * There are no leading zero digits, so each value has exactly one encoding.
+     *
+     * @note The output string is not null-terminated
+     * @param value The value to encode
+     * @param output_string The output string (at least VARINT_MAX_LENGTH<UInt> bytes)
+     * @return The number of symbols written
+     */
+    template <typename UInt>
+    constexpr std::size_t encode_varint(UInt value, char* output_string) {
+        static_assert(std::is_unsigned_v<UInt>, "Varints encode unsigned integers");
+        constexpr std::size_t MAX_LENGTH = VARINT_MAX_LENGTH<UInt>;
+        constexpr UInt RADIX = detail::VARINT_RADIX;
+        const char* symbols = hhc_alphabet::symbols.data();
+        HHC_ASSERT(output_string != nullptr);
+
+        char digits[MAX_LENGTH] = {};
+        std::size_t pos = MAX_LENGTH;
+        digits[--pos] = symbols[value % RADIX];
+        value /= RADIX;
+        while (value != 0) {
+            digits[--pos] = symbols[RADIX + value % RADIX];
+            value /= RADIX;
+        }
+        const std::size_t length = MAX_LENGTH - pos;
+        for (std::size_t i = 0; i < length; ++i) {
+            output_string[i] = digits[pos + i];
+        }
+        return length;
+    }
+
+    /**
+     * @brief Read one varint from the front of input
+     * @param input The encoded text
+     * @param length The number of characters available
+     * @param value Receives the decoded value
+     * @return The number of symbols consumed
+     * @throws std::invalid_argument if a character is outside the alphabet, the value starts with a zero
+     *                               continuation digit, or input ends mid-value
+     * @throws std::out_of_range if the value does not fit in UInt
+     */
+    template <typename UInt>
+    constexpr std::size_t decode_varint(const char* input, std::size_t length, UInt& value) {
+        static_assert(std::is_unsigned_v<UInt>, "Varints decode unsigned integers");
+        constexpr UInt RADIX = detail::VARINT_RADIX;
+        constexpr UInt LIMIT = std::numeric_limits<UInt>::max() / RADIX;
+        // Any VARINT_MAX_LENGTH - 1 digits fit, so only the digits after them need a bounds check
+        constexpr std::size_t SAFE_DIGITS = VARINT_MAX_LENGTH<UInt> - 1;
+        const uint8_t* inverse = detail::varint_tables::INVERSE.data();
+        HHC_ASSERT(length == 0 || input != nullptr);
+
+        UInt result = 0;
+        for (std::size_t pos = 0; pos < length; ++pos) {
+            const uint8_t symbol = inverse[static_cast<unsigned char>(input[pos])];
+            if (symbol == detail::INVALID_DIGIT) {
+                detail::throw_invalid_character();
+            }
+            const bool terminal = symbol < RADIX;
+            const UInt digit = terminal ? symbol : symbol - RADIX;
+            // encode_varint never writes a leading zero, so "V-" must not decode like "-"
+            if (pos == 0 && !terminal && digit == 0) {
+                detail::throw_noncanonical_varint();
+            }
+            if (pos >= SAFE_DIGITS &&
+                (result > LIMIT || static_cast<UInt>(result * RADIX) > std::numeric_limits<UInt>::max() - digit)) {
+                detail::throw_out_of_range("HHC varint exceeds integer bounds");
+            }
+            result = static_cast<UInt>(result * RADIX + digit);
+            if (terminal) {
+                value = result;
+                return pos + 1;
+            }
+        }
+        detail::throw_truncated_varint();
+    }
+
+    /**
+     * @brief Write count values as back-to-back varints
+     * @note The output string is not null-terminated
+     * @param values The values to encode
+     * @param count The number of values
+     * @param output_string The output string (at least count * VARINT_MAX_LENGTH<UInt> bytes)
+     * @param mode plain, or delta to store gaps between ascending values
+     * @return The number of symbols written
+     * @throws std::invalid_argument in delta mode if the values are not in ascending order
+     */
+    template <typename UInt>
+    std::size_t encode_varint_batch(const UInt* values, std::size_t count, char* output_string,
+                                    varint_mode mode = varint_mode::plain) {
+        HHC_ASSERT(count == 0 || (values != nullptr && output_string != nullptr));
+        char* cursor = output_string;
+        if (mode == varint_mode::delta) {
+            UInt previous = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                if (values[i] < previous) {
+                    detail::throw_unsorted_varints();
+                }
+                cursor += encode_varint<UInt>(static_cast<UInt>(values[i] - previous), cursor);
+                previous = values[i];
+            }
+        } else {
+            for (std::size_t i = 0; i < count; ++i) {
+                cursor += encode_varint<UInt>(values[i], cursor);
+            }
+        }
+        return static_cast<std::size_t>(cursor - output_string);
+    }
+
+    /**
+     * @brief Read every varint in input
+     * @param input The encoded text
+     * @param length The number of characters in input
+     * @param output The decoded values (room for up to length values; each takes at least one symbol)
+     * @param mode The mode the text was written with
+     * @return The number of values decoded
+     * @throws std::invalid_argument if a character is outside the alphabet, a value starts with a zero
+     *                               continuation digit, or input ends mid-value
+     * @throws std::out_of_range if a value, or in delta mode a running sum, does not fit in UInt
+     */
+    template <typename UInt>
+    std::size_t decode_varint_batch(const char* input, std::size_t length, UInt* output,
+                                    varint_mode mode = varint_mode::plain) {
+        HHC_ASSERT(length == 0 || (input != nullptr && output != nullptr));
+        std::size_t count = 0;
+        std::size_t pos = 0;
+        UInt previous = 0;
+        while (pos < length) {
+            UInt value = 0;
+            pos += decode_varint<UInt>(input + pos, length - pos, value);
+            if (mode == varint_mode::delta) {
+                if (value > std::numeric_limits<UInt>::max() - previous) {
+                    detail::throw_out_of_range("HHC varint delta sum exceeds integer bounds");
+                }
+                value = static_cast<UInt>(previous + value);
+                previous = value;
+            }
+            output[count++] = value;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Encode a list of values into a compact, URL-safe string
+     *
+     * Example:
+     *   std::string selection = hhc::encode_varints(ids, hhc::varint_mode::delta);
+     *   std::vector<uint64_t> restored = hhc::decode_varints(selection, hhc::varint_mode::delta);
+     *
+     * @see encode_varint_batch
+     */
+    template <typename UInt>
+    std::string encode_varints(const std::vector<UInt>& values, varint_mode mode = varint_mode::plain) {
+        std::string text(values.size() * VARINT_MAX_LENGTH<UInt>, '\0');
+        text.resize(encode_varint_batch(values.data(), values.size(), text.data(), mode));
+        return text;
+    }
+
+    /**
+     * @brief Decode a string written by encode_varints
+     * @see decode_varint_batch
+     */
+    template <typename UInt = uint64_t>
+    std::vector<UInt> decode_varints(std::string_view text, varint_mode mode = varint_mode::plain) {
+        std::vector<UInt> values(text.size());
+        values.resize(decode_varint_batch(text.data(), text.size(), values.data(), mode));
+        return values;
+    }
+
+} // namespace hhc
+
+#endif // HHC_VARINT_HPP
@@ -0,0 +1,469 @@
+#ifndef HHC_VIEWS_HPP
+#define HHC_VIEWS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include "hhc_constants.hpp"
+#include "hhc_codec.hpp"
+
+#if defined(__has_include)
+#  if __has_include(<version>)
+#    include <version>
+#  endif
+#endif
+
+#if defined(__cpp_lib_ranges)
+#  include <ranges>
+#endif
+
+namespace hhc {
+
+    namespace detail {
+
+        /// Number of elements a contiguous view converts per call to the batch kernels
+        inline constexpr std::size_t VIEW_BLOCK_SIZE = 16;
+
+#if defined(__cpp_lib_ranges)
+        /// Lets the views satisfy std::ranges::view and compose with std::views
+        using view_base = std::ranges::view_base;
+#else
+        struct view_base {};
+#endif
+
+        template <typename Range>
+        using range_iterator_t = decltype(std::begin(std::declval<Range&>()));
+
+        /**
+         * @brief Detects ranges whose elements are stored contiguously (std::data/std::size yield a pointer and a count)
+         */
+        template <typename Range, typename = void>
+        struct contiguous_range_traits {
+            static constexpr bool value = false;
+            using element_type = void;
+        };
+
+        template <typename Range>
+        struct contiguous_range_traits<Range, std::void_t<decltype(std::data(std::declval<Range&>())),
+                                                          decltype(std::size(std::declval<Range&>()))>> {
+            static constexpr bool value = std::is_pointer_v<decltype(std::data(std::declval<Range&>()))>;
+            using element_type = std::remove_cv_t<std::remove_pointer_t<decltype(std::data(std::declval<Range&>()))>>;
+        };
+
+        /**
+         * @brief Holds an lvalue range by pointer and an rvalue range by value, so the views stay assignable
+         */
+        template <typename Range>
+        class range_holder {
+        public:
+            range_holder() = default;
+            explicit range_holder(Range&& range) : range_(std::move(range)) {}
+            Range& get() { return range_; }
+
+        private:
+            Range range_{};
+        };
+
+        template <typename Range>
+        class range_holder<Range&> {
+        public:
+            range_holder() = default;
+            explicit range_holder(Range& range) : range_(std::addressof(range)) {}
+            Range& get() { return *range_; }
+
+        private:
+            Range* range_ = nullptr;
+        };
+
+        /**
+         * @brief View a string-like element (std::string, std::string_view, const char*, std::array<char, N>) as characters
+         */
+        template <typename Text>
+        constexpr std::string_view text_of(const Text& text) {
+            if constexpr (std::is_convertible_v<const Text&, std::string_view>) {
+                return text;
+            } else {
+                return std::string_view(std::data(text), std::size(text));
+            }
+        }
+
+        /**
+         * @brief Input iterator encoding one element of any range per dereference
+         */
+        template <typename Codec, typename It>
+        class encode_element_iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::array<char, Codec::ENCODED_LENGTH>;
+            using difference_type = std::ptrdiff_t;
+            using reference = value_type;
+            using pointer = void;
+
+            encode_element_iterator() = default;
+            explicit encode_element_iterator(It it) : it_(std::move(it)) {}
+
+            value_type operator*() const {
+                value_type encoded;
+                Codec::encode_padded(static_cast<typename Codec::value_type>(*it_), encoded.data());
+                return encoded;
+            }
+
+            encode_element_iterator& operator++() {
+                ++it_;
+                return *this;
+            }
+
+            encode_element_iterator operator++(int) {
+                encode_element_iterator previous = *this;
+                ++it_;
+                return previous;
+            }
+
+            friend bool operator==(const encode_element_iterator& lhs, const encode_element_iterator& rhs) {
+                return lhs.it_ == rhs.it_;
+            }
+
+            friend bool operator!=(const encode_element_iterator& lhs, const encode_element_iterator& rhs) {
+                return !(lhs == rhs);
+            }
+
+        private:
+            It it_{};
+        };
+
+        /**
+         * @brief Input iterator over contiguous values that encodes VIEW_BLOCK_SIZE elements at a time
+         *
+         * The block is filled lazily on the first dereference that falls outside it, so skipping
+         * elements with ++ costs nothing. Dereferencing returns a reference into the block, which
+         * stays valid until the iterator is advanced past it.
+         */
+        template <typename Codec>
+        class encode_block_iterator {
+            using UInt = typename Codec::value_type;
+            static constexpr std::size_t LENGTH = Codec::ENCODED_LENGTH;
+            static_assert(sizeof(std::array<char, LENGTH>) == LENGTH, "records must be stored back to back");
+
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::array<char, LENGTH>;
+            using difference_type = std::ptrdiff_t;
+            using reference = const value_type&;
+            using pointer = void;
+
+            encode_block_iterator() = default;
+            encode_block_iterator(const UInt* pos, const UInt* end)
+                : pos_(pos), end_(end), block_begin_(pos), block_end_(pos) {}
+
+            const value_type& operator*() const {
+                if (pos_ < block_begin_ || pos_ >= block_end_) {
+                    fill();
+                }
+                return block_[static_cast<std::size_t>(pos_ - block_begin_)];
+            }
+
+            encode_block_iterator& operator++() {
+                ++pos_;
+                return *this;
+            }
+
+            encode_block_iterator operator++(int) {
+                encode_block_iterator previous = *this;
+                ++pos_;
+                return previous;
+            }
+
+            friend bool operator==(const encode_block_iterator& lhs, const encode_block_iterator& rhs) {
+                return lhs.pos_ == rhs.pos_;
+            }
+
+            friend bool operator!=(const encode_block_iterator& lhs, const encode_block_iterator& rhs) {
+                return !(lhs == rhs);
+            }
+
+        private:
+            void fill() const {
+                const std::size_t count = std::min(VIEW_BLOCK_SIZE, static_cast<std::size_t>(end_ - pos_));
+                Codec::encode_padded_batch(pos_, count, reinterpret_cast<char*>(block_.data()));
+                block_begin_ = pos_;
+                block_end_ = pos_ + count;
+            }
+
+            const UInt* pos_ = nullptr;
+            const UInt* end_ = nullptr;
+            mutable const UInt* block_begin_ = nullptr;
+            mutable const UInt* block_end_ = nullptr;
+            mutable std::array<value_type, VIEW_BLOCK_SIZE> block_{};
+        };
+
+        /**
+         * @brief Input iterator decoding one string-like element of any range per dereference
+         */
+        template <typename Codec, typename It>
+        class decode_element_iterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = typename Codec::value_type;
+            using difference_type = std::ptrdiff_t;
+            using reference = value_type;
+            using pointer = void;
+
+            decode_element_iterator() = default;
+            explicit decode_element_iterator(It it) : it_(std::move(it)) {}
+
+            value_type operator*() const {
+                const std::string_view text = text_of(*it_);
+                return Codec::decode(text.data(), text.size());
+            }
+
+            decode_element_iterator& operator++() {
+                ++it_;
+                return *this;
+            }
+
+            decode_element_iterator operator++(int) {
+                decode_element_iterator previous = *this;
+                ++it_;
+                return previous;
+            }
+
+            friend bool operator==(const decode_element_iterator& lhs, const decode_element_iterator& rhs) {
+                return lhs.it_ == rhs.it_;
+            }
+
+            friend bool operator!=(const decode_element_iterator& lhs, const decode_element_iterator& rhs) {
+                return !(lhs == rhs);
+            }
+
+        private:
+            It it_{};
+        };
+
+        /**
+         * @brief Input iterator over contiguous fixed-width records that decodes VIEW_BLOCK_SIZE records at a time
+         *
+         * Errors are still raised when the offending element is dereferenced: if a block fails to
+         * decode, the iterator falls back to one record per block until it reaches the bad one.
+         */
+        template <typename Codec>
+        class decode_block_iterator {
+            using UInt = typename Codec::value_type;
+            using record_type = std::array<char, Codec::ENCODED_LENGTH>;
+            static_assert(sizeof(record_type) == Codec::ENCODED_LENGTH, "records must be stored back to back");
+
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = UInt;
+            using difference_type = std::ptrdiff_t;
+            using reference = value_type;
+            using pointer = void;
+
+            decode_block_iterator() = default;
+            decode_block_iterator(const record_type* pos, const record_type* end)
+                : pos_(pos), end_(end), block_begin_(pos), block_end_(pos) {}
+
+            value_type operator*() const {
+                if (pos_ < block_begin_ || pos_ >= block_end_) {
+                    fill();
+                }
+                return block_[static_cast<std::size_t>(pos_ - block_begin_)];
+            }
+
+            decode_block_iterator& operator++() {
+                ++pos_;
+                return *this;
+            }
+
+            decode_block_iterator operator++(int) {
+                decode_block_iterator previous = *this;
+                ++pos_;
+                return previous;
+            }
+
+            friend bool operator==(const decode_block_iterator& lhs, const decode_block_iterator& rhs) {
+                return lhs.pos_ == rhs.pos_;
+            }
+
+            friend bool operator!=(const decode_block_iterator& lhs, const decode_block_iterator& rhs) {
+                return !(lhs == rhs);
+            }
+
+        private:
+            void fill() const {
+                const char* records = reinterpret_cast<const char*>(pos_);
+                std::size_t count = std::min(VIEW_BLOCK_SIZE, static_cast<std::size_t>(end_ - pos_));
+                try {
+                    Codec::decode_batch(records, count, block_.data());
+                } catch (...) {
+                    count = 1;
+                    Codec::decode_batch(records, count, block_.data());
+                }
+                block_begin_ = pos_;
+                block_end_ = pos_ + count;
+            }
+
+            const record_type* pos_ = nullptr;
+            const record_type* end_ = nullptr;
+            mutable const record_type* block_begin_ = nullptr;
+            mutable const record_type* block_end_ = nullptr;
+            mutable std::array<UInt, VIEW_BLOCK_SIZE> block_{};
+        };
+
+    } // namespace detail
+
+    /**
+     * @brief Lazy view encoding every unsigned integer of a range to a padded std::array<char, ENCODED_LENGTH>
+     *
+     * Contiguous ranges of Codec::value_type are encoded in blocks through encode_padded_batch;
+     * any other range of unsigned integers is encoded one element at a time.
+     *
+     * @tparam Range The underlying range (an lvalue reference type when the view refers to it)
+     * @tparam Codec A basic_codec instantiation
+     */
+    template <typename Range, typename Codec>
+    class encode_view : public detail::view_base {
+        using traits = detail::contiguous_range_traits<std::remove_reference_t<Range>>;
+        using element_type = std::remove_cv_t<std::remove_reference_t<decltype(*std::declval<detail::range_iterator_t<Range>>())>>;
+        static_assert(std::is_integral_v<element_type> && std::is_unsigned_v<element_type> &&
+                          sizeof(element_type) <= sizeof(typename Codec::value_type),
+                      "encode views require unsigned integers no wider than the codec");
+
+        static constexpr bool BATCHED =
+            traits::value && std::is_same_v<typename traits::element_type, typename Codec::value_type>;
+
+    public:
+        using iterator = std::conditional_t<BATCHED, detail::encode_block_iterator<Codec>,
+                                            detail::encode_element_iterator<Codec, detail::range_iterator_t<Range>>>;
+
+        encode_view() = default;
+        explicit encode_view(Range&& range) : range_(std::forward<Range>(range)) {}
+
+        iterator begin() {
+            if constexpr (BATCHED) {
+                const auto* data = std::data(range_.get());
+                return iterator(data, data + std::size(range_.get()));
+            } else {
+                return iterator(std::begin(range_.get()));
+            }
+        }
+
+        iterator end() {
+            if constexpr (BATCHED) {
+                const auto* last = std::data(range_.get()) + std::size(range_.get());
+                return iterator(last, last);
+            } else {
+                return iterator(std::end(range_.get()));
+            }
+        }
+
+        template <typename R = Range>
+        auto size() -> decltype(std::size(std::declval<R&>())) {
+            return std::size(range_.get());
+        }
+
+    private:
+        detail::range_holder<Range> range_;
+    };
+
+    /**
+     * @brief Lazy view decoding every string of a range (padded or unpadded) with validation
+     *
+     * Elements may be std::string, std::string_view, const char* or std::array<char, N>. Contiguous
+     * ranges of padded std::array<char, ENCODED_LENGTH> records (e.g. a collected encode_view) are
+     * decoded in blocks through decode_batch; anything else is decoded one element at a time.
+     * Dereferencing throws std::invalid_argument or std::out_of_range exactly like Codec::decode.
+     *
+     * @tparam Range The underlying range (an lvalue reference type when the view refers to it)
+     * @tparam Codec A basic_codec instantiation
+     */
+    template <typename Range, typename Codec>
+    class decode_view : public detail::view_base {
+        using traits = detail::contiguous_range_traits<std::remove_reference_t<Range>>;
+
+        static constexpr bool BATCHED =
+            traits::value && std::is_same_v<typename traits::element_type, std::array<char, Codec::ENCODED_LENGTH>>;
+
+    public:
+        using iterator = std::conditional_t<BATCHED, detail::decode_block_iterator<Codec>,
+                                            detail::decode_element_iterator<Codec, detail::range_iterator_t<Range>>>;
+
+        decode_view() = default;
+        explicit decode_view(Range&& range) : range_(std::forward<Range>(range)) {}
+
+        iterator begin() {
+            if constexpr (BATCHED) {
+                const auto* data = std::data(range_.get());
+                return iterator(data, data + std::size(range_.get()));
+            } else {
+                return iterator(std::begin(range_.get()));
+            }
+        }
+
+        iterator end() {
+            if constexpr (BATCHED) {
+                const auto* last = std::data(range_.get()) + std::size(range_.get());
+                return iterator(last, last);
+            } else {
+                return iterator(std::end(range_.get()));
+            }
+        }
+
+        template <typename R = Range>
+        auto size() -> decltype(std::size(std::declval<R&>())) {
+            return std::size(range_.get());
+        }
+
+    private:
+        detail::range_holder<Range> range_;
+    };
+
+    namespace views {
+
+        /**
+         * @brief Range adaptor object producing an encode_view (`ids | hhc::views::encode64_padded`)
+         */
+        template <typename Codec>
+        struct encode_padded_adaptor {
+            template <typename Range>
+            constexpr auto operator()(Range&& range) const {
+                return encode_view<Range, Codec>(std::forward<Range>(range));
+            }
+
+            template <typename Range>
+            friend constexpr auto operator|(Range&& range, const encode_padded_adaptor& adaptor) {
+                return adaptor(std::forward<Range>(range));
+            }
+        };
+
+        /**
+         * @brief Range adaptor object producing a decode_view (`strings | hhc::views::decode64`)
+         */
+        template <typename Codec>
+        struct decode_adaptor {
+            template <typename Range>
+            constexpr auto operator()(Range&& range) const {
+                return decode_view<Range, Codec>(std::forward<Range>(range));
+            }
+
+            template <typename Range>
+            friend constexpr auto operator|(Range&& range, const decode_adaptor& adaptor) {
+                return adaptor(std::forward<Range>(range));
+            }
+        };
+
+        inline constexpr encode_padded_adaptor<hhc32_codec> encode32_padded{};
+        inline constexpr encode_padded_adaptor<hhc64_codec> encode64_padded{};
+        inline constexpr decode_adaptor<hhc32_codec> decode32{};
+        inline constexpr decode_adaptor<hhc64_codec> decode64{};
+
+    } // namespace views
+
+} // namespace hhc
+
+#endif // HHC_VIEWS_HPP
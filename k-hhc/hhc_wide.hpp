@@ -0,0 +1,259 @@
+#ifndef HHC_WIDE_HPP
+#define HHC_WIDE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "hhc_constants.hpp"
+#include "hhc_assert.hpp"
+#include "hhc_codec.hpp"
+#include "hhc.hpp"
+
+namespace hhc {
+
+    namespace detail {
+
+        template <typename CharT>
+        inline constexpr bool is_wide_char_v = std::is_same_v<CharT, char16_t> || std::is_same_v<CharT, char32_t>;
+
+        template <typename CharT>
+        using enable_if_wide_t = std::enable_if_t<is_wide_char_v<CharT>, int>;
+
+        /// Narrowed stand-in for code units that cannot be HHC symbols
+        inline constexpr char NON_ASCII_UNIT = static_cast<char>(0xFF);
+
+        /**
+         * @brief Widen Length ASCII characters to code units
+         */
+        template <std::size_t Length, typename CharT>
+        constexpr void widen_chars(const char* narrow, CharT* wide) {
+            for (std::size_t pos = 0; pos < Length; ++pos) {
+                wide[pos] = static_cast<CharT>(static_cast<unsigned char>(narrow[pos]));
+            }
+        }
+
+        /**
+         * @brief Narrow length code units to characters, mapping anything outside ASCII to NON_ASCII_UNIT
+         * @note Branch-free so it vectorizes; the regular validation pass then rejects NON_ASCII_UNIT,
+         *       so a code unit whose low byte happens to be a symbol can never alias to it
+         */
+        template <typename CharT>
+        constexpr void narrow_chars(const CharT* wide, std::size_t length, char* narrow) {
+            for (std::size_t pos = 0; pos < length; ++pos) {
+                const auto unit = static_cast<uint32_t>(wide[pos]);
+                narrow[pos] = unit < 0x80U ? static_cast<char>(unit) : NON_ASCII_UNIT;
+            }
+        }
+
+        /**
+         * @brief Length of a null-terminated wide string, scanning at most limit code units
+         * @return The length, or limit + 1 if the string is longer than limit
+         */
+        template <typename CharT>
+        constexpr std::size_t wide_length_bounded(const CharT* wide, std::size_t limit) {
+            for (std::size_t pos = 0; pos <= limit; ++pos) {
+                if (wide[pos] == CharT{0}) {
+                    return pos;
+                }
+            }
+            return limit + 1;
+        }
+
+        /**
+         * @brief Decode a wide string of known length through Codec::decode
+         * @throws std::invalid_argument if the string is empty, too long or has a character outside the alphabet
+         * @throws std::out_of_range if the string exceeds the bounds of the codec
+         */
+        template <typename Codec, typename CharT>
+        constexpr typename Codec::value_type decode_wide_n(const CharT* input_string, std::size_t length) {
+            if (input_string == nullptr) {
+                throw_null_string();
+            }
+            if (length == 0 || length > Codec::ENCODED_LENGTH) {
+                throw_invalid_length(length);
+            }
+            if (is_constant_evaluated()) {
+                char narrow[Codec::ENCODED_LENGTH] = {};
+                narrow_chars(input_string, length, narrow);
+                return Codec::decode(narrow, length);
+            }
+
+            // Left-pad with the zero symbol so every length takes the fixed-width record kernel
+            constexpr std::size_t LENGTH = Codec::ENCODED_LENGTH;
+            char narrow[LENGTH] = {};
+            for (std::size_t pos = 0; pos < LENGTH - length; ++pos) {
+                narrow[pos] = Codec::ALPHABET[0];
+            }
+            narrow_chars(input_string, length, narrow + (LENGTH - length));
+            return decode_record_checked<LENGTH, Codec::BASE, typename Codec::value_type>(
+                narrow, alphabet_tables<typename Codec::alphabet_type>::INVERSE.data(), Codec::MAX_DIGITS);
+        }
+
+        /**
+         * @brief Decode a null-terminated wide string through Codec::decode
+         */
+        template <typename Codec, typename CharT>
+        constexpr typename Codec::value_type decode_wide(const CharT* input_string) {
+            if (input_string == nullptr) {
+                throw_null_string();
+            }
+            return decode_wide_n<Codec>(input_string, wide_length_bounded(input_string, Codec::ENCODED_LENGTH));
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Encode a 32-bit integer into 6 UTF-16/UTF-32 code units
+     * @note The output string is not null-terminated
+     * @param input The 32-bit integer to encode
+     * @param output_string The output string (at least HHC_32BIT_ENCODED_LENGTH code units)
+     */
+    template <typename CharT, detail::enable_if_wide_t<CharT> = 0>
+    constexpr void hhc_32bit_encode_padded(uint32_t input, CharT* output_string) {
+        HHC_ASSERT(output_string != nullptr);
+        char narrow[HHC_32BIT_ENCODED_LENGTH] = {};
+        hhc32_codec::encode_padded(input, narrow);
+        detail::widen_chars<HHC_32BIT_ENCODED_LENGTH>(narrow, output_string);
+    }
+
+    /**
+     * @brief Encode a 32-bit integer into UTF-16/UTF-32 code units without padding
+     * @note The output string is null-terminated; zero encodes to an empty string
+     * @param input The 32-bit integer to encode
+     * @param output_string The output string (at least HHC_32BIT_STRING_LENGTH code units)
+     */
+    template <typename CharT, detail::enable_if_wide_t<CharT> = 0>
+    constexpr void hhc_32bit_encode_unpadded(uint32_t input, CharT* output_string) {
+        HHC_ASSERT(output_string != nullptr);
+        char narrow[HHC_32BIT_STRING_LENGTH] = {};
+        hhc32_codec::encode_unpadded(input, narrow);
+        detail::widen_chars<HHC_32BIT_STRING_LENGTH>(narrow, output_string);
+    }
+
+    /**
+     * @brief Encode a 64-bit integer into 11 UTF-16/UTF-32 code units
+     * @note The output string is not null-terminated
+     * @param input The 64-bit integer to encode
+     * @param output_string The output string (at least HHC_64BIT_ENCODED_LENGTH code units)
+     */
+    template <typename CharT, detail::enable_if_wide_t<CharT> = 0>
+    constexpr void hhc_64bit_encode_padded(uint64_t input, CharT* output_string) {
+        HHC_ASSERT(output_string != nullptr);
+        char narrow[HHC_64BIT_ENCODED_LENGTH] = {};
+        hhc64_codec::encode_padded(input, narrow);
+        detail::widen_chars<HHC_64BIT_ENCODED_LENGTH>(narrow, output_string);
+    }
+
+    /**
+     * @brief Encode a 64-bit integer into UTF-16/UTF-32 code units without padding
+     * @note The output string is null-terminated; zero encodes to an empty string
+     * @param input The 64-bit integer to encode
+     * @param output_string The output string (at least HHC_64BIT_STRING_LENGTH code units)
+     */
+    template <typename CharT, detail::enable_if_wide_t<CharT> = 0>
+    constexpr void hhc_64bit_encode_unpadded(uint64_t input, CharT* output_string) {
+        HHC_ASSERT(output_string != nullptr);
+        char narrow[HHC_64BIT_STRING_LENGTH] = {};
+        hhc64_codec::encode_unpadded(input, narrow);
+        detail::widen_chars<HHC_64BIT_STRING_LENGTH>(narrow, output_string);
+    }
+
+    /**
+     * @brief Decode a 32-bit integer from 6 UTF-16/UTF-32 code units without validation
+     * @param input_string The input string to decode
+     * @return The decoded 32-bit integer
+     */
+    template <typename CharT, detail::enable_if_wide_t<CharT> = 0>
+    constexpr uint32_t hhc_32bit_decode_unsafe(const CharT* input_string) {
+        HHC_ASSERT(input_string != nullptr);
+        char narrow[HHC_32BIT_ENCODED_LENGTH] = {};
+        detail::narrow_chars(input_string, HHC_32BIT_ENCODED_LENGTH, narrow);
+        return hhc32_codec::decode_unsafe(narrow);
+    }
+
+    /**
+     * @brief Decode a 64-bit integer from 11 UTF-16/UTF-32 code units without validation
+     * @param input_string The input string to decode
+     * @return The decoded 64-bit integer
+     */
+    template <typename CharT, detail::enable_if_wide_t<CharT> = 0>
+    constexpr uint64_t hhc_64bit_decode_unsafe(const CharT* input_string) {
+        HHC_ASSERT(input_string != nullptr);
+        char narrow[HHC_64BIT_ENCODED_LENGTH] = {};
+        detail::narrow_chars(input_string, HHC_64BIT_ENCODED_LENGTH, narrow);
+        return hhc64_codec::decode_unsafe(narrow);
+    }
+
+    /**
+     * @brief Decode a 32-bit integer from a padded or unpadded null-terminated UTF-16/UTF-32 string
+     * @param input_string The input string to decode
+     * @return The decoded 32-bit integer
+     * @throws std::invalid_argument if the string is invalid (including any code unit outside the alphabet)
+     * @throws std::out_of_range if the string exceeds 32-bit bounds
+     */
+    template <typename CharT, detail::enable_if_wide_t<CharT> = 0>
+    constexpr uint32_t hhc_32bit_decode(const CharT* input_string) {
+        return detail::decode_wide<hhc32_codec>(input_string);
+    }
+
+    /**
+     * @brief Decode a 32-bit integer from length UTF-16/UTF-32 code units (no terminator needed)
+     * @param input_string The input string to decode (e.g. the buffer of a JVM or JavaScript string)
+     * @param length The number of code units
+     * @return The decoded 32-bit integer
+     * @throws std::invalid_argument if the string is invalid (including any code unit outside the alphabet)
+     * @throws std::out_of_range if the string exceeds 32-bit bounds
+     */
+    template <typename CharT, detail::enable_if_wide_t<CharT> = 0>
+    constexpr uint32_t hhc_32bit_decode(const CharT* input_string, std::size_t length) {
+        return detail::decode_wide_n<hhc32_codec>(input_string, length);
+    }
+
+    /**
+     * @brief Decode a 64-bit integer from a padded or unpadded null-terminated UTF-16/UTF-32 string
+     * @param input_string The input string to decode
+     * @return The decoded 64-bit integer
+     * @throws std::invalid_argument if the string is invalid (including any code unit outside the alphabet)
+     * @throws std::out_of_range if the string exceeds 64-bit bounds
+     */
+    template <typename CharT, detail::enable_if_wide_t<CharT> = 0>
+    constexpr uint64_t hhc_64bit_decode(const CharT* input_string) {
+        return detail::decode_wide<hhc64_codec>(input_string);
+    }
+
+    /**
+     * @brief Decode a 64-bit integer from length UTF-16/UTF-32 code units (no terminator needed)
+     * @param input_string The input string to decode (e.g. the buffer of a JVM or JavaScript string)
+     * @param length The number of code units
+     * @return The decoded 64-bit integer
+     * @throws std::invalid_argument if the string is invalid (including any code unit outside the alphabet)
+     * @throws std::out_of_range if the string exceeds 64-bit bounds
+     */
+    template <typename CharT, detail::enable_if_wide_t<CharT> = 0>
+    constexpr uint64_t hhc_64bit_decode(const CharT* input_string, std::size_t length) {
+        return detail::decode_wide_n<hhc64_codec>(input_string, length);
+    }
+
+    /**
+     * @brief Validate a null-terminated UTF-16/UTF-32 string to ensure it is a valid HHC string
+     * @param input_string The input string to validate
+     * @return The length of the valid string, 0 if the string is invalid
+     */
+    template <typename CharT, detail::enable_if_wide_t<CharT> = 0>
+    constexpr std::size_t hhc_validate_string(const CharT* input_string) {
+        HHC_ASSERT(input_string != nullptr);
+        const uint8_t* inverse = detail::alphabet_tables<hhc_alphabet>::INVERSE.data();
+        std::size_t length = 0;
+        for (; input_string[length] != CharT{0}; ++length) {
+            // Same table as the decoders, so '/', '@', '[' and '`' inside the symbol range are rejected too
+            const auto unit = static_cast<uint32_t>(input_string[length]);
+            if (unit >= 0x80U || inverse[unit] == detail::INVALID_DIGIT) {
+                return 0;
+            }
+        }
+        return length;
+    }
+
+} // namespace hhc
+
+#endif // HHC_WIDE_HPP
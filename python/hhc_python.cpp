@@ -10,8 +10,11 @@
 #include <stdexcept>
 #include <cstring>
 #include <limits>
+#include <string>
+#include <vector>
 
 #include "hhc.hpp"
+#include "hhc_bigint.hpp"
 
 using std::snprintf;
 using std::strlen;
@@ -26,6 +29,9 @@ using hhc::hhc_32bit_decode;
 using hhc::hhc_64bit_encode_padded;
 using hhc::hhc_64bit_encode_unpadded;
 using hhc::hhc_64bit_decode;
+using hhc::big_uint;
+using hhc::hhc_bigint_encode;
+using hhc::hhc_bigint_decode;
 
 using hhc::HHC_32BIT_ENCODED_LENGTH;
 using hhc::HHC_64BIT_ENCODED_LENGTH;
@@ -234,6 +240,101 @@ static PyObject* k_hhc_decode_64bit(PyObject* /*self*/, PyObject* arg) {
     }
 }
 
+/**
+ * Encode a non-negative Python int of any size to an unpadded string.
+ * @note The Limited API has no direct access to int digits, so the value crosses the boundary as
+ *       big-endian bytes via int.to_bytes.
+ * @param self The Python object.
+ * @param arg The value to encode.
+ * @return The encoded string.
+ */
+static PyObject* k_hhc_encode_bigint(PyObject* /*self*/, PyObject* arg) {
+    if (!PyLong_Check(arg)) {
+        PyErr_SetString(PyExc_TypeError, "value must be an int");
+        return nullptr;
+    }
+
+    PyObjHolder zero(PyLong_FromLong(0));
+    if (!zero.get()) {
+        return nullptr;
+    }
+    const int negative = PyObject_RichCompareBool(arg, zero.get(), Py_LT);
+    if (negative < 0) {
+        return nullptr;
+    }
+    if (negative) {
+        PyErr_SetString(PyExc_OverflowError, "encode_bigint: value must be non-negative");
+        return nullptr;
+    }
+
+    PyObjHolder bit_length(PyObject_CallMethod(arg, "bit_length", nullptr));
+    if (!bit_length.get()) {
+        return nullptr;
+    }
+    const Py_ssize_t bits = PyLong_AsSsize_t(bit_length.get());
+    if (bits < 0 && PyErr_Occurred()) {
+        return nullptr;
+    }
+
+    PyObjHolder bytes(PyObject_CallMethod(arg, "to_bytes", "ns", (bits + 7) / 8, "big"));
+    if (!bytes.get()) {
+        return nullptr;
+    }
+    char* data = nullptr;
+    Py_ssize_t size = 0;
+    if (PyBytes_AsStringAndSize(bytes.get(), &data, &size) < 0) {
+        return nullptr;
+    }
+
+    try {
+        const std::string encoded =
+            hhc_bigint_encode(big_uint::from_bytes(reinterpret_cast<const uint8_t*>(data), static_cast<size_t>(size)));
+        return PyUnicode_FromStringAndSize(encoded.data(), (Py_ssize_t)encoded.size());
+    } catch (...) {
+        translate_std_exception();
+        return nullptr;
+    }
+}
+
+/**
+ * Decode a string of any length to a Python int.
+ * @param self The Python object.
+ * @param arg The encoded string.
+ * @return The decoded integer.
+ */
+static PyObject* k_hhc_decode_bigint(PyObject* /*self*/, PyObject* arg) {
+    if (!PyUnicode_Check(arg)) {
+        PyErr_SetString(PyExc_TypeError, "encoded must be a str");
+        return nullptr;
+    }
+
+    PyObject* bytes = PyUnicode_AsUTF8String(arg); // new reference
+    if (!bytes) {
+        return nullptr;
+    }
+    PyObjHolder bytes_holder(bytes);
+
+    char* s = nullptr;
+    if (PyBytes_AsStringAndSize(bytes_holder.get(), &s, nullptr) < 0) {
+        return nullptr;
+    }
+
+    std::vector<uint8_t> decoded;
+    try {
+        decoded = hhc_bigint_decode(s).to_bytes();
+    } catch (...) {
+        translate_std_exception();
+        return nullptr;
+    }
+
+    PyObjHolder decoded_bytes(
+        PyBytes_FromStringAndSize(reinterpret_cast<const char*>(decoded.data()), (Py_ssize_t)decoded.size()));
+    if (!decoded_bytes.get()) {
+        return nullptr;
+    }
+    return PyObject_CallMethod((PyObject*)&PyLong_Type, "from_bytes", "Os", decoded_bytes.get(), "big");
+}
+
 /**
  * Module documentation.
  * @return The module documentation.
@@ -246,7 +347,9 @@ static const char* k_hhc_module_doc =
     "- decode_32bit(encoded: str) -> int\n"
     "- encode_padded_64bit(value: int) -> str\n"
     "- encode_unpadded_64bit(value: int) -> str\n"
-    "- decode_64bit(encoded: str) -> int\n";
+    "- decode_64bit(encoded: str) -> int\n"
+    "- encode_bigint(value: int) -> str\n"
+    "- decode_bigint(encoded: str) -> int\n";
 
 /**
  * Documentation for encode_padded_32bit.
@@ -320,6 +423,32 @@ static const char* doc_decode_64bit =
     "    ValueError: If the string contains invalid characters.\n"
     "    OverflowError: If the string represents a value exceeding 64-bit bounds.";
 
+/**
+ * Documentation for encode_bigint.
+ * @return The documentation.
+ */
+static const char* doc_encode_bigint =
+    "Encode a non-negative integer of any size to an unpadded string.\n\n"
+    "Args:\n"
+    "    value (int): The non-negative integer to encode.\n\n"
+    "Returns:\n"
+    "    str: A variable-length string without padding (\"-\" for 0).\n\n"
+    "Raises:\n"
+    "    OverflowError: If the value is negative.";
+
+/**
+ * Documentation for decode_bigint.
+ * @return The documentation.
+ */
+static const char* doc_decode_bigint =
+    "Decode a string of any length to a non-negative integer.\n\n"
+    "Args:\n"
+    "    encoded (str): The encoded string (padded or unpadded).\n\n"
+    "Returns:\n"
+    "    int: The decoded integer.\n\n"
+    "Raises:\n"
+    "    ValueError: If the string is empty or contains invalid characters.";
+
 /**
  * Method table.
  * @return The method table PyMethodDef.
@@ -331,6 +460,8 @@ static PyMethodDef k_hhc_methods[] = {
     {"encode_padded_64bit",   (PyCFunction)k_hhc_encode_padded_64bit,   METH_O, doc_encode_padded_64bit},
     {"encode_unpadded_64bit", (PyCFunction)k_hhc_encode_unpadded_64bit, METH_O, doc_encode_unpadded_64bit},
     {"decode_64bit",          (PyCFunction)k_hhc_decode_64bit,          METH_O, doc_decode_64bit},
+    {"encode_bigint",         (PyCFunction)k_hhc_encode_bigint,         METH_O, doc_encode_bigint},
+    {"decode_bigint",         (PyCFunction)k_hhc_decode_bigint,         METH_O, doc_decode_bigint},
     {nullptr, nullptr, 0, nullptr}
 };
 
@@ -83,6 +83,42 @@ class TestHHCPython(unittest.TestCase):
         self.assertEqual(k_hhc.encode_unpadded_32bit(0), "")
         self.assertEqual(k_hhc.encode_unpadded_64bit(0), "")
 
+    def test_bigint_encode_decode(self):
+        """Test arbitrary-precision encoding and decoding."""
+        alphabet = k_hhc.ALPHABET
+
+        def naive_encode(value):
+            encoded = ""
+            while value:
+                value, digit = divmod(value, 66)
+                encoded = alphabet[digit] + encoded
+            return encoded or "-"
+
+        test_values = [0, 1, 65, 66, 9876543210, 2**64 - 1, 2**64, 2**128 - 1, 2**256 + 12345, 3**2000]
+        for value in test_values:
+            encoded = k_hhc.encode_bigint(value)
+            self.assertEqual(encoded, naive_encode(value))
+            self.assertEqual(k_hhc.decode_bigint(encoded), value)
+
+        # Small values agree with the fixed-width encoders, and padding is accepted
+        self.assertEqual(k_hhc.encode_bigint(9876543210), k_hhc.encode_unpadded_64bit(9876543210))
+        self.assertEqual(k_hhc.decode_bigint("-----5tVfK4"), 9876543210)
+        self.assertEqual(k_hhc.encode_bigint(0), "-")
+
+    def test_bigint_errors(self):
+        """Test arbitrary-precision error handling."""
+        with self.assertRaises(OverflowError):
+            k_hhc.encode_bigint(-1)
+
+        with self.assertRaises(TypeError):
+            k_hhc.encode_bigint(1.5)
+
+        with self.assertRaises(ValueError):
+            k_hhc.decode_bigint("")
+
+        with self.assertRaises(ValueError):
+            k_hhc.decode_bigint("INVALID!")
+
 
 if __name__ == "__main__":
     unittest.main()
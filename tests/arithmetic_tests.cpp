@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_arithmetic.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file arithmetic_tests.cpp
+ * @brief Unit tests covering comparison and arithmetic on encoded strings.
+ */
+
+
+using hhc::hhc32_codec;
+using hhc::hhc64_codec;
+
+using std::string;
+
+namespace {
+
+template <typename Codec>
+string padded(typename Codec::value_type value) {
+    string text(Codec::ENCODED_LENGTH, '\0');
+    Codec::encode_padded(value, text.data());
+    return text;
+}
+
+template <typename Codec>
+string unpadded(typename Codec::value_type value) {
+    char text[Codec::STRING_LENGTH] = {};
+    Codec::encode_unpadded(value, text);
+    return text;
+}
+
+struct reversed_alphabet {
+    static constexpr auto symbols = hhc::detail::make_symbols("9876543210");
+};
+
+int sign(int value) {
+    return (value > 0) - (value < 0);
+}
+
+const std::vector<uint64_t> SAMPLES = {0ULL, 1ULL, 65ULL, 66ULL, 4355ULL, 4356ULL, 629717763ULL,
+                                       0xFFFFFFFFULL, 0x123456789ABCDEFULL, UINT64_MAX - 1, UINT64_MAX};
+
+} // namespace
+
+TEST(HhcArithmeticTest, ComparePaddedMatchesNumericOrder) {
+    for (uint64_t a : SAMPLES) {
+        for (uint64_t b : SAMPLES) {
+            const int expected = (a > b) - (a < b);
+            ASSERT_EQ(sign(hhc::compare_encoded(padded<hhc64_codec>(a), padded<hhc64_codec>(b))), expected)
+                << a << " vs " << b;
+        }
+    }
+}
+
+TEST(HhcArithmeticTest, CompareMixedPaddedAndUnpadded) {
+    for (uint64_t a : SAMPLES) {
+        for (uint64_t b : SAMPLES) {
+            const int expected = (a > b) - (a < b);
+            ASSERT_EQ(sign(hhc::compare_encoded(unpadded<hhc64_codec>(a), padded<hhc64_codec>(b))), expected)
+                << a << " vs " << b;
+            ASSERT_EQ(sign(hhc::compare_encoded(padded<hhc64_codec>(a), unpadded<hhc64_codec>(b))), expected)
+                << a << " vs " << b;
+            ASSERT_EQ(sign(hhc::compare_encoded(unpadded<hhc64_codec>(a), unpadded<hhc64_codec>(b))), expected)
+                << a << " vs " << b;
+        }
+    }
+}
+
+TEST(HhcArithmeticTest, CompareIgnoresExtraPadding) {
+    EXPECT_EQ(hhc::compare_encoded("---.", "."), 0);
+    EXPECT_EQ(hhc::compare_encoded("", "-----------"), 0);
+    EXPECT_LT(hhc::compare_encoded("--.", "0"), 0);
+}
+
+TEST(HhcArithmeticTest, CompareNonAsciiOrderedAlphabet) {
+    using reversed = hhc::basic_codec<reversed_alphabet, uint32_t>;
+    EXPECT_LT(hhc::compare_encoded<reversed>(padded<reversed>(5), padded<reversed>(7)), 0);
+    EXPECT_GT(hhc::compare_encoded<reversed>(unpadded<reversed>(1000), padded<reversed>(999)), 0);
+}
+
+TEST(HhcArithmeticTest, MinAndMax) {
+    const string small = padded<hhc64_codec>(42);
+    const string large = unpadded<hhc64_codec>(1000);
+    EXPECT_EQ(hhc::min_encoded(small, large), small);
+    EXPECT_EQ(hhc::min_encoded(large, small), small);
+    EXPECT_EQ(hhc::max_encoded(small, large), large);
+    EXPECT_EQ(hhc::max_encoded(large, small), large);
+}
+
+TEST(HhcArithmeticTest, AddMatchesIntegerAddition) {
+    for (uint64_t a : SAMPLES) {
+        for (uint64_t b : SAMPLES) {
+            if (a > UINT64_MAX - b) {
+                continue;
+            }
+            string sum(hhc64_codec::ENCODED_LENGTH, '\0');
+            hhc::add_encoded(padded<hhc64_codec>(a).data(), padded<hhc64_codec>(b).data(), sum.data());
+            ASSERT_EQ(sum, padded<hhc64_codec>(a + b)) << a << " + " << b;
+        }
+    }
+}
+
+TEST(HhcArithmeticTest, SubtractMatchesIntegerSubtraction) {
+    for (uint64_t a : SAMPLES) {
+        for (uint64_t b : SAMPLES) {
+            if (b > a) {
+                continue;
+            }
+            string difference(hhc64_codec::ENCODED_LENGTH, '\0');
+            hhc::subtract_encoded(padded<hhc64_codec>(a).data(), padded<hhc64_codec>(b).data(), difference.data());
+            ASSERT_EQ(difference, padded<hhc64_codec>(a - b)) << a << " - " << b;
+        }
+    }
+}
+
+TEST(HhcArithmeticTest, AddAndSubtractValueMatchIntegerArithmetic) {
+    for (uint64_t a : SAMPLES) {
+        for (uint64_t delta : SAMPLES) {
+            string out(hhc64_codec::ENCODED_LENGTH, '\0');
+            if (a <= UINT64_MAX - delta) {
+                hhc::add_encoded_value(padded<hhc64_codec>(a).data(), delta, out.data());
+                ASSERT_EQ(out, padded<hhc64_codec>(a + delta)) << a << " + " << delta;
+            }
+            if (delta <= a) {
+                hhc::subtract_encoded_value(padded<hhc64_codec>(a).data(), delta, out.data());
+                ASSERT_EQ(out, padded<hhc64_codec>(a - delta)) << a << " - " << delta;
+            }
+        }
+    }
+}
+
+TEST(HhcArithmeticTest, OutputMayAliasInput) {
+    string cursor = padded<hhc32_codec>(1000);
+    hhc::add_encoded_value<hhc32_codec>(cursor.data(), 25, cursor.data());
+    EXPECT_EQ(cursor, padded<hhc32_codec>(1025));
+    hhc::subtract_encoded_value<hhc32_codec>(cursor.data(), 1025, cursor.data());
+    EXPECT_EQ(cursor, padded<hhc32_codec>(0));
+}
+
+TEST(HhcArithmeticTest, AddOverflowThrows) {
+    string sum(hhc32_codec::ENCODED_LENGTH, '\0');
+    EXPECT_THROW(hhc::add_encoded_value<hhc32_codec>(padded<hhc32_codec>(UINT32_MAX).data(), 1, sum.data()),
+                 std::out_of_range);
+    // Carry out of the top digit, not just past the maximum
+    const string top(hhc64_codec::ENCODED_LENGTH, hhc::ALPHABET.back());
+    EXPECT_THROW(hhc::add_encoded(top.data(), top.data(), sum.data()), std::out_of_range);
+}
+
+TEST(HhcArithmeticTest, SubtractUnderflowThrows) {
+    string difference(hhc64_codec::ENCODED_LENGTH, '\0');
+    EXPECT_THROW(hhc::subtract_encoded_value(padded<hhc64_codec>(5).data(), 6, difference.data()),
+                 std::out_of_range);
+}
+
+TEST(HhcArithmeticTest, SubtractFromOutOfRangeThrows) {
+    const string top(hhc64_codec::ENCODED_LENGTH, hhc::ALPHABET.back());
+    string difference(hhc64_codec::ENCODED_LENGTH, '\0');
+    EXPECT_THROW(hhc::subtract_encoded_value(top.data(), 1, difference.data()), std::out_of_range);
+}
+
+TEST(HhcArithmeticTest, InvalidCharacterThrows) {
+    string bad = padded<hhc64_codec>(7);
+    bad[3] = '!';
+    string out(hhc64_codec::ENCODED_LENGTH, '\0');
+    EXPECT_THROW(hhc::add_encoded_value(bad.data(), 1, out.data()), std::invalid_argument);
+    EXPECT_THROW(hhc::subtract_encoded(padded<hhc64_codec>(9).data(), bad.data(), out.data()), std::invalid_argument);
+}
+
+TEST(HhcArithmeticTest, UsableInConstantExpressions) {
+    static_assert(hhc::compare_encoded("--.", "0") < 0);
+    static_assert(hhc::max_encoded<hhc32_codec>("-----.", "0") == "0");
+    constexpr auto sum = [] {
+        std::array<char, hhc32_codec::ENCODED_LENGTH> out{};
+        hhc::add_encoded_value<hhc32_codec>("-----.", 65, out.data());
+        return out;
+    }();
+    EXPECT_EQ(string(sum.data(), sum.size()), padded<hhc32_codec>(66));
+}
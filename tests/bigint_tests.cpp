@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_bigint.hpp"
+#include "hhc_128bit.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @file bigint_tests.cpp
+ * @brief Unit tests covering the arbitrary-precision integer codec.
+ */
+
+
+using hhc::big_uint;
+using hhc::hhc_bigint_encode;
+using hhc::hhc_bigint_decode;
+using hhc::ALPHABET;
+
+using std::string;
+using std::vector;
+
+namespace {
+
+/**
+ * @brief Reference encoder: repeated long division of big-endian bytes by 66, one digit at a time.
+ */
+string naive_encode(vector<uint8_t> bytes) {
+    string output;
+    while (std::any_of(bytes.begin(), bytes.end(), [](uint8_t byte) { return byte != 0; })) {
+        uint32_t remainder = 0;
+        for (auto& byte : bytes) {
+            const uint32_t current = (remainder << 8) | byte;
+            byte = static_cast<uint8_t>(current / hhc::BASE);
+            remainder = current % hhc::BASE;
+        }
+        output.insert(output.begin(), ALPHABET[remainder]);
+    }
+    return output.empty() ? string(1, ALPHABET[0]) : output;
+}
+
+vector<uint8_t> random_bytes(std::size_t size, uint64_t& state) {
+    vector<uint8_t> bytes(size);
+    for (auto& byte : bytes) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        byte = static_cast<uint8_t>(state >> 56);
+    }
+    return bytes;
+}
+
+} // namespace
+
+TEST(HhcBigintTest, ZeroEncodesToSingleSymbol) {
+    EXPECT_EQ(hhc_bigint_encode(big_uint()), "-");
+    EXPECT_EQ(hhc_bigint_encode(big_uint(0)), "-");
+    EXPECT_TRUE(hhc_bigint_decode("-").is_zero());
+    EXPECT_TRUE(hhc_bigint_decode("-----------------------------").is_zero());
+}
+
+TEST(HhcBigintTest, MatchesFixedWidthEncoders) {
+    uint64_t state = 3;
+    for (int i = 0; i < 2000; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        const uint64_t value = state >> (i % 64);
+        char expected[hhc::HHC_64BIT_STRING_LENGTH] = {};
+        hhc::hhc_64bit_encode_unpadded(value, expected);
+        const string encoded = hhc_bigint_encode(big_uint(value));
+        ASSERT_EQ(encoded, value == 0 ? "-" : string(expected));
+        ASSERT_EQ(hhc_bigint_decode(encoded.c_str()), big_uint(value));
+    }
+
+    const uint64_t max = UINT64_MAX;
+    EXPECT_EQ(hhc_bigint_encode(big_uint(max)), hhc::HHC_64BIT_ENCODED_MAX_STRING);
+
+#if defined(__SIZEOF_INT128__)
+    const vector<uint8_t> all_ones(16, 0xFF);
+    EXPECT_EQ(hhc_bigint_encode(big_uint::from_bytes(all_ones.data(), all_ones.size())),
+              hhc::HHC_128BIT_ENCODED_MAX_STRING);
+#endif
+}
+
+TEST(HhcBigintTest, PowerBoundariesRoundTrip) {
+    // 66^(10 * 2^k) - 1, 66^(10 * 2^k) and 66^(10 * 2^k) + 1 straddle every split point
+    for (std::size_t digits : {9U, 10U, 11U, 19U, 20U, 21U, 40U, 41U, 160U, 161U, 321U}) {
+        const string nines(digits, ALPHABET.back());
+        const big_uint value = hhc_bigint_decode(nines.c_str());
+        EXPECT_EQ(hhc_bigint_encode(value), nines);
+
+        const string power = "." + string(digits, ALPHABET[0]);
+        EXPECT_EQ(hhc_bigint_encode(hhc_bigint_decode(power.c_str())), power);
+
+        const string power_plus_one = "." + string(digits - 1, ALPHABET[0]) + ".";
+        EXPECT_EQ(hhc_bigint_encode(hhc_bigint_decode(power_plus_one.c_str())), power_plus_one);
+    }
+}
+
+TEST(HhcBigintTest, MatchesNaiveConversion) {
+    uint64_t state = 11;
+    for (std::size_t bits : {65U, 128U, 256U, 512U, 1024U, 2048U, 4096U, 8192U}) {
+        for (int trial = 0; trial < 4; ++trial) {
+            const vector<uint8_t> bytes = random_bytes(bits / 8 + 1, state);
+            const big_uint value = big_uint::from_bytes(bytes.data(), bytes.size());
+            const string expected = naive_encode(bytes);
+            ASSERT_EQ(hhc_bigint_encode(value), expected) << bits << " bits";
+            ASSERT_EQ(hhc_bigint_decode(expected.c_str()), value) << bits << " bits";
+        }
+    }
+}
+
+TEST(HhcBigintTest, LargeValuesRoundTrip) {
+    uint64_t state = 17;
+    for (std::size_t bytes_count : {4000U, 12345U}) {
+        const vector<uint8_t> bytes = random_bytes(bytes_count, state);
+        const big_uint value = big_uint::from_bytes(bytes.data(), bytes.size());
+        const string encoded = hhc_bigint_encode(value);
+        const big_uint decoded = hhc_bigint_decode(encoded.c_str());
+        ASSERT_EQ(decoded, value);
+        ASSERT_EQ(decoded.to_bytes(), bytes);
+    }
+}
+
+TEST(HhcBigintTest, DecodeAcceptsPadding) {
+    EXPECT_EQ(hhc_bigint_decode("5tVfK4"), big_uint(9876543210ULL));
+    EXPECT_EQ(hhc_bigint_decode("-----5tVfK4"), big_uint(9876543210ULL));
+    EXPECT_EQ(hhc_bigint_decode("------------------------5tVfK4"), big_uint(9876543210ULL));
+}
+
+TEST(HhcBigintTest, DecodeRejectsInvalidInput) {
+    EXPECT_THROW(hhc_bigint_decode(nullptr), std::invalid_argument);
+    EXPECT_THROW(hhc_bigint_decode(""), std::invalid_argument);
+    EXPECT_THROW(hhc_bigint_decode("abc!"), std::invalid_argument);
+    EXPECT_THROW(hhc_bigint_decode("--/"), std::invalid_argument);
+}
+
+TEST(HhcBigintTest, BytesRoundTrip) {
+    const vector<uint8_t> bytes = {0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05};
+    const big_uint value = big_uint::from_bytes(bytes.data(), bytes.size());
+    EXPECT_EQ(value.bit_width(), 33U);
+    EXPECT_EQ(value.limbs(), (vector<uint32_t>{0x02030405U, 0x01U}));
+    EXPECT_EQ(value.to_bytes(), (vector<uint8_t>{0x01, 0x02, 0x03, 0x04, 0x05}));
+    EXPECT_TRUE(big_uint::from_bytes(nullptr, 0).is_zero());
+    EXPECT_TRUE(big_uint().to_bytes().empty());
+    EXPECT_TRUE(big_uint(5) < big_uint(6));
+    EXPECT_TRUE(big_uint(UINT64_MAX) < big_uint::from_limbs({0, 0, 1}));
+}
@@ -0,0 +1,23 @@
+#include "hhc_c.h"
+
+/**
+ * @file capi_c_tests.c
+ * @brief Compiles hhc_c.h as strict C99 and calls the library from C; capi_tests.cpp checks the result.
+ */
+
+hhc_status hhc_c_round_trip(uint64_t value, uint64_t* decoded) {
+    char encoded[HHC_C_64BIT_ENCODED_LENGTH];
+    hhc_kernel_info info;
+    hhc_status status;
+
+    info.struct_size = (uint32_t)sizeof(info);
+    status = hhc_get_kernel_info(&info);
+    if (status != HHC_OK) {
+        return status;
+    }
+    status = hhc_encode64_padded(value, encoded);
+    if (status != HHC_OK) {
+        return status;
+    }
+    return hhc_decode64(encoded, sizeof(encoded), decoded);
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include "hhc_c.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/**
+ * @file capi_tests.cpp
+ * @brief Unit tests covering the C ABI exported by libk-hhc.so.
+ */
+
+
+using std::string;
+using std::vector;
+
+#if !defined(HHC_CAPI_NO_C_TESTS)
+// Defined in capi_c_tests.c, which is compiled as C
+extern "C" hhc_status hhc_c_round_trip(uint64_t value, uint64_t* decoded);
+#endif
+
+TEST(CApiTest, KernelInfo) {
+    hhc_kernel_info info{};
+    info.struct_size = sizeof(info);
+    ASSERT_EQ(hhc_get_kernel_info(&info), HHC_OK);
+    EXPECT_EQ(info.struct_size, sizeof(info));
+    EXPECT_EQ(info.api_version, static_cast<uint32_t>(HHC_C_API_VERSION));
+    ASSERT_NE(info.library_version, nullptr);
+    EXPECT_GT(std::strlen(info.library_version), 0U);
+    EXPECT_NE(info.encode_kernel, nullptr);
+    EXPECT_NE(info.decode_kernel, nullptr);
+
+    // An older caller that only knows the first two fields gets only those written
+    hhc_kernel_info partial{};
+    std::memset(&partial, 0xAB, sizeof(partial));
+    partial.struct_size = 2 * sizeof(uint32_t);
+    ASSERT_EQ(hhc_get_kernel_info(&partial), HHC_OK);
+    EXPECT_EQ(partial.api_version, static_cast<uint32_t>(HHC_C_API_VERSION));
+    const unsigned char* tail = reinterpret_cast<const unsigned char*>(&partial) + 2 * sizeof(uint32_t);
+    EXPECT_EQ(tail[0], 0xAB);
+
+    EXPECT_EQ(hhc_get_kernel_info(nullptr), HHC_ERROR_NULL_POINTER);
+}
+
+TEST(CApiTest, StatusStrings) {
+    for (hhc_status status = HHC_OK; status <= HHC_ERROR_INTERNAL; ++status) {
+        EXPECT_STRNE(hhc_status_string(status), "unknown status");
+    }
+    EXPECT_STREQ(hhc_status_string(-1), "unknown status");
+}
+
+TEST(CApiTest, EncodeSingle) {
+    char buffer[HHC_C_64BIT_ENCODED_LENGTH] = {};
+    ASSERT_EQ(hhc_encode32_padded(424242U, buffer), HHC_OK);
+    EXPECT_EQ(string(buffer, HHC_C_32BIT_ENCODED_LENGTH), "--.TNv");
+    ASSERT_EQ(hhc_encode64_padded(UINT64_MAX, buffer), HHC_OK);
+    EXPECT_EQ(string(buffer, HHC_C_64BIT_ENCODED_LENGTH), "9lH9ebONzYD");
+
+    size_t length = 99;
+    ASSERT_EQ(hhc_encode64_unpadded(9876543210ULL, buffer, &length), HHC_OK);
+    EXPECT_EQ(string(buffer, length), "5tVfK4");
+    ASSERT_EQ(hhc_encode32_unpadded(0, buffer, &length), HHC_OK);
+    EXPECT_EQ(length, 0U);
+
+    EXPECT_EQ(hhc_encode32_padded(1, nullptr), HHC_ERROR_NULL_POINTER);
+    EXPECT_EQ(hhc_encode64_unpadded(1, buffer, nullptr), HHC_ERROR_NULL_POINTER);
+}
+
+TEST(CApiTest, DecodeSingle) {
+    uint32_t value32 = 0;
+    uint64_t value64 = 0;
+    EXPECT_EQ(hhc_decode32(".TNv", 4, &value32), HHC_OK);
+    EXPECT_EQ(value32, 424242U);
+    EXPECT_EQ(hhc_decode64("5tVfK4 trailing", 6, &value64), HHC_OK);
+    EXPECT_EQ(value64, 9876543210ULL);
+
+    EXPECT_EQ(hhc_decode32("", 0, &value32), HHC_ERROR_INVALID_LENGTH);
+    EXPECT_EQ(hhc_decode32("1234567", 7, &value32), HHC_ERROR_INVALID_LENGTH);
+    EXPECT_EQ(hhc_decode64("5t fK4", 6, &value64), HHC_ERROR_INVALID_CHARACTER);
+    EXPECT_EQ(hhc_decode32("1QLCp2", 6, &value32), HHC_ERROR_OUT_OF_RANGE);
+    EXPECT_EQ(hhc_decode64("9lH9ebONzYE", 11, &value64), HHC_ERROR_OUT_OF_RANGE);
+    EXPECT_EQ(hhc_decode64(nullptr, 1, &value64), HHC_ERROR_NULL_POINTER);
+    EXPECT_EQ(hhc_decode64("-", 1, nullptr), HHC_ERROR_NULL_POINTER);
+}
+
+TEST(CApiTest, BatchRoundTrip) {
+    vector<uint64_t> values(257);
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    for (auto& value : values) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        value = seed;
+    }
+    string encoded(values.size() * HHC_C_64BIT_ENCODED_LENGTH, '\0');
+    ASSERT_EQ(hhc_encode64_padded_batch(values.data(), values.size(), encoded.data()), HHC_OK);
+
+    vector<uint64_t> decoded(values.size());
+    ASSERT_EQ(hhc_decode64_batch(encoded.data(), values.size(), decoded.data(), nullptr), HHC_OK);
+    EXPECT_EQ(decoded, values);
+
+    const vector<uint32_t> values32 = {0, 1, 424242U, UINT32_MAX};
+    string encoded32(values32.size() * HHC_C_32BIT_ENCODED_LENGTH, '\0');
+    ASSERT_EQ(hhc_encode32_padded_batch(values32.data(), values32.size(), encoded32.data()), HHC_OK);
+    EXPECT_EQ(encoded32, "------" "-----." "--.TNv" "1QLCp1");
+    vector<uint32_t> decoded32(values32.size());
+    ASSERT_EQ(hhc_decode32_batch(encoded32.data(), values32.size(), decoded32.data(), nullptr), HHC_OK);
+    EXPECT_EQ(decoded32, values32);
+
+    EXPECT_EQ(hhc_encode64_padded_batch(nullptr, 0, nullptr), HHC_OK);
+    EXPECT_EQ(hhc_decode64_batch(nullptr, 1, decoded.data(), nullptr), HHC_ERROR_NULL_POINTER);
+}
+
+TEST(CApiTest, BatchReportsOffendingRecord) {
+    string encoded = "-----------" "-----5tVfK4" "-----5t!fK4" "-----------";
+    vector<uint64_t> decoded(4, 7);
+    size_t error_index = 99;
+    EXPECT_EQ(hhc_decode64_batch(encoded.data(), 4, decoded.data(), &error_index), HHC_ERROR_INVALID_CHARACTER);
+    EXPECT_EQ(error_index, 2U);
+    EXPECT_EQ(decoded[0], 0U);
+    EXPECT_EQ(decoded[1], 9876543210ULL);
+
+    const string overflow = "--.TNv" "1QLCp2";
+    vector<uint32_t> decoded32(2);
+    EXPECT_EQ(hhc_decode32_batch(overflow.data(), 2, decoded32.data(), &error_index), HHC_ERROR_OUT_OF_RANGE);
+    EXPECT_EQ(error_index, 1U);
+}
+
+#if !defined(HHC_CAPI_NO_C_TESTS)
+
+TEST(CApiTest, CallableFromC) {
+    uint64_t decoded = 0;
+    EXPECT_EQ(hhc_c_round_trip(9876543210ULL, &decoded), HHC_OK);
+    EXPECT_EQ(decoded, 9876543210ULL);
+}
+
+#endif
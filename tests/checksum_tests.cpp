@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_checksum.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @file checksum_tests.cpp
+ * @brief Unit tests covering the Luhn mod 66 check symbol codecs.
+ */
+
+
+using hhc::checksum_codec32;
+using hhc::checksum_codec64;
+using hhc::hhc32_codec;
+using hhc::hhc64_codec;
+
+using std::string;
+using std::vector;
+
+namespace {
+
+string checked64(uint64_t value) {
+    string text(checksum_codec64::ENCODED_LENGTH, '\0');
+    checksum_codec64::encode_padded(value, text.data());
+    return text;
+}
+
+bool verifies(const string& text) {
+    return checksum_codec64::verify(text.data(), text.size());
+}
+
+} // namespace
+
+TEST(ChecksumTest, AppendsCheckSymbolToPlainEncoding) {
+    std::mt19937_64 rng(1);
+    for (int i = 0; i < 1000; ++i) {
+        const uint64_t value = rng() >> (rng() % 64);
+        const string text = checked64(value);
+        char plain[hhc64_codec::ENCODED_LENGTH];
+        hhc64_codec::encode_padded(value, plain);
+        EXPECT_EQ(text.compare(0, sizeof(plain), plain, sizeof(plain)), 0);
+        EXPECT_EQ(text.back(), checksum_codec64::check_symbol(plain, sizeof(plain)));
+        EXPECT_TRUE(verifies(text));
+        EXPECT_EQ(checksum_codec64::decode(text.data(), text.size()), value);
+    }
+    EXPECT_EQ(checked64(0), "------------");
+}
+
+TEST(ChecksumTest, ThirtyTwoBitRoundTrip) {
+    for (const uint32_t value : {0U, 1U, 65U, 66U, 123456789U, std::numeric_limits<uint32_t>::max()}) {
+        char text[checksum_codec32::ENCODED_LENGTH];
+        checksum_codec32::encode_padded(value, text);
+        EXPECT_EQ(text[hhc32_codec::ENCODED_LENGTH], checksum_codec32::check_symbol(text, hhc32_codec::ENCODED_LENGTH));
+        EXPECT_EQ(checksum_codec32::decode(text, sizeof(text)), value);
+    }
+}
+
+TEST(ChecksumTest, UnpaddedFormKeepsTheSameCheckSymbol) {
+    for (const uint64_t value : {uint64_t{0}, uint64_t{1}, uint64_t{4355}, uint64_t{99999999},
+                                 std::numeric_limits<uint64_t>::max()}) {
+        char unpadded[checksum_codec64::STRING_LENGTH];
+        checksum_codec64::encode_unpadded(value, unpadded);
+        const string padded = checked64(value);
+        EXPECT_EQ(unpadded[std::strlen(unpadded) - 1], padded.back());
+        EXPECT_EQ(checksum_codec64::decode(unpadded), value);
+    }
+    char zero[checksum_codec64::STRING_LENGTH];
+    checksum_codec64::encode_unpadded(0, zero);
+    EXPECT_STREQ(zero, "-");
+}
+
+TEST(ChecksumTest, CatchesEverySingleSubstitution) {
+    std::mt19937_64 rng(2);
+    for (int sample = 0; sample < 50; ++sample) {
+        const string text = checked64(rng());
+        for (std::size_t pos = 0; pos < text.size(); ++pos) {
+            for (const char symbol : hhc::ALPHABET) {
+                if (symbol == text[pos]) {
+                    continue;
+                }
+                string typo = text;
+                typo[pos] = symbol;
+                EXPECT_FALSE(verifies(typo)) << typo;
+            }
+        }
+    }
+}
+
+TEST(ChecksumTest, CatchesAdjacentTranspositionsExceptFirstAndLastSymbols) {
+    // Every ordered pair of distinct digits, swapped at every pair of data positions
+    for (std::size_t pos = 0; pos + 2 < checksum_codec64::ENCODED_LENGTH; ++pos) {
+        for (const char a : hhc::ALPHABET) {
+            for (const char b : hhc::ALPHABET) {
+                if (a == b) {
+                    continue;
+                }
+                string original = checked64(0);
+                original[pos] = a;
+                original[pos + 1] = b;
+                original.back() = checksum_codec64::check_symbol(original.data(), original.size() - 1);
+                string swapped = original;
+                std::swap(swapped[pos], swapped[pos + 1]);
+                const bool blind_spot = (a == '-' && b == '~') || (a == '~' && b == '-');
+                EXPECT_EQ(verifies(swapped), blind_spot) << original << " -> " << swapped;
+            }
+        }
+    }
+}
+
+TEST(ChecksumTest, DecodeRejectsBadInput) {
+    string text = checked64(123456789);
+    text[3] = text[3] == 'A' ? 'B' : 'A';
+    EXPECT_THROW(checksum_codec64::decode(text.data(), text.size()), std::invalid_argument);
+    EXPECT_THROW(checksum_codec64::decode("abc"), std::invalid_argument);
+    EXPECT_THROW(checksum_codec64::decode("ab!"), std::invalid_argument);
+    EXPECT_THROW(checksum_codec64::decode(""), std::invalid_argument);
+    EXPECT_THROW(checksum_codec64::decode("-------------"), std::invalid_argument);
+    EXPECT_THROW(checksum_codec64::decode(nullptr), std::invalid_argument);
+
+    // Beyond UINT64_MAX but with a correct check symbol
+    string over(hhc64_codec::ENCODED_LENGTH, '~');
+    over += checksum_codec64::check_symbol(over.data(), over.size());
+    EXPECT_TRUE(verifies(over));
+    EXPECT_THROW(checksum_codec64::decode(over.data(), over.size()), std::out_of_range);
+}
+
+TEST(ChecksumTest, BatchEncodeDecodeAndVerify) {
+    vector<uint64_t> values(100);
+    for (uint64_t i = 0; i < values.size(); ++i) {
+        values[i] = i * 1000003;
+    }
+    string records(values.size() * checksum_codec64::ENCODED_LENGTH, '\0');
+    checksum_codec64::encode_padded_batch(values.data(), values.size(), records.data());
+    EXPECT_EQ(records.substr(5 * 12, 12), checked64(values[5]));
+
+    vector<uint64_t> decoded(values.size());
+    checksum_codec64::decode_batch(records.data(), values.size(), decoded.data());
+    EXPECT_EQ(decoded, values);
+
+    records[7 * 12 + 4] = records[7 * 12 + 4] == 'x' ? 'y' : 'x';
+    records[42 * 12 + 11] = records[42 * 12 + 11] == 'x' ? 'y' : 'x';
+    bool valid[100] = {};
+    EXPECT_EQ(checksum_codec64::verify_batch(records.data(), values.size(), valid), 98U);
+    EXPECT_FALSE(valid[7]);
+    EXPECT_FALSE(valid[42]);
+    EXPECT_TRUE(valid[8]);
+    EXPECT_THROW(checksum_codec64::decode_batch(records.data(), values.size(), decoded.data()), std::invalid_argument);
+}
+
+TEST(ChecksumTest, UsableAtCompileTime) {
+    constexpr auto text = [] {
+        std::array<char, checksum_codec64::ENCODED_LENGTH> out{};
+        checksum_codec64::encode_padded(987654321, out.data());
+        return out;
+    }();
+    static_assert(checksum_codec64::verify(text.data(), text.size()));
+    static_assert(checksum_codec64::decode(text.data(), text.size()) == 987654321);
+}
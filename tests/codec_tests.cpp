@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_codec.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file codec_tests.cpp
+ * @brief Unit tests covering the compile-time generic codec template.
+ */
+
+
+using hhc::basic_codec;
+using hhc::base36_alphabet;
+using hhc::base58_alphabet;
+using hhc::base62_alphabet;
+using hhc::hhc32_codec;
+using hhc::hhc64_codec;
+using hhc::hhc_32bit_encode_padded;
+using hhc::hhc_64bit_encode_padded;
+using hhc::HHC_32BIT_ENCODED_MAX_STRING;
+using hhc::HHC_64BIT_ENCODED_MAX_STRING;
+
+using std::string;
+using std::string_view;
+using std::vector;
+
+using base62_64 = basic_codec<base62_alphabet, uint64_t>;
+using base58_64 = basic_codec<base58_alphabet, uint64_t>;
+using base36_32 = basic_codec<base36_alphabet, uint32_t>;
+
+constexpr auto U32_MAX_VALUE = std::numeric_limits<uint32_t>::max();
+constexpr auto U64_MAX_VALUE = std::numeric_limits<uint64_t>::max();
+
+static_assert(base62_64::BASE == 62);
+static_assert(base62_64::ENCODED_LENGTH == 11);
+static_assert(base58_64::ENCODED_LENGTH == 11);
+static_assert(base36_32::ENCODED_LENGTH == 7);
+static_assert(base36_32::STRING_LENGTH == 8);
+static_assert(base36_32::decode(base36_32::MAX_STRING.data()) == U32_MAX_VALUE);
+static_assert(base62_64::decode("1") == 1);
+
+namespace {
+
+/**
+ * @brief Straightforward reference encoder used to cross-check the table-driven kernels.
+ */
+template <typename Codec>
+string reference_encode(typename Codec::value_type value) {
+    string encoded(Codec::ENCODED_LENGTH, Codec::ALPHABET[0]);
+    for (std::size_t pos = Codec::ENCODED_LENGTH; pos > 0; --pos) {
+        encoded[pos - 1] = Codec::ALPHABET[value % Codec::BASE];
+        value /= Codec::BASE;
+    }
+    return encoded;
+}
+
+template <typename Codec>
+string encode_padded(typename Codec::value_type value) {
+    string encoded(Codec::ENCODED_LENGTH, '\0');
+    Codec::encode_padded(value, encoded.data());
+    return encoded;
+}
+
+} // namespace
+
+TEST(HhcCodecTest, HhcAlphabetMatchesBuiltInConstants) {
+    EXPECT_EQ(string_view(hhc32_codec::MAX_STRING.data()), HHC_32BIT_ENCODED_MAX_STRING);
+    EXPECT_EQ(string_view(hhc64_codec::MAX_STRING.data()), HHC_64BIT_ENCODED_MAX_STRING);
+}
+
+TEST(HhcCodecTest, HhcAlphabetMatchesBuiltInEncoders) {
+    for (uint64_t value = 0; value < 100000; value += 7) {
+        char expected[hhc::HHC_64BIT_STRING_LENGTH] = {};
+        hhc_64bit_encode_padded(value * 0x9E3779B97F4A7C15ULL, expected);
+        EXPECT_EQ(encode_padded<hhc64_codec>(value * 0x9E3779B97F4A7C15ULL), string(expected, 11));
+
+        char expected32[hhc::HHC_32BIT_STRING_LENGTH] = {};
+        hhc_32bit_encode_padded(static_cast<uint32_t>(value * 2654435761U), expected32);
+        EXPECT_EQ(encode_padded<hhc32_codec>(static_cast<uint32_t>(value * 2654435761U)), string(expected32, 6));
+    }
+}
+
+TEST(HhcCodecTest, Base62MaxString) {
+    EXPECT_EQ(string_view(base62_64::MAX_STRING.data()), "LygHa16AHYF");
+    EXPECT_EQ(encode_padded<base62_64>(U64_MAX_VALUE), "LygHa16AHYF");
+}
+
+TEST(HhcCodecTest, KernelsMatchReferenceEncoder) {
+    uint64_t value = 0x0123456789ABCDEFULL;
+    for (int i = 0; i < 10000; ++i) {
+        value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+        ASSERT_EQ(encode_padded<base62_64>(value), reference_encode<base62_64>(value));
+        ASSERT_EQ(encode_padded<base58_64>(value), reference_encode<base58_64>(value));
+        ASSERT_EQ(encode_padded<base36_32>(static_cast<uint32_t>(value)),
+                  reference_encode<base36_32>(static_cast<uint32_t>(value)));
+    }
+}
+
+TEST(HhcCodecTest, RoundTripAllAlphabets) {
+    uint64_t value = 42;
+    for (int i = 0; i < 10000; ++i) {
+        value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+        ASSERT_EQ(base62_64::decode(encode_padded<base62_64>(value).c_str()), value);
+        ASSERT_EQ(base58_64::decode_unsafe(encode_padded<base58_64>(value).c_str()), value);
+        ASSERT_EQ(base36_32::decode(encode_padded<base36_32>(static_cast<uint32_t>(value)).c_str()),
+                  static_cast<uint32_t>(value));
+    }
+}
+
+TEST(HhcCodecTest, EncodeUnpaddedStripsLeadingZeroDigits) {
+    char buffer[base62_64::STRING_LENGTH] = {};
+    base62_64::encode_unpadded(61, buffer);
+    EXPECT_STREQ(buffer, "z");
+    base62_64::encode_unpadded(0, buffer);
+    EXPECT_STREQ(buffer, "");
+    base62_64::encode_unpadded(U64_MAX_VALUE, buffer);
+    EXPECT_STREQ(buffer, "LygHa16AHYF");
+}
+
+TEST(HhcCodecTest, DecodeAcceptsUnpaddedInput) {
+    EXPECT_EQ(base62_64::decode("z"), 61U);
+    EXPECT_EQ(base62_64::decode("10"), 62U);
+    EXPECT_EQ(base36_32::decode("zz"), 36U * 36U - 1U);
+}
+
+TEST(HhcCodecTest, DecodeRejectsCharactersOutsideAlphabet) {
+    // 0, O, I and l are not part of base58
+    EXPECT_THROW(base58_64::decode("10"), std::invalid_argument);
+    EXPECT_THROW(base58_64::decode("1l"), std::invalid_argument);
+    EXPECT_THROW(base62_64::decode("ab-"), std::invalid_argument);
+}
+
+TEST(HhcCodecTest, DecodeRejectsInvalidLengths) {
+    EXPECT_THROW(base62_64::decode(nullptr), std::invalid_argument);
+    EXPECT_THROW(base62_64::decode(""), std::invalid_argument);
+    EXPECT_THROW(base62_64::decode("000000000000"), std::invalid_argument);
+}
+
+TEST(HhcCodecTest, DecodeRejectsOutOfRange) {
+    EXPECT_EQ(base62_64::decode("LygHa16AHYF"), U64_MAX_VALUE);
+    EXPECT_THROW(base62_64::decode("LygHa16AHYG"), std::out_of_range);
+    EXPECT_THROW(base62_64::decode("zzzzzzzzzzz"), std::out_of_range);
+    EXPECT_THROW(base36_32::decode("1z141z4"), std::out_of_range);
+}
+
+TEST(HhcCodecTest, ValidateReturnsLength) {
+    EXPECT_EQ(base62_64::validate("abc"), 3U);
+    EXPECT_EQ(base62_64::validate("ab_"), 0U);
+    EXPECT_EQ(base62_64::validate(""), 0U);
+}
+
+TEST(HhcCodecTest, BatchEncodeMatchesScalar) {
+    vector<uint64_t> inputs(257);
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        inputs[i] = i * 0x9E3779B97F4A7C15ULL;
+    }
+    string batch(inputs.size() * hhc64_codec::ENCODED_LENGTH, '\0');
+    hhc64_codec::encode_padded_batch(inputs.data(), inputs.size(), batch.data());
+
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(batch.substr(i * 11, 11), encode_padded<hhc64_codec>(inputs[i]));
+    }
+}
+
+TEST(HhcCodecTest, BatchDecodeRoundTrips) {
+    vector<uint64_t> inputs(100);
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        inputs[i] = U64_MAX_VALUE - i * 0x1234567ULL;
+    }
+    string batch(inputs.size() * base62_64::ENCODED_LENGTH, '\0');
+    base62_64::encode_padded_batch(inputs.data(), inputs.size(), batch.data());
+
+    vector<uint64_t> decoded(inputs.size());
+    base62_64::decode_batch(batch.data(), decoded.size(), decoded.data());
+    EXPECT_EQ(decoded, inputs);
+
+    vector<uint64_t> decoded_unsafe(inputs.size());
+    base62_64::decode_unsafe_batch(batch.data(), decoded_unsafe.size(), decoded_unsafe.data());
+    EXPECT_EQ(decoded_unsafe, inputs);
+}
+
+TEST(HhcCodecTest, BatchDecodeRejectsInvalidRecords) {
+    string batch = string(HHC_64BIT_ENCODED_MAX_STRING) + "---------!-";
+    vector<uint64_t> decoded(2);
+    EXPECT_THROW(hhc64_codec::decode_batch(batch.data(), 2, decoded.data()), std::invalid_argument);
+
+    batch = "-----------9lH9ebONzYE";
+    EXPECT_THROW(hhc64_codec::decode_batch(batch.data(), 2, decoded.data()), std::out_of_range);
+}
+
+TEST(HhcCodecTest, BatchHandlesEmptyInput) {
+    EXPECT_NO_THROW(hhc64_codec::encode_padded_batch(nullptr, 0, nullptr));
+    EXPECT_NO_THROW(hhc64_codec::decode_batch(nullptr, 0, nullptr));
+}
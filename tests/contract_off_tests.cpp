@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+// This translation unit only includes hhc_assert.hpp, so it can select its own contract level
+#undef HHC_CONTRACT_LEVEL
+#define HHC_CONTRACT_LEVEL HHC_CONTRACT_OFF
+#include "hhc_assert.hpp"
+
+/**
+ * @file contract_off_tests.cpp
+ * @brief Unit tests for HHC_ASSERT at the off contract level.
+ * 
+ * At this level assertions compile to nothing: a failing condition is
+ * ignored and the expression is never evaluated.
+ */
+
+static_assert(HHC_CONTRACT_LEVEL == HHC_CONTRACT_OFF, "HHC_CONTRACT_LEVEL override was not honored");
+
+TEST(HhcContractOffTest, FailingConditionIsIgnored) {
+    HHC_ASSERT(false);
+    HHC_ASSERT_MSG(1 + 1 == 3, "Ignored at the off level");
+    SUCCEED();
+}
+
+TEST(HhcContractOffTest, ExpressionIsNotEvaluated) {
+    int counter = 0;
+    auto increment = [&counter]() -> bool {
+        counter++;
+        return false;
+    };
+
+    HHC_ASSERT(increment());
+    HHC_ASSERT_MSG(increment(), "Not evaluated");
+    EXPECT_EQ(counter, 0);
+}
+
+TEST(HhcContractOffTest, UsableInConstantExpressions) {
+    constexpr auto checked_double = [](int x) {
+        HHC_ASSERT(x > 0);
+        return x * 2;
+    };
+    static_assert(checked_double(21) == 42);
+    EXPECT_EQ(checked_double(-1), -2);
+}
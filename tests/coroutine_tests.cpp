@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_coroutine.hpp"
+
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @file coroutine_tests.cpp
+ * @brief Unit tests covering the C++20 coroutine stream generators.
+ */
+
+
+using hhc::co::async_generator;
+using hhc::co::decode_stream;
+using hhc::co::encode_stream;
+using hhc::co::generator;
+
+using std::string;
+using std::vector;
+
+namespace {
+
+vector<uint64_t> make_ids(std::size_t count) {
+    vector<uint64_t> ids(count);
+    uint64_t seed = 0x2545F4914F6CDD1DULL;
+    for (auto& id : ids) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        id = seed >> (seed & 31U);
+    }
+    return ids;
+}
+
+string encode_all(const vector<uint64_t>& ids) {
+    string encoded(ids.size() * hhc::HHC_64BIT_ENCODED_LENGTH, '\0');
+    hhc::hhc64_codec::encode_padded_batch(ids.data(), ids.size(), encoded.data());
+    return encoded;
+}
+
+/**
+ * @brief Single-threaded stand-in for an event loop: awaiting "I/O" parks the coroutine until run()
+ */
+class manual_loop {
+public:
+    struct io_awaiter {
+        manual_loop& loop;
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) const { loop.ready_.push_back(handle); }
+        void await_resume() const noexcept {}
+    };
+
+    io_awaiter wait_for_io() { return io_awaiter{*this}; }
+
+    std::size_t run() {
+        std::size_t resumed = 0;
+        while (!ready_.empty()) {
+            auto handle = ready_.front();
+            ready_.pop_front();
+            handle.resume();
+            ++resumed;
+        }
+        return resumed;
+    }
+
+private:
+    std::deque<std::coroutine_handle<>> ready_;
+};
+
+/**
+ * @brief Fire-and-forget coroutine used to drive the async consumers in the tests
+ */
+struct detached {
+    struct promise_type {
+        detached get_return_object() const noexcept { return {}; }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const { std::terminate(); }
+    };
+};
+
+/**
+ * @brief Async chunk source that waits for "I/O" before handing out each chunk
+ */
+template <typename Chunk>
+async_generator<Chunk> read_chunks(manual_loop& loop, vector<Chunk> chunks) {
+    for (const Chunk& chunk : chunks) {
+        co_await loop.wait_for_io();
+        co_yield chunk;
+    }
+}
+
+generator<vector<uint64_t>> produce_chunks(const vector<uint64_t>& ids, std::size_t chunk_size) {
+    for (std::size_t pos = 0; pos < ids.size(); pos += chunk_size) {
+        const std::size_t end = std::min(ids.size(), pos + chunk_size);
+        co_yield vector<uint64_t>(ids.begin() + static_cast<std::ptrdiff_t>(pos),
+                                  ids.begin() + static_cast<std::ptrdiff_t>(end));
+    }
+}
+
+} // namespace
+
+TEST(CoroutineTest, EncodeStreamRangeSource) {
+    const vector<uint64_t> ids = make_ids(100);
+    const vector<vector<uint64_t>> chunks = {
+        vector<uint64_t>(ids.begin(), ids.begin() + 40),
+        {},
+        vector<uint64_t>(ids.begin() + 40, ids.end()),
+    };
+
+    vector<string> yielded;
+    for (std::string_view encoded : encode_stream(chunks)) {
+        yielded.emplace_back(encoded);
+    }
+    ASSERT_EQ(yielded.size(), 2U);  // empty chunks are skipped
+    EXPECT_EQ(yielded[0] + yielded[1], encode_all(ids));
+}
+
+TEST(CoroutineTest, EncodeStreamGeneratorSourceOwned) {
+    const vector<uint64_t> ids = make_ids(33);
+    string encoded;
+    std::size_t chunks = 0;
+    for (std::string_view chunk : encode_stream(produce_chunks(ids, 10))) {
+        encoded += chunk;
+        ++chunks;
+    }
+    EXPECT_EQ(chunks, 4U);
+    EXPECT_EQ(encoded, encode_all(ids));
+}
+
+TEST(CoroutineTest, Encode32Stream) {
+    const vector<vector<uint32_t>> chunks = {{0U, 424242U, UINT32_MAX}};
+    string encoded;
+    for (std::string_view chunk : encode_stream<hhc::hhc32_codec>(chunks)) {
+        encoded += chunk;
+    }
+    EXPECT_EQ(encoded, "--------.TNv1QLCp1");
+}
+
+TEST(CoroutineTest, DecodeStreamCarriesSplitRecords) {
+    const vector<uint64_t> ids = make_ids(25);
+    const string encoded = encode_all(ids);
+    // Chunk sizes deliberately not multiples of the record length
+    const vector<string> chunks = {encoded.substr(0, 5), encoded.substr(5, 6), encoded.substr(11, 100),
+                                   encoded.substr(111)};
+
+    vector<uint64_t> decoded;
+    for (auto values : decode_stream(chunks)) {
+        decoded.insert(decoded.end(), values.begin(), values.end());
+    }
+    EXPECT_EQ(decoded, ids);
+}
+
+TEST(CoroutineTest, DecodeStreamErrors) {
+    const vector<string> truncated = {"-----5tVfK4", "-----"};
+    auto truncated_stream = decode_stream(truncated);
+    auto it = truncated_stream.begin();
+    EXPECT_EQ((*it)[0], 9876543210ULL);
+    EXPECT_THROW(++it, std::invalid_argument);
+
+    const vector<string> invalid = {"-----5tV!K4"};
+    EXPECT_THROW(decode_stream(invalid).begin(), std::invalid_argument);
+
+    const vector<string> overflow = {"9lH9ebONzYE"};
+    EXPECT_THROW(decode_stream(overflow).begin(), std::out_of_range);
+}
+
+TEST(CoroutineTest, AsyncRoundTripInterleavesWithIo) {
+    manual_loop loop;
+    const vector<uint64_t> ids = make_ids(64);
+    vector<vector<uint64_t>> chunks;
+    for (std::size_t pos = 0; pos < ids.size(); pos += 16) {
+        chunks.emplace_back(ids.begin() + static_cast<std::ptrdiff_t>(pos),
+                            ids.begin() + static_cast<std::ptrdiff_t>(pos + 16));
+    }
+
+    vector<string> encoded_chunks;
+    vector<uint64_t> decoded;
+    bool finished = false;
+
+    auto consumer = [&]() -> detached {
+        auto encoder = encode_stream(read_chunks(loop, chunks));
+        while (const std::string_view* encoded = co_await encoder.next()) {
+            encoded_chunks.emplace_back(*encoded);
+        }
+
+        auto decoder = decode_stream(read_chunks(loop, encoded_chunks));
+        while (const auto* values = co_await decoder.next()) {
+            decoded.insert(decoded.end(), values->begin(), values->end());
+        }
+        finished = true;
+    };
+    consumer();
+
+    // Nothing completes until the loop delivers the "I/O"; one resumption per chunk read
+    EXPECT_FALSE(finished);
+    EXPECT_EQ(loop.run(), 8U);
+    EXPECT_TRUE(finished);
+    EXPECT_EQ(encoded_chunks.size(), 4U);
+    EXPECT_EQ(decoded, ids);
+}
+
+TEST(CoroutineTest, AsyncErrorsReachTheConsumer) {
+    manual_loop loop;
+    const vector<string> chunks = {"-----5tVfK4", "9lH9ebONzYE"};
+    vector<uint64_t> decoded;
+    bool caught = false;
+
+    auto consumer = [&]() -> detached {
+        auto decoder = decode_stream(read_chunks(loop, chunks));
+        try {
+            while (const auto* values = co_await decoder.next()) {
+                decoded.insert(decoded.end(), values->begin(), values->end());
+            }
+        } catch (const std::out_of_range&) {
+            caught = true;
+        }
+    };
+    consumer();
+    loop.run();
+
+    EXPECT_TRUE(caught);
+    EXPECT_EQ(decoded, (vector<uint64_t>{9876543210ULL}));
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_fixed_width.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @file fixed_width_tests.cpp
+ * @brief Unit tests covering the generic integer-width and output-width templates.
+ */
+
+
+using hhc::fixed_width;
+using hhc::hhc_32bit_encode_padded;
+using hhc::hhc_64bit_encode_padded;
+using hhc::HHC_32BIT_ENCODED_MAX_STRING;
+using hhc::HHC_64BIT_ENCODED_MAX_STRING;
+
+using std::string;
+using std::string_view;
+
+static_assert(fixed_width<8>::ENCODED_LENGTH == 2);
+static_assert(fixed_width<16>::ENCODED_LENGTH == 3);
+static_assert(fixed_width<24>::ENCODED_LENGTH == 4);
+static_assert(fixed_width<32>::ENCODED_LENGTH == 6);
+static_assert(fixed_width<40>::ENCODED_LENGTH == 7);
+static_assert(fixed_width<48>::ENCODED_LENGTH == 8);
+static_assert(fixed_width<64>::ENCODED_LENGTH == 11);
+static_assert(fixed_width<48>::STRING_LENGTH == 16);
+static_assert(std::is_same_v<fixed_width<24>::value_type, uint32_t>);
+static_assert(std::is_same_v<fixed_width<48>::value_type, uint64_t>);
+static_assert(fixed_width<24>::MAX_VALUE == 0xFFFFFFU);
+static_assert(fixed_width<64, 9>::MAX_VALUE == 66ULL * 66 * 66 * 66 * 66 * 66 * 66 * 66 * 66 - 1);
+static_assert(hhc::decode<16>("~~") == 66U * 66U - 1U);
+
+namespace {
+
+template <unsigned Bits, std::size_t Width = fixed_width<Bits>::ENCODED_LENGTH>
+string encode_to_string(typename fixed_width<Bits, Width>::value_type value) {
+    string encoded(Width, '\0');
+    hhc::encode<Bits, Width>(value, encoded.data());
+    return encoded;
+}
+
+} // namespace
+
+TEST(HhcFixedWidthTest, MaxStringsMatchBuiltInConstants) {
+    EXPECT_EQ(string_view(fixed_width<32>::MAX_STRING.data()), HHC_32BIT_ENCODED_MAX_STRING);
+    EXPECT_EQ(string_view(fixed_width<64>::MAX_STRING.data()), HHC_64BIT_ENCODED_MAX_STRING);
+}
+
+TEST(HhcFixedWidthTest, NaturalWidthsMatchBuiltInEncoders) {
+    for (uint64_t i = 0; i < 5000; ++i) {
+        const uint64_t value = i * 0x9E3779B97F4A7C15ULL;
+        char expected64[hhc::HHC_64BIT_STRING_LENGTH] = {};
+        hhc_64bit_encode_padded(value, expected64);
+        ASSERT_EQ(encode_to_string<64>(value), string(expected64));
+
+        char expected32[hhc::HHC_32BIT_STRING_LENGTH] = {};
+        hhc_32bit_encode_padded(static_cast<uint32_t>(value), expected32);
+        ASSERT_EQ(encode_to_string<32>(static_cast<uint32_t>(value)), string(expected32));
+    }
+}
+
+TEST(HhcFixedWidthTest, SmallWidthsRoundTrip) {
+    for (uint32_t value = 0; value <= 0xFFFFU; ++value) {
+        const auto encoded16 = encode_to_string<16>(static_cast<uint16_t>(value));
+        ASSERT_EQ(hhc::decode<16>(encoded16.c_str()), value);
+        ASSERT_EQ(hhc::decode_unsafe<16>(encoded16.c_str()), value);
+    }
+    for (uint32_t value = 0; value <= 0xFFU; ++value) {
+        const auto encoded8 = encode_to_string<8>(static_cast<uint8_t>(value));
+        ASSERT_EQ(hhc::decode<8>(encoded8.c_str()), value);
+    }
+}
+
+TEST(HhcFixedWidthTest, FortyEightBitRoundTrip) {
+    constexpr uint64_t max48 = (uint64_t{1} << 48) - 1;
+    for (uint64_t value = 0; value < max48; value += 0x0000123456789ULL) {
+        const auto encoded = encode_to_string<48>(value);
+        ASSERT_EQ(encoded.size(), 8U);
+        ASSERT_EQ(hhc::decode<48>(encoded.c_str()), value);
+    }
+    EXPECT_EQ(hhc::decode<48>(fixed_width<48>::MAX_STRING.data()), max48);
+    EXPECT_EQ(encode_to_string<48>(max48), string(fixed_width<48>::MAX_STRING.data()));
+}
+
+TEST(HhcFixedWidthTest, DecodeRejectsValuesAboveBitWidth) {
+    string above = fixed_width<24>::MAX_STRING.data();
+    above.back() = static_cast<char>(above.back() + 1);
+    EXPECT_THROW(hhc::decode<24>(above.c_str()), std::out_of_range);
+    EXPECT_THROW(hhc::decode<8>("~~"), std::out_of_range);
+}
+
+TEST(HhcFixedWidthTest, CustomWidthBoundsIds) {
+    constexpr uint64_t max9 = fixed_width<64, 9>::MAX_VALUE;
+    EXPECT_EQ((encode_to_string<64, 9>(max9)), "~~~~~~~~~");
+    EXPECT_EQ((hhc::decode<64, 9>("~~~~~~~~~")), max9);
+    EXPECT_EQ((hhc::decode<64, 9>("5tVfK4")), 9876543210ULL);
+    EXPECT_THROW((hhc::decode<64, 9>("-----5tVfK4")), std::invalid_argument);
+}
+
+TEST(HhcFixedWidthTest, WiderThanNaturalChecksShortStrings) {
+    // 8-bit values in four characters: two- and three-character strings can already overflow
+    EXPECT_EQ((encode_to_string<8, 4>(255)), "--" + encode_to_string<8>(255));
+    EXPECT_EQ((hhc::decode<8, 4>("1s")), 255U);
+    EXPECT_EQ((hhc::decode<8, 4>("--1s")), 255U);
+    EXPECT_THROW((hhc::decode<8, 4>("1t")), std::out_of_range);
+    EXPECT_THROW((hhc::decode<8, 4>("-~~")), std::out_of_range);
+    EXPECT_THROW((hhc::decode<8, 4>("-.--")), std::out_of_range);
+}
+
+TEST(HhcFixedWidthTest, DecodeRejectsInvalidInput) {
+    EXPECT_THROW(hhc::decode<40>(nullptr), std::invalid_argument);
+    EXPECT_THROW(hhc::decode<40>(""), std::invalid_argument);
+    EXPECT_THROW(hhc::decode<40>("--------"), std::invalid_argument);
+    EXPECT_THROW(hhc::decode<40>("--!"), std::invalid_argument);
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_format.hpp"
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <string>
+
+/**
+ * @file format_tests.cpp
+ * @brief Unit tests covering the as_hhc wrapper and the fmt formatters (std::format is covered by std_format_tests.cpp).
+ */
+
+
+using hhc::as_hhc;
+using hhc::encoded32;
+using hhc::encoded64;
+
+using std::string;
+
+static_assert(std::is_same_v<decltype(as_hhc(uint8_t{1})), encoded32>);
+static_assert(std::is_same_v<decltype(as_hhc(uint32_t{1})), encoded32>);
+static_assert(std::is_same_v<decltype(as_hhc(uint64_t{1})), encoded64>);
+
+namespace {
+
+template <typename Encoded>
+string format_string(Encoded encoded, bool padded = true, std::size_t width = 0) {
+    string result;
+    hhc::format_to(std::back_inserter(result), encoded, padded, width);
+    return result;
+}
+
+} // namespace
+
+TEST(FormatTest, PaddedMatchesEncoder) {
+    for (uint32_t value : {0U, 1U, 66U, 424242U, UINT32_MAX}) {
+        char expected[hhc::HHC_32BIT_STRING_LENGTH] = {};
+        hhc::hhc_32bit_encode_padded(value, expected);
+        EXPECT_EQ(format_string(as_hhc(value)), expected);
+    }
+    for (uint64_t value : {uint64_t{0}, uint64_t{9876543210ULL}, UINT64_MAX}) {
+        char expected[hhc::HHC_64BIT_STRING_LENGTH] = {};
+        hhc::hhc_64bit_encode_padded(value, expected);
+        EXPECT_EQ(format_string(as_hhc(value)), expected);
+    }
+}
+
+TEST(FormatTest, UnpaddedMatchesEncoder) {
+    for (uint64_t value : {uint64_t{0}, uint64_t{1}, uint64_t{9876543210ULL}, UINT64_MAX}) {
+        char expected[hhc::HHC_64BIT_STRING_LENGTH] = {};
+        hhc::hhc_64bit_encode_unpadded(value, expected);
+        EXPECT_EQ(format_string(as_hhc(value), false), expected);
+    }
+    EXPECT_EQ(format_string(as_hhc(424242U), false), ".TNv");
+    EXPECT_EQ(format_string(as_hhc(0U), false), "");
+}
+
+TEST(FormatTest, WidthFillsWithZeroSymbol) {
+    EXPECT_EQ(format_string(as_hhc(424242U), false, 8), "----.TNv");
+    EXPECT_EQ(format_string(as_hhc(424242U), false, 2), ".TNv");
+    EXPECT_EQ(format_string(as_hhc(424242U), true, 8), "----.TNv");
+    EXPECT_EQ(format_string(as_hhc(424242U), true, 3), "--.TNv");
+    EXPECT_EQ(format_string(as_hhc(0U), false, 1), "-");
+}
+
+TEST(FormatTest, WritesToRawBuffer) {
+    std::array<char, 16> buffer{};
+    char* end = hhc::format_to(buffer.data(), as_hhc(uint64_t{9876543210ULL}), false);
+    EXPECT_EQ(string(buffer.data(), end), "5tVfK4");
+}
+
+TEST(FormatTest, ParseSpec) {
+    auto parse = [](const string& text, hhc::detail::format_spec& spec) {
+        auto it = text.begin();
+        const char* error = hhc::detail::parse_format_spec(it, text.end(), spec);
+        return std::make_pair(error, static_cast<std::size_t>(it - text.begin()));
+    };
+
+    hhc::detail::format_spec spec;
+    EXPECT_EQ(parse("}", spec).first, nullptr);
+    EXPECT_TRUE(spec.padded);
+
+    spec = {};
+    EXPECT_EQ(parse("u}", spec), std::make_pair(static_cast<const char*>(nullptr), std::size_t{1}));
+    EXPECT_FALSE(spec.padded);
+
+    spec = {};
+    EXPECT_EQ(parse("12}", spec).first, nullptr);
+    EXPECT_FALSE(spec.padded);
+    EXPECT_EQ(spec.width, 12U);
+
+    spec = {};
+    EXPECT_EQ(parse("p14", spec).first, nullptr);
+    EXPECT_TRUE(spec.padded);
+    EXPECT_EQ(spec.width, 14U);
+
+    spec = {};
+    EXPECT_NE(parse("x}", spec).first, nullptr);
+    spec = {};
+    EXPECT_NE(parse("u8x}", spec).first, nullptr);
+    spec = {};
+    EXPECT_NE(parse("100}", spec).first, nullptr);
+}
+
+#if defined(HHC_ENABLE_FMT)
+
+TEST(FormatTest, FmtFormat) {
+    EXPECT_EQ(fmt::format("{}", as_hhc(424242U)), "--.TNv");
+    EXPECT_EQ(fmt::format("{:p}", as_hhc(uint64_t{9876543210ULL})), "-----5tVfK4");
+    EXPECT_EQ(fmt::format("id={:u}", as_hhc(uint64_t{9876543210ULL})), "id=5tVfK4");
+    EXPECT_EQ(fmt::format("{:u8}", as_hhc(424242U)), "----.TNv");
+
+    fmt::memory_buffer buffer;
+    fmt::format_to(std::back_inserter(buffer), "{:u}/{:u}", as_hhc(1U), as_hhc(uint64_t{66}));
+    EXPECT_EQ(fmt::to_string(buffer), "./.-");
+
+    EXPECT_THROW((void)fmt::format(fmt::runtime("{:x}"), as_hhc(1U)), fmt::format_error);
+}
+
+#endif
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_front_coded.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @file front_coded_tests.cpp
+ * @brief Unit tests covering the front-coded list of sorted encoded records.
+ */
+
+
+using hhc::hhc32_codec;
+using hhc::hhc64_codec;
+
+using std::string;
+using std::vector;
+
+namespace {
+
+vector<uint64_t> sorted_ids(std::size_t count, uint64_t mask) {
+    vector<uint64_t> ids(count);
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    for (auto& id : ids) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        id = (seed ^ (seed >> 29)) & mask;
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+string padded(uint64_t value) {
+    string text(hhc64_codec::ENCODED_LENGTH, '\0');
+    hhc64_codec::encode_padded(value, text.data());
+    return text;
+}
+
+hhc::front_coded_list build(const vector<uint64_t>& ids) {
+    hhc::front_coded_list list;
+    for (uint64_t id : ids) {
+        list.push_back_value(id);
+    }
+    return list;
+}
+
+} // namespace
+
+TEST(HhcFrontCodedTest, EmptyList) {
+    const hhc::front_coded_list list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.begin(), list.end());
+    EXPECT_EQ(list.lower_bound(uint64_t{42}), 0U);
+    EXPECT_FALSE(list.contains(uint64_t{0}));
+}
+
+TEST(HhcFrontCodedTest, RandomAccessMatchesInput) {
+    const vector<uint64_t> ids = sorted_ids(1000, UINT64_MAX);
+    const hhc::front_coded_list list = build(ids);
+    ASSERT_EQ(list.size(), ids.size());
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        ASSERT_EQ(string(list[i].data(), hhc64_codec::ENCODED_LENGTH), padded(ids[i])) << i;
+        ASSERT_EQ(list.value(i), ids[i]);
+    }
+}
+
+TEST(HhcFrontCodedTest, IterationStreamsRecordsInOrder) {
+    const vector<uint64_t> ids = sorted_ids(777, 0xFFFFFFFFFFULL);
+    const hhc::front_coded_list list = build(ids);
+    std::size_t i = 0;
+    for (const auto& record : list) {
+        ASSERT_EQ(string(record.data(), record.size()), padded(ids[i])) << i;
+        ++i;
+    }
+    EXPECT_EQ(i, ids.size());
+
+    string flat(ids.size() * hhc64_codec::ENCODED_LENGTH, '\0');
+    list.copy_to(flat.data());
+    string expected;
+    for (uint64_t id : ids) {
+        expected += padded(id);
+    }
+    EXPECT_EQ(flat, expected);
+}
+
+TEST(HhcFrontCodedTest, BuildFromRecords) {
+    const vector<uint64_t> ids = sorted_ids(100, UINT64_MAX);
+    string records(ids.size() * hhc64_codec::ENCODED_LENGTH, '\0');
+    hhc64_codec::encode_padded_batch(ids.data(), ids.size(), records.data());
+    const hhc::front_coded_list list(records.data(), ids.size());
+    EXPECT_EQ(list.size(), ids.size());
+    EXPECT_EQ(list.value(57), ids[57]);
+}
+
+TEST(HhcFrontCodedTest, LowerBoundAndContains) {
+    const vector<uint64_t> ids = sorted_ids(5000, 0xFFFFFFFFFFFULL);
+    const hhc::front_coded_list list = build(ids);
+    for (std::size_t i = 0; i < ids.size(); i += 7) {
+        ASSERT_EQ(list.lower_bound(ids[i]), static_cast<std::size_t>(std::lower_bound(ids.begin(), ids.end(), ids[i]) - ids.begin()));
+        ASSERT_TRUE(list.contains(ids[i]));
+        ASSERT_TRUE(list.contains(padded(ids[i])));
+        const uint64_t between = ids[i] + 1;
+        ASSERT_EQ(list.lower_bound(between),
+                  static_cast<std::size_t>(std::lower_bound(ids.begin(), ids.end(), between) - ids.begin()));
+    }
+    EXPECT_EQ(list.lower_bound(uint64_t{0}), 0U);
+    EXPECT_EQ(list.lower_bound(UINT64_MAX), ids.size());
+    EXPECT_FALSE(list.contains(UINT64_MAX));
+}
+
+TEST(HhcFrontCodedTest, DuplicatesAcrossBlocks) {
+    vector<uint64_t> ids(40, 500);
+    ids.insert(ids.begin(), {1, 2, 3});
+    ids.push_back(900);
+    const hhc::front_coded_list list = build(ids);
+    EXPECT_EQ(list.lower_bound(uint64_t{500}), 3U);
+    EXPECT_EQ(list.lower_bound(uint64_t{501}), 43U);
+    EXPECT_TRUE(list.contains(uint64_t{900}));
+}
+
+TEST(HhcFrontCodedTest, LookupByUnpaddedString) {
+    const hhc::front_coded_list list = build({1, 66, 629717763});
+    char unpadded[hhc64_codec::STRING_LENGTH] = {};
+    hhc64_codec::encode_unpadded(629717763, unpadded);
+    EXPECT_TRUE(list.contains(std::string_view(unpadded)));
+    EXPECT_THROW(list.contains(std::string_view("-!")), std::invalid_argument);
+}
+
+TEST(HhcFrontCodedTest, RejectsOutOfOrderAndInvalidRecords) {
+    hhc::front_coded_list list;
+    list.push_back_value(10);
+    EXPECT_THROW(list.push_back_value(9), std::invalid_argument);
+    string bad = padded(11);
+    bad[5] = ' ';
+    EXPECT_THROW(list.push_back(bad.data()), std::invalid_argument);
+    EXPECT_EQ(list.size(), 1U);
+
+    // A block head must follow the last record, not just the previous head
+    hhc::basic_front_coded_list<hhc64_codec, 4> small;
+    for (const uint64_t id : {10, 20, 30, 40}) {
+        small.push_back_value(id);
+    }
+    EXPECT_THROW(small.push_back_value(15), std::invalid_argument);
+    EXPECT_EQ(small.size(), 4U);
+    small.push_back_value(40);
+    EXPECT_TRUE(small.contains(uint64_t{20}));
+    EXPECT_EQ(small.lower_bound(uint64_t{25}), 2U);
+}
+
+TEST(HhcFrontCodedTest, CompressesSortedIds) {
+    // 100k IDs below 2^40: neighbours share the padding and about three high digits
+    const vector<uint64_t> ids = sorted_ids(100000, 0xFFFFFFFFFFULL);
+    hhc::front_coded_list list = build(ids);
+    list.shrink_to_fit();
+    EXPECT_LT(list.memory_usage(), ids.size() * hhc64_codec::ENCODED_LENGTH * 2 / 3);
+}
+
+TEST(HhcFrontCodedTest, Works32BitWithSmallBlocks) {
+    hhc::basic_front_coded_list<hhc32_codec, 4> list;
+    for (uint32_t id = 1000; id < 1100; ++id) {
+        list.push_back_value(id);
+    }
+    EXPECT_EQ(list.value(37), 1037U);
+    EXPECT_EQ(list.lower_bound(uint32_t{1050}), 50U);
+    EXPECT_FALSE(list.contains(uint32_t{999}));
+}
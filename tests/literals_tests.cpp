@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+
+/**
+ * @file literals_tests.cpp
+ * @brief Unit tests covering the compile-time literals and encode_ct helper.
+ */
+
+
+constexpr auto U32_MAX_VALUE = std::numeric_limits<uint32_t>::max();
+constexpr auto U64_MAX_VALUE = std::numeric_limits<uint64_t>::max();
+
+using hhc::encode_ct;
+using hhc::hhc_32bit_decode;
+using hhc::hhc_64bit_decode;
+using hhc::HHC_32BIT_ENCODED_LENGTH;
+using hhc::HHC_64BIT_ENCODED_LENGTH;
+using hhc::HHC_32BIT_ENCODED_MAX_STRING;
+using hhc::HHC_64BIT_ENCODED_MAX_STRING;
+
+using namespace hhc::literals;
+
+using std::string_view;
+
+// Literals are decoded during compilation
+static_assert("1QLCp1"_hhc32 == U32_MAX_VALUE);
+static_assert("9lH9ebONzYD"_hhc64 == U64_MAX_VALUE);
+static_assert("-"_hhc32 == 0);
+static_assert("."_hhc64 == 1);
+static_assert(".TNv"_hhc32 == 424242);
+static_assert("5tVfK4"_hhc64 == 9876543210ULL);
+
+// The safe decoders are usable in constant expressions for padded and unpadded input
+static_assert(hhc_32bit_decode("--.TNv") == 424242);
+static_assert(hhc_64bit_decode("5tVfK4") == 9876543210ULL);
+
+// encode_ct picks the encoded width from the value type
+static_assert(encode_ct<U32_MAX_VALUE>().size() == HHC_32BIT_ENCODED_LENGTH + 1);
+static_assert(encode_ct<U64_MAX_VALUE>().size() == HHC_64BIT_ENCODED_LENGTH + 1);
+static_assert(encode_ct<uint16_t{1}>().size() == HHC_32BIT_ENCODED_LENGTH + 1);
+static_assert(encode_ct<U64_MAX_VALUE>()[0] == '9');
+static_assert(encode_ct<U64_MAX_VALUE>().back() == '\0');
+
+TEST(HhcLiteralsTest, Literal32MatchesRuntimeDecode) {
+    EXPECT_EQ("1QLCp1"_hhc32, hhc_32bit_decode(HHC_32BIT_ENCODED_MAX_STRING));
+    EXPECT_EQ("--.TNv"_hhc32, 424242U);
+}
+
+TEST(HhcLiteralsTest, Literal64MatchesRuntimeDecode) {
+    EXPECT_EQ("9lH9ebONzYD"_hhc64, hhc_64bit_decode(HHC_64BIT_ENCODED_MAX_STRING));
+    EXPECT_EQ("-----5tVfK4"_hhc64, 9876543210ULL);
+}
+
+TEST(HhcLiteralsTest, EncodeCt32ProducesPaddedString) {
+    constexpr auto encoded = encode_ct<424242U>();
+    EXPECT_EQ(string_view(encoded.data()), "--.TNv");
+}
+
+TEST(HhcLiteralsTest, EncodeCt64ProducesPaddedString) {
+    constexpr auto encoded = encode_ct<uint64_t{9876543210ULL}>();
+    EXPECT_EQ(string_view(encoded.data()), "-----5tVfK4");
+}
+
+TEST(HhcLiteralsTest, EncodeCtMaxValuesMatchMaxStrings) {
+    EXPECT_EQ(string_view(encode_ct<U32_MAX_VALUE>().data()), HHC_32BIT_ENCODED_MAX_STRING);
+    EXPECT_EQ(string_view(encode_ct<U64_MAX_VALUE>().data()), HHC_64BIT_ENCODED_MAX_STRING);
+}
+
+TEST(HhcLiteralsTest, EncodeCtRoundTripsThroughLiteralDecode) {
+    constexpr auto encoded = encode_ct<uint64_t{123456789012345ULL}>();
+    EXPECT_EQ(hhc_64bit_decode(encoded.data()), 123456789012345ULL);
+}
+
+TEST(HhcLiteralsTest, RuntimeErrorsStillThrow) {
+    EXPECT_THROW(hhc_32bit_decode("1QLCp2"), std::out_of_range);
+    EXPECT_THROW(hhc_64bit_decode("9lH9ebONz!D"), std::invalid_argument);
+}
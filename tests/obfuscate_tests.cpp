@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_obfuscate.hpp"
+
+#include <bitset>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @file obfuscate_tests.cpp
+ * @brief Unit tests covering keyed ID obfuscation and the obfuscated codecs.
+ */
+
+
+using hhc::hhc32_codec;
+using hhc::hhc64_codec;
+using hhc::obfuscated_codec32;
+using hhc::obfuscated_codec64;
+using hhc::obfuscator32;
+using hhc::obfuscator64;
+
+using std::string;
+using std::vector;
+
+namespace {
+
+constexpr uint64_t KEY = 0x5eed5eed12345678ULL;
+
+} // namespace
+
+TEST(ObfuscateTest, OddInverse) {
+    std::mt19937_64 rng(1);
+    for (int i = 0; i < 1000; ++i) {
+        const uint64_t odd64 = rng() | 1U;
+        EXPECT_EQ(odd64 * hhc::detail::odd_inverse(odd64), 1U);
+        const auto odd32 = static_cast<uint32_t>(odd64);
+        EXPECT_EQ(static_cast<uint32_t>(odd32 * hhc::detail::odd_inverse(odd32)), 1U);
+    }
+}
+
+TEST(ObfuscateTest, PermutationRoundTrips) {
+    const obfuscator64 wide(KEY);
+    const obfuscator32 narrow(KEY);
+    std::mt19937_64 rng(2);
+    vector<uint64_t> values = {0, 1, 2, std::numeric_limits<uint32_t>::max(), std::numeric_limits<uint64_t>::max()};
+    for (int i = 0; i < 10000; ++i) {
+        values.push_back(rng());
+    }
+    for (const uint64_t value : values) {
+        EXPECT_EQ(wide.unpermute(wide.permute(value)), value);
+        EXPECT_EQ(wide.permute(wide.unpermute(value)), value);
+        const auto value32 = static_cast<uint32_t>(value);
+        EXPECT_EQ(narrow.unpermute(narrow.permute(value32)), value32);
+    }
+}
+
+TEST(ObfuscateTest, Is32BitBijectiveOnABlock) {
+    // A permutation maps distinct inputs to distinct outputs; check a full 2^20 block of sequential IDs
+    const obfuscator32 narrow(KEY);
+    std::set<uint32_t> outputs;
+    for (uint32_t id = 0; id < (1U << 20); ++id) {
+        EXPECT_TRUE(outputs.insert(narrow.permute(id)).second);
+    }
+}
+
+TEST(ObfuscateTest, SequentialIdsLookUnrelated) {
+    const obfuscator64 wide(KEY);
+    // Flipping the lowest input bit flips about half of the output bits
+    double flipped = 0;
+    constexpr int SAMPLES = 10000;
+    for (uint64_t id = 0; id < SAMPLES; ++id) {
+        flipped += static_cast<double>(std::bitset<64>(wide.permute(2 * id) ^ wide.permute(2 * id + 1)).count());
+    }
+    EXPECT_NEAR(flipped / SAMPLES, 32.0, 1.0);
+
+    // Neighbouring IDs do not share a leading encoded symbol more often than chance
+    int same_first_symbol = 0;
+    for (uint64_t id = 1000; id < 1000 + SAMPLES; ++id) {
+        char a[hhc64_codec::ENCODED_LENGTH];
+        char b[hhc64_codec::ENCODED_LENGTH];
+        hhc64_codec::encode_padded(wide.permute(id), a);
+        hhc64_codec::encode_padded(wide.permute(id + 1), b);
+        same_first_symbol += a[0] == b[0];
+    }
+    EXPECT_LT(same_first_symbol, SAMPLES / 10);
+}
+
+TEST(ObfuscateTest, KeysGiveDifferentPermutations) {
+    const obfuscator64 a(1);
+    const obfuscator64 b(2);
+    int equal = 0;
+    for (uint64_t id = 0; id < 1000; ++id) {
+        equal += a.permute(id) == b.permute(id);
+    }
+    EXPECT_EQ(equal, 0);
+    EXPECT_EQ(obfuscator64(7).permute(12345), obfuscator64(7).permute(12345));
+}
+
+TEST(ObfuscateTest, UsableAtCompileTime) {
+    constexpr obfuscator64 wide(KEY);
+    static_assert(wide.unpermute(wide.permute(42)) == 42);
+    constexpr obfuscator32 narrow(KEY);
+    static_assert(narrow.unpermute(narrow.permute(42)) == 42);
+}
+
+TEST(ObfuscateTest, BatchMatchesSingle) {
+    const obfuscator64 wide(KEY);
+    vector<uint64_t> ids(100);
+    for (uint64_t i = 0; i < ids.size(); ++i) {
+        ids[i] = i * 7919;
+    }
+    vector<uint64_t> permuted(ids.size());
+    wide.permute_batch(ids.data(), ids.size(), permuted.data());
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        EXPECT_EQ(permuted[i], wide.permute(ids[i]));
+    }
+    wide.unpermute_batch(permuted.data(), permuted.size(), permuted.data());
+    EXPECT_EQ(permuted, ids);
+}
+
+TEST(ObfuscatedCodecTest, RoundTripsThroughStrings) {
+    const obfuscated_codec64 codec(KEY);
+    for (uint64_t id = 0; id < 2000; ++id) {
+        char padded[hhc64_codec::ENCODED_LENGTH];
+        codec.encode_padded(id, padded);
+        EXPECT_EQ(hhc64_codec::decode_unsafe(padded), codec.obfuscator().permute(id));
+        EXPECT_EQ(codec.decode_unsafe(padded), id);
+        EXPECT_EQ(codec.decode(padded, sizeof(padded)), id);
+
+        char unpadded[hhc64_codec::STRING_LENGTH];
+        codec.encode_unpadded(id, unpadded);
+        EXPECT_EQ(codec.decode(unpadded), id);
+    }
+
+    const obfuscated_codec32 narrow(KEY);
+    char padded32[hhc32_codec::ENCODED_LENGTH];
+    narrow.encode_padded(77, padded32);
+    EXPECT_EQ(narrow.decode(padded32, sizeof(padded32)), 77U);
+}
+
+TEST(ObfuscatedCodecTest, BatchRoundTrips) {
+    const obfuscated_codec64 codec(KEY);
+    vector<uint64_t> ids(257);
+    for (uint64_t i = 0; i < ids.size(); ++i) {
+        ids[i] = 1000000 + i;
+    }
+    string records(ids.size() * hhc64_codec::ENCODED_LENGTH, '\0');
+    codec.encode_padded_batch(ids.data(), ids.size(), records.data());
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        char single[hhc64_codec::ENCODED_LENGTH];
+        codec.encode_padded(ids[i], single);
+        EXPECT_EQ(records.compare(i * sizeof(single), sizeof(single), single, sizeof(single)), 0);
+    }
+
+    vector<uint64_t> decoded(ids.size());
+    codec.decode_batch(records.data(), ids.size(), decoded.data());
+    EXPECT_EQ(decoded, ids);
+    std::fill(decoded.begin(), decoded.end(), 0);
+    codec.decode_unsafe_batch(records.data(), ids.size(), decoded.data());
+    EXPECT_EQ(decoded, ids);
+}
+
+TEST(ObfuscatedCodecTest, ValidatesLikeThePlainCodec) {
+    const obfuscated_codec64 codec(KEY);
+    EXPECT_THROW(codec.decode("ab!de"), std::invalid_argument);
+    EXPECT_THROW(codec.decode("~~~~~~~~~~~"), std::out_of_range);
+    const string records = "-----------~~~~~~~~~~~";
+    vector<uint64_t> decoded(2);
+    EXPECT_THROW(codec.decode_batch(records.data(), 2, decoded.data()), std::out_of_range);
+}
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include "hhc_ordered.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @file ordered_tests.cpp
+ * @brief Unit tests covering order-preserving encodings of signed integers and floating point values.
+ */
+
+
+using hhc::ordered_double_codec;
+using hhc::ordered_float_codec;
+using hhc::ordered_int32_codec;
+using hhc::ordered_int64_codec;
+
+using std::string;
+using std::vector;
+
+namespace {
+
+template <typename Codec>
+string padded(typename Codec::value_type value) {
+    string text(Codec::ENCODED_LENGTH, '\0');
+    Codec::encode_padded(value, text.data());
+    return text;
+}
+
+/// Encodings of sorted values must be strictly increasing and decode back exactly
+template <typename Codec>
+void expect_sorted_round_trip(vector<typename Codec::value_type> values) {
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    string previous;
+    for (const auto value : values) {
+        const string text = padded<Codec>(value);
+        if (!previous.empty()) {
+            EXPECT_LT(previous, text) << value;
+        }
+        previous = text;
+        const auto decoded = Codec::decode(text.data(), text.size());
+        EXPECT_EQ(std::memcmp(&decoded, &value, sizeof(value)), 0) << value;
+    }
+}
+
+template <typename T>
+vector<T> random_integers(std::size_t count) {
+    std::mt19937_64 rng(7);
+    vector<T> values = {std::numeric_limits<T>::min(), std::numeric_limits<T>::min() + 1, -1, 0, 1,
+                        std::numeric_limits<T>::max() - 1, std::numeric_limits<T>::max()};
+    for (std::size_t i = 0; i < count; ++i) {
+        values.push_back(static_cast<T>(rng() >> (rng() % 64)) * (i % 2 == 0 ? 1 : -1));
+    }
+    return values;
+}
+
+template <typename T>
+vector<T> random_floats(std::size_t count) {
+    using limits = std::numeric_limits<T>;
+    std::mt19937_64 rng(8);
+    vector<T> values = {-limits::infinity(), limits::lowest(), T(-1), -limits::min(), -limits::denorm_min(),
+                        T(0), limits::denorm_min(), limits::min(), T(1), limits::max(), limits::infinity()};
+    std::uniform_real_distribution<T> unit(T(-1), T(1));
+    for (std::size_t i = 0; i < count; ++i) {
+        values.push_back(std::ldexp(unit(rng), static_cast<int>(rng() % 200) - 100));
+    }
+    return values;
+}
+
+} // namespace
+
+TEST(OrderedTest, SignedIntegersSortLikeTheirEncodings) {
+    expect_sorted_round_trip<ordered_int32_codec>(random_integers<int32_t>(5000));
+    expect_sorted_round_trip<ordered_int64_codec>(random_integers<int64_t>(5000));
+}
+
+TEST(OrderedTest, FloatingPointSortsLikeItsEncodings) {
+    expect_sorted_round_trip<ordered_float_codec>(random_floats<float>(5000));
+    expect_sorted_round_trip<ordered_double_codec>(random_floats<double>(5000));
+}
+
+TEST(OrderedTest, MappingMatchesSignBitFlipAndFloatTransform) {
+    EXPECT_EQ(hhc::ordered_traits<int32_t>::to_unsigned(0), 0x80000000U);
+    EXPECT_EQ(hhc::ordered_traits<int32_t>::to_unsigned(std::numeric_limits<int32_t>::min()), 0U);
+    EXPECT_EQ(hhc::ordered_traits<int64_t>::to_unsigned(-1), 0x7FFFFFFFFFFFFFFFULL);
+    EXPECT_EQ(hhc::ordered_traits<double>::to_unsigned(0.0), 0x8000000000000000ULL);
+    EXPECT_EQ(hhc::ordered_traits<double>::to_unsigned(-0.0), 0x7FFFFFFFFFFFFFFFULL);
+    EXPECT_EQ(hhc::ordered_traits<float>::to_unsigned(1.0F), 0xBF800000U);
+    EXPECT_EQ(hhc::ordered_traits<float>::to_unsigned(-1.0F), 0x407FFFFFU);
+
+    // The smallest key is the all-zero padded string
+    EXPECT_EQ(padded<ordered_int64_codec>(std::numeric_limits<int64_t>::min()), string(11, '-'));
+}
+
+TEST(OrderedTest, SignedZerosAndNansRoundTrip) {
+    EXPECT_LT(padded<ordered_double_codec>(-0.0), padded<ordered_double_codec>(0.0));
+    EXPECT_TRUE(std::signbit(ordered_double_codec::decode(padded<ordered_double_codec>(-0.0).c_str())));
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const string positive_nan = padded<ordered_double_codec>(nan);
+    const string negative_nan = padded<ordered_double_codec>(-nan);
+    EXPECT_GT(positive_nan, padded<ordered_double_codec>(std::numeric_limits<double>::infinity()));
+    EXPECT_LT(negative_nan, padded<ordered_double_codec>(-std::numeric_limits<double>::infinity()));
+    EXPECT_TRUE(std::isnan(ordered_double_codec::decode(positive_nan.data(), positive_nan.size())));
+    EXPECT_TRUE(std::signbit(ordered_double_codec::decode(negative_nan.data(), negative_nan.size())));
+}
+
+TEST(OrderedTest, UnpaddedRoundTrip) {
+    for (const int64_t value : {std::numeric_limits<int64_t>::min() + 1, int64_t{-5}, int64_t{0}, int64_t{12345}}) {
+        char text[ordered_int64_codec::STRING_LENGTH];
+        ordered_int64_codec::encode_unpadded(value, text);
+        EXPECT_EQ(ordered_int64_codec::decode(text), value);
+    }
+    char text[ordered_float_codec::STRING_LENGTH];
+    ordered_int32_codec::encode_unpadded(std::numeric_limits<int32_t>::min(), text);
+    EXPECT_STREQ(text, "");
+    ordered_float_codec::encode_unpadded(-2.5F, text);
+    EXPECT_EQ(ordered_float_codec::decode(text), -2.5F);
+}
+
+TEST(OrderedTest, BatchMatchesSingle) {
+    const vector<double> values = random_floats<double>(200);
+    string records(values.size() * ordered_double_codec::ENCODED_LENGTH, '\0');
+    ordered_double_codec::encode_padded_batch(values.data(), values.size(), records.data());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(records.substr(i * 11, 11), padded<ordered_double_codec>(values[i]));
+    }
+
+    vector<double> decoded(values.size());
+    ordered_double_codec::decode_batch(records.data(), values.size(), decoded.data());
+    EXPECT_EQ(decoded, values);
+    std::fill(decoded.begin(), decoded.end(), 0.0);
+    ordered_double_codec::decode_unsafe_batch(records.data(), values.size(), decoded.data());
+    EXPECT_EQ(decoded, values);
+
+    const vector<int32_t> ints = random_integers<int32_t>(100);
+    string int_records(ints.size() * ordered_int32_codec::ENCODED_LENGTH, '\0');
+    ordered_int32_codec::encode_padded_batch(ints.data(), ints.size(), int_records.data());
+    vector<int32_t> decoded_ints(ints.size());
+    ordered_int32_codec::decode_batch(int_records.data(), ints.size(), decoded_ints.data());
+    EXPECT_EQ(decoded_ints, ints);
+}
+
+TEST(OrderedTest, DecodeRejectsBadInput) {
+    EXPECT_THROW(ordered_int64_codec::decode("abc!"), std::invalid_argument);
+    EXPECT_THROW(ordered_int32_codec::decode("~~~~~~"), std::out_of_range);
+    string records(2 * ordered_int32_codec::ENCODED_LENGTH, '-');
+    records[8] = '*';
+    vector<int32_t> decoded(2);
+    EXPECT_THROW(ordered_int32_codec::decode_batch(records.data(), 2, decoded.data()), std::invalid_argument);
+}
+
+TEST(OrderedTest, OtherOrderedAlphabetsSort) {
+    using base62_int64 = hhc::basic_ordered_codec<int64_t, hhc::base62_alphabet>;
+    expect_sorted_round_trip<base62_int64>(random_integers<int64_t>(1000));
+}
+
+TEST(OrderedTest, UsableAtCompileTime) {
+    constexpr auto text = [] {
+        std::array<char, ordered_int64_codec::ENCODED_LENGTH> out{};
+        ordered_int64_codec::encode_padded(-42, out.data());
+        return out;
+    }();
+    static_assert(ordered_int64_codec::decode(text.data(), text.size()) == -42);
+    static_assert(hhc::ordered_traits<double>::from_unsigned(hhc::ordered_traits<double>::to_unsigned(-1.5)) == -1.5);
+}
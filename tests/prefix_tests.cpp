@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_prefix.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @file prefix_tests.cpp
+ * @brief Unit tests covering prefix/range conversion.
+ */
+
+
+using hhc::hhc32_codec;
+using hhc::hhc64_codec;
+
+using std::string;
+using std::vector;
+
+namespace {
+
+struct decimal_alphabet {
+    static constexpr auto symbols = hhc::detail::make_symbols("0123456789");
+};
+
+/// Five decimal digits over 0..65535, small enough to check exhaustively
+using decimal16_codec = hhc::basic_codec<decimal_alphabet, uint16_t>;
+
+template <typename Codec>
+string padded(typename Codec::value_type value) {
+    string text(Codec::ENCODED_LENGTH, '\0');
+    Codec::encode_padded(value, text.data());
+    return text;
+}
+
+/// Check that the prefixes' ranges are ascending, disjoint and tile [first, last] exactly
+template <typename Codec>
+void expect_exact_cover(typename Codec::value_type first, typename Codec::value_type last) {
+    const vector<string> prefixes = hhc::range_to_prefixes<Codec>(first, last);
+    ASSERT_FALSE(prefixes.empty());
+    auto expected = first;
+    for (std::size_t i = 0; i < prefixes.size(); ++i) {
+        const auto range = hhc::prefix_to_range<Codec>(prefixes[i]);
+        ASSERT_EQ(range.first, expected) << "prefix " << prefixes[i] << " in [" << first << ", " << last << "]";
+        ASSERT_LE(range.last, last) << "prefix " << prefixes[i];
+        if (i + 1 == prefixes.size()) {
+            ASSERT_EQ(range.last, last);
+        } else {
+            expected = static_cast<typename Codec::value_type>(range.last + 1);
+        }
+    }
+}
+
+/// Number of sibling runs that could still be merged into their parent prefix (0 for a minimal cover)
+std::size_t mergeable_runs(const vector<string>& prefixes, std::size_t base) {
+    std::size_t runs = 0;
+    for (std::size_t i = 0; i + base <= prefixes.size(); ++i) {
+        const string& head = prefixes[i];
+        if (head.empty() || head.back() != decimal_alphabet::symbols[0]) {
+            continue;
+        }
+        bool siblings = true;
+        for (std::size_t j = 1; j < base && siblings; ++j) {
+            const string& next = prefixes[i + j];
+            siblings = next.size() == head.size() && next.compare(0, head.size() - 1, head, 0, head.size() - 1) == 0;
+        }
+        runs += siblings ? 1 : 0;
+    }
+    return runs;
+}
+
+} // namespace
+
+TEST(HhcPrefixTest, PrefixToRangeMatchesPaddedOrder) {
+    const auto range = hhc::prefix_to_range("---------.");
+    EXPECT_EQ(range.first, 66U);
+    EXPECT_EQ(range.last, 131U);
+    EXPECT_EQ(padded<hhc64_codec>(range.first).substr(0, 10), "---------.");
+    EXPECT_EQ(padded<hhc64_codec>(range.last).substr(0, 10), "---------.");
+    EXPECT_NE(padded<hhc64_codec>(range.last + 1).substr(0, 10), "---------.");
+}
+
+TEST(HhcPrefixTest, FullLengthPrefixIsOneValue) {
+    const string text = padded<hhc64_codec>(629717763);
+    EXPECT_EQ(hhc::prefix_to_range(text), (hhc::value_range<uint64_t>{629717763, 629717763}));
+}
+
+TEST(HhcPrefixTest, EmptyPrefixIsEveryValue) {
+    EXPECT_EQ(hhc::prefix_to_range<hhc32_codec>(""), (hhc::value_range<uint32_t>{0, UINT32_MAX}));
+}
+
+TEST(HhcPrefixTest, PrefixOfMaxIsClamped) {
+    const string max_prefix = string(hhc64_codec::MAX_STRING.data()).substr(0, 4);
+    const auto range = hhc::prefix_to_range(max_prefix);
+    EXPECT_EQ(range.last, UINT64_MAX);
+    EXPECT_TRUE(range.contains(UINT64_MAX));
+}
+
+TEST(HhcPrefixTest, PrefixToRangeErrors) {
+    EXPECT_THROW(hhc::prefix_to_range("-----!"), std::invalid_argument);
+    EXPECT_THROW(hhc::prefix_to_range<hhc32_codec>("-------"), std::invalid_argument);
+    // Every 32-bit value starts with a symbol no larger than the first symbol of the maximum
+    EXPECT_THROW(hhc::prefix_to_range<hhc32_codec>("~"), std::out_of_range);
+}
+
+TEST(HhcPrefixTest, RuntimeWidth) {
+    EXPECT_EQ(hhc::prefix_to_range("-----.", 32), (hhc::value_range<uint64_t>{1, 1}));
+    EXPECT_EQ(hhc::prefix_to_range("-----.", 64).first, 1ULL * 66 * 66 * 66 * 66 * 66);
+    EXPECT_THROW(hhc::prefix_to_range("-", 16), std::invalid_argument);
+    EXPECT_EQ(hhc::range_to_prefixes(0, UINT32_MAX, 32), vector<string>{""});
+    EXPECT_THROW(hhc::range_to_prefixes(0, UINT64_MAX, 32), std::out_of_range);
+    EXPECT_THROW(hhc::range_to_prefixes(0, 1, 128), std::invalid_argument);
+}
+
+TEST(HhcPrefixTest, RangeToPrefixesSimpleCases) {
+    EXPECT_EQ(hhc::range_to_prefixes(0, UINT64_MAX), vector<string>{""});
+    EXPECT_EQ(hhc::range_to_prefixes(66, 131), vector<string>{"---------."});
+    EXPECT_EQ(hhc::range_to_prefixes(7, 7), vector<string>{padded<hhc64_codec>(7)});
+    EXPECT_TRUE(hhc::range_to_prefixes(9, 8).empty());
+    EXPECT_EQ(hhc::range_to_prefixes(0, 66 * 66 - 1), vector<string>{"---------"});
+}
+
+TEST(HhcPrefixTest, RangeToPrefixesTilesRanges) {
+    expect_exact_cover<hhc64_codec>(12345, 98765432);
+    expect_exact_cover<hhc64_codec>(1, UINT64_MAX);
+    expect_exact_cover<hhc64_codec>(UINT64_MAX - 1000000, UINT64_MAX);
+    expect_exact_cover<hhc64_codec>(0, UINT64_MAX - 1);
+    expect_exact_cover<hhc32_codec>(629717763, UINT32_MAX);
+    expect_exact_cover<hhc32_codec>(4355, 4356);
+}
+
+TEST(HhcPrefixTest, RangeToPrefixesIsMinimal) {
+    // Exhaustive over a small decimal codec: every cover is exact and has no mergeable siblings
+    for (uint32_t first = 0; first < 65536; first += 997) {
+        for (uint32_t last = first; last < 65536; last += 1009) {
+            expect_exact_cover<decimal16_codec>(static_cast<uint16_t>(first), static_cast<uint16_t>(last));
+            const auto prefixes =
+                hhc::range_to_prefixes<decimal16_codec>(static_cast<uint16_t>(first), static_cast<uint16_t>(last));
+            ASSERT_EQ(mergeable_runs(prefixes, 10), 0U) << first << ".." << last;
+        }
+    }
+    EXPECT_EQ(hhc::range_to_prefixes<decimal16_codec>(100, 199), vector<string>{"001"});
+    EXPECT_EQ(hhc::range_to_prefixes<decimal16_codec>(60000, 65535), vector<string>{"6"});
+    EXPECT_EQ(hhc::range_to_prefixes<decimal16_codec>(95, 205), (vector<string>{"00095", "00096", "00097", "00098", "00099", "001", "00200", "00201", "00202", "00203", "00204", "00205"}));
+}
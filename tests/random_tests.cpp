@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_random.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <set>
+#include <string>
+
+/**
+ * @file random_tests.cpp
+ * @brief Unit tests covering the batched random token generator.
+ */
+
+
+using hhc::byte_stream_engine;
+using hhc::random_tokens;
+using hhc::token_engine;
+
+using std::string;
+
+namespace {
+
+bool all_in_alphabet(const string& text) {
+    const auto& inverse = hhc::detail::alphabet_tables<hhc::hhc_alphabet>::INVERSE;
+    for (const char c : text) {
+        if (inverse[static_cast<unsigned char>(c)] == hhc::detail::INVALID_DIGIT) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Replays a fixed byte pattern and counts how often it is asked for more
+struct counting_fill {
+    int* calls;
+    void operator()(void* buffer, std::size_t size) const {
+        ++*calls;
+        std::mt19937_64 source(static_cast<uint64_t>(*calls));
+        for (std::size_t i = 0; i < size; i += sizeof(uint64_t)) {
+            const uint64_t word = source();
+            std::memcpy(static_cast<char*>(buffer) + i, &word, sizeof(word));
+        }
+    }
+};
+
+} // namespace
+
+TEST(RandomTokensTest, ChunkCoversTenDigitsPerWord) {
+    using chunk = hhc::detail::random_digit_chunk<hhc::hhc_alphabet>;
+    EXPECT_EQ(chunk::DIGITS, 10U);
+    EXPECT_EQ(chunk::RANGE, 1568336880910795776ULL);
+    // 2^64 = 11 * 66^10 + THRESHOLD
+    EXPECT_EQ(chunk::THRESHOLD, 0 - 11 * chunk::RANGE);
+    EXPECT_EQ(hhc::detail::random_digit_chunk<hhc::base36_alphabet>::DIGITS, 12U);
+}
+
+TEST(RandomTokensTest, MultiplyHighKnownAnswers) {
+    struct vector_case {
+        uint64_t a, b, high, low;
+    };
+    constexpr uint64_t MAX = std::numeric_limits<uint64_t>::max();
+    const vector_case cases[] = {
+        {0, MAX, 0, 0},
+        {1, MAX, 0, MAX},
+        {0xFFFFFFFFULL, 0xFFFFFFFFULL, 0, 0xFFFFFFFE00000001ULL},
+        {1ULL << 32, 1ULL << 32, 1, 0},
+        {MAX, 2, 1, MAX - 1},
+        {1ULL << 63, 3, 1, 1ULL << 63},
+        {MAX, MAX, MAX - 1, 1},
+        {0x123456789ABCDEF0ULL, 0x0FEDCBA987654321ULL, 0x0121FA00AD77D742ULL, 0x2236D88FE5618CF0ULL},
+        {0xDEADBEEFCAFEBABEULL, 0x8000000080000001ULL, 0x6F56DF7854D63CD7ULL, 0xC42D1C4ECAFEBABEULL},
+    };
+    for (const auto& c : cases) {
+        uint64_t low = 0;
+        EXPECT_EQ(hhc::detail::multiply_high_portable(c.a, c.b, low), c.high) << c.a << " * " << c.b;
+        EXPECT_EQ(low, c.low) << c.a << " * " << c.b;
+        low = 0;
+        EXPECT_EQ(hhc::detail::multiply_high(c.a, c.b, low), c.high) << c.a << " * " << c.b;
+        EXPECT_EQ(low, c.low) << c.a << " * " << c.b;
+    }
+    static_assert([] {
+        uint64_t low = 0;
+        return hhc::detail::multiply_high_portable(MAX, MAX, low) == MAX - 1 && low == 1;
+    }());
+}
+
+#if defined(__SIZEOF_INT128__)
+
+TEST(RandomTokensTest, MultiplyHighMatchesWideMultiplication) {
+    std::mt19937_64 rng(7);
+    for (int i = 0; i < 1000; ++i) {
+        const uint64_t a = rng();
+        const uint64_t b = rng();
+        const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+        uint64_t low = 0;
+        EXPECT_EQ(hhc::detail::multiply_high(a, b, low), static_cast<uint64_t>(product >> 64));
+        EXPECT_EQ(low, static_cast<uint64_t>(product));
+        low = 0;
+        EXPECT_EQ(hhc::detail::multiply_high_portable(a, b, low), static_cast<uint64_t>(product >> 64));
+        EXPECT_EQ(low, static_cast<uint64_t>(product));
+    }
+}
+
+#endif
+
+TEST(RandomTokensTest, FillsExactlyCountTimesLength) {
+    token_engine rng(1);
+    for (const std::size_t length : {0U, 1U, 7U, 10U, 11U, 22U, 37U}) {
+        string buffer(3 * length + 1, '#');
+        random_tokens(buffer.data(), 3, length, rng);
+        EXPECT_EQ(buffer.back(), '#') << length;
+        buffer.pop_back();
+        EXPECT_TRUE(all_in_alphabet(buffer)) << length;
+    }
+    EXPECT_EQ(random_tokens(1000, 12, rng).size(), 12000U);
+    EXPECT_TRUE(random_tokens(0, 12, rng).empty());
+}
+
+TEST(RandomTokensTest, SameKeySameTokens) {
+    token_engine a(42);
+    token_engine b(42);
+    token_engine c(43);
+    const string first = random_tokens(100, 16, a);
+    EXPECT_EQ(first, random_tokens(100, 16, b));
+    EXPECT_NE(first, random_tokens(100, 16, c));
+}
+
+TEST(RandomTokensTest, SymbolsAreUniform) {
+    token_engine rng(2024);
+    const string text = random_tokens(100000, 13, rng);
+    std::array<double, hhc::BASE> counts{};
+    const auto& inverse = hhc::detail::alphabet_tables<hhc::hhc_alphabet>::INVERSE;
+    for (const char c : text) {
+        counts[inverse[static_cast<unsigned char>(c)]] += 1;
+    }
+    // Chi-square with 65 degrees of freedom; p = 0.001 critical value is about 107
+    const double expected = static_cast<double>(text.size()) / hhc::BASE;
+    double chi_square = 0;
+    for (const double count : counts) {
+        chi_square += (count - expected) * (count - expected) / expected;
+    }
+    EXPECT_LT(chi_square, 107.0);
+
+    // Every position within a ten-digit chunk is uniform too, including the most significant one
+    std::array<std::array<double, hhc::BASE>, 10> by_position{};
+    for (std::size_t i = 0; i < text.size() - text.size() % 10; ++i) {
+        by_position[i % 10][inverse[static_cast<unsigned char>(text[i])]] += 1;
+    }
+    for (const auto& position : by_position) {
+        const double per_symbol = static_cast<double>(text.size() / 10) / hhc::BASE;
+        double position_chi = 0;
+        for (const double count : position) {
+            position_chi += (count - per_symbol) * (count - per_symbol) / per_symbol;
+        }
+        EXPECT_LT(position_chi, 107.0);
+    }
+}
+
+TEST(RandomTokensTest, TokensDoNotRepeat) {
+    token_engine rng(9);
+    const string text = random_tokens(50000, 12, rng);
+    std::set<string> seen;
+    for (std::size_t i = 0; i < text.size(); i += 12) {
+        EXPECT_TRUE(seen.insert(text.substr(i, 12)).second);
+    }
+}
+
+TEST(RandomTokensTest, AcceptsStandardEngines) {
+    std::mt19937_64 wide(5);
+    std::mt19937 narrow(5);
+    EXPECT_TRUE(all_in_alphabet(random_tokens(100, 11, wide)));
+    EXPECT_TRUE(all_in_alphabet(random_tokens(100, 11, narrow)));
+}
+
+TEST(RandomTokensTest, ByteStreamEngineRefillsInBlocks) {
+    int calls = 0;
+    byte_stream_engine<counting_fill> csprng(counting_fill{&calls});
+    EXPECT_EQ(calls, 0);
+    csprng();
+    EXPECT_EQ(calls, 1);
+    for (int i = 0; i < 63; ++i) {
+        csprng();
+    }
+    EXPECT_EQ(calls, 1);
+    csprng();
+    EXPECT_EQ(calls, 2);
+
+    // About one word per ten symbols, plus the occasional redraw
+    calls = 0;
+    byte_stream_engine<counting_fill> fresh(counting_fill{&calls});
+    const string codes = random_tokens(1000, 10, fresh);
+    EXPECT_TRUE(all_in_alphabet(codes));
+    EXPECT_GE(calls, 16);
+    EXPECT_LE(calls, 19);
+}
+
+TEST(RandomTokensTest, OtherAlphabets) {
+    token_engine rng(3);
+    const string text = random_tokens<hhc::base58_alphabet>(1000, 22, rng);
+    for (const char c : text) {
+        EXPECT_NE(hhc::detail::alphabet_tables<hhc::base58_alphabet>::INVERSE[static_cast<unsigned char>(c)],
+                  hhc::detail::INVALID_DIGIT);
+    }
+}
@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_runtime_codec.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @file runtime_codec_tests.cpp
+ * @brief Unit tests covering the runtime-configurable alphabet codec.
+ */
+
+
+using hhc::ALPHABET;
+using hhc::codec;
+using hhc::hhc_32bit_encode_padded;
+using hhc::hhc_64bit_encode_padded;
+using hhc::HHC_32BIT_ENCODED_LENGTH;
+using hhc::HHC_64BIT_ENCODED_LENGTH;
+using hhc::HHC_32BIT_STRING_LENGTH;
+using hhc::HHC_64BIT_STRING_LENGTH;
+using hhc::HHC_64BIT_ENCODED_MAX_STRING;
+
+using std::string;
+using std::vector;
+
+constexpr auto U32_MAX_VALUE = std::numeric_limits<uint32_t>::max();
+constexpr auto U64_MAX_VALUE = std::numeric_limits<uint64_t>::max();
+
+namespace {
+
+string default_alphabet() {
+    return string(ALPHABET.begin(), ALPHABET.end());
+}
+
+string reversed_alphabet() {
+    string alphabet = default_alphabet();
+    std::reverse(alphabet.begin(), alphabet.end());
+    return alphabet;
+}
+
+/**
+ * @brief Translate a default-alphabet string into another alphabet, character by character.
+ */
+string translate(const string& input, const string& alphabet) {
+    string output;
+    for (const char c : input) {
+        output += alphabet[hhc::INVERSE_ALPHABET[static_cast<unsigned char>(c)]];
+    }
+    return output;
+}
+
+} // namespace
+
+TEST(HhcRuntimeCodecTest, DefaultAlphabetMatchesBuiltInEncoders) {
+    const codec runtime(default_alphabet());
+    for (uint64_t i = 0; i < 10000; ++i) {
+        const uint64_t value = i * 0x9E3779B97F4A7C15ULL;
+        char expected[HHC_64BIT_STRING_LENGTH] = {};
+        char actual[HHC_64BIT_STRING_LENGTH] = {};
+        hhc_64bit_encode_padded(value, expected);
+        runtime.encode_64bit_padded(value, actual);
+        ASSERT_STREQ(actual, expected);
+
+        char expected32[HHC_32BIT_STRING_LENGTH] = {};
+        char actual32[HHC_32BIT_STRING_LENGTH] = {};
+        hhc_32bit_encode_padded(static_cast<uint32_t>(value), expected32);
+        runtime.encode_32bit_padded(static_cast<uint32_t>(value), actual32);
+        ASSERT_STREQ(actual32, expected32);
+    }
+}
+
+TEST(HhcRuntimeCodecTest, ReversedAlphabetTranslatesSymbols) {
+    const string alphabet = reversed_alphabet();
+    const codec runtime(alphabet);
+
+    char buffer[HHC_64BIT_STRING_LENGTH] = {};
+    runtime.encode_64bit_padded(0, buffer);
+    EXPECT_STREQ(buffer, "~~~~~~~~~~~");
+
+    runtime.encode_64bit_padded(U64_MAX_VALUE, buffer);
+    EXPECT_EQ(string(buffer), translate(HHC_64BIT_ENCODED_MAX_STRING, alphabet));
+}
+
+TEST(HhcRuntimeCodecTest, ShuffledAlphabetRoundTrips) {
+    string alphabet = default_alphabet();
+    std::rotate(alphabet.begin(), alphabet.begin() + 17, alphabet.end());
+    std::swap(alphabet[3], alphabet[40]);
+    const codec runtime(alphabet);
+    EXPECT_EQ(string(runtime.alphabet().begin(), runtime.alphabet().end()), alphabet);
+
+    uint64_t value = 7;
+    for (int i = 0; i < 10000; ++i) {
+        value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+        char buffer[HHC_64BIT_STRING_LENGTH] = {};
+        runtime.encode_64bit_padded(value, buffer);
+        ASSERT_EQ(runtime.decode_64bit(buffer), value);
+        ASSERT_EQ(runtime.decode_64bit_unsafe(buffer), value);
+
+        char buffer32[HHC_32BIT_STRING_LENGTH] = {};
+        runtime.encode_32bit_padded(static_cast<uint32_t>(value), buffer32);
+        ASSERT_EQ(runtime.decode_32bit(buffer32), static_cast<uint32_t>(value));
+        ASSERT_EQ(runtime.decode_32bit_unsafe(buffer32), static_cast<uint32_t>(value));
+    }
+}
+
+TEST(HhcRuntimeCodecTest, UnpaddedUsesFirstSymbolAsPadding) {
+    const codec runtime(reversed_alphabet());
+    char buffer[HHC_64BIT_STRING_LENGTH] = {};
+    runtime.encode_64bit_unpadded(1, buffer);
+    EXPECT_STREQ(buffer, "z");
+    EXPECT_EQ(runtime.decode_64bit("z"), 1U);
+
+    runtime.encode_32bit_unpadded(0, buffer);
+    EXPECT_STREQ(buffer, "");
+}
+
+TEST(HhcRuntimeCodecTest, BoundsCheckUsesDigitValues) {
+    const string alphabet = reversed_alphabet();
+    const codec runtime(alphabet);
+
+    const string max_string = translate(HHC_64BIT_ENCODED_MAX_STRING, alphabet);
+    EXPECT_EQ(runtime.decode_64bit(max_string.c_str()), U64_MAX_VALUE);
+
+    const string above_max = translate("9lH9ebONzYE", alphabet);
+    EXPECT_THROW(runtime.decode_64bit(above_max.c_str()), std::out_of_range);
+
+    const string max32 = translate(hhc::HHC_32BIT_ENCODED_MAX_STRING, alphabet);
+    EXPECT_EQ(runtime.decode_32bit(max32.c_str()), U32_MAX_VALUE);
+}
+
+TEST(HhcRuntimeCodecTest, DecodeRejectsInvalidInput) {
+    string alphabet = default_alphabet();
+    alphabet[10] = '!';  // replaces '8'
+    const codec runtime(alphabet);
+
+    EXPECT_THROW(runtime.decode_64bit("8"), std::invalid_argument);
+    EXPECT_EQ(runtime.decode_64bit("!"), 10U);
+    EXPECT_THROW(runtime.decode_64bit(nullptr), std::invalid_argument);
+    EXPECT_THROW(runtime.decode_64bit(""), std::invalid_argument);
+    EXPECT_THROW(runtime.decode_32bit("-------"), std::invalid_argument);
+    EXPECT_EQ(runtime.validate("!!"), 2U);
+    EXPECT_EQ(runtime.validate("88"), 0U);
+}
+
+TEST(HhcRuntimeCodecTest, RejectsMalformedAlphabets) {
+    EXPECT_THROW(codec(""), std::invalid_argument);
+    EXPECT_THROW(codec(default_alphabet().substr(1)), std::invalid_argument);
+    EXPECT_THROW(codec(default_alphabet() + "!"), std::invalid_argument);
+
+    string duplicate = default_alphabet();
+    duplicate[1] = duplicate[0];
+    EXPECT_THROW(codec{duplicate}, std::invalid_argument);
+
+    string non_ascii = default_alphabet();
+    non_ascii[5] = static_cast<char>(0xC3);
+    EXPECT_THROW(codec{non_ascii}, std::invalid_argument);
+
+    string embedded_null = default_alphabet();
+    embedded_null[7] = '\0';
+    EXPECT_THROW(codec{embedded_null}, std::invalid_argument);
+}
+
+TEST(HhcRuntimeCodecTest, BatchMatchesScalar) {
+    const codec runtime(reversed_alphabet());
+    vector<uint64_t> inputs(300);
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        inputs[i] = U64_MAX_VALUE - i * 0x12345ULL;
+    }
+    string batch(inputs.size() * HHC_64BIT_ENCODED_LENGTH, '\0');
+    runtime.encode_64bit_padded_batch(inputs.data(), inputs.size(), batch.data());
+
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        char buffer[HHC_64BIT_STRING_LENGTH] = {};
+        runtime.encode_64bit_padded(inputs[i], buffer);
+        ASSERT_EQ(batch.substr(i * HHC_64BIT_ENCODED_LENGTH, HHC_64BIT_ENCODED_LENGTH), string(buffer));
+    }
+
+    vector<uint64_t> decoded(inputs.size());
+    runtime.decode_64bit_batch(batch.data(), decoded.size(), decoded.data());
+    EXPECT_EQ(decoded, inputs);
+
+    vector<uint32_t> inputs32 = {0, 1, 424242, U32_MAX_VALUE};
+    string batch32(inputs32.size() * HHC_32BIT_ENCODED_LENGTH, '\0');
+    runtime.encode_32bit_padded_batch(inputs32.data(), inputs32.size(), batch32.data());
+    vector<uint32_t> decoded32(inputs32.size());
+    runtime.decode_32bit_batch(batch32.data(), decoded32.size(), decoded32.data());
+    EXPECT_EQ(decoded32, inputs32);
+}
+
+TEST(HhcRuntimeCodecTest, BatchDecodeRejectsForeignCharacters) {
+    const codec runtime(reversed_alphabet());
+    const string batch = "~~~~~~~~~~~~~~~~~~~~~?";
+    vector<uint64_t> decoded(2);
+    EXPECT_THROW(runtime.decode_64bit_batch(batch.data(), 2, decoded.data()), std::invalid_argument);
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_sequence.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file sequence_tests.cpp
+ * @brief Unit tests covering the odometer sequence encoder and encode_range.
+ */
+
+
+using hhc::hhc32_codec;
+using hhc::hhc64_codec;
+
+using std::string;
+using std::vector;
+
+namespace {
+
+template <typename Codec>
+string encode(typename Codec::value_type value) {
+    string text(Codec::ENCODED_LENGTH, '\0');
+    Codec::encode_padded(value, text.data());
+    return text;
+}
+
+template <typename Codec>
+string encode_range_string(typename Codec::value_type start, std::size_t count) {
+    string text(count * Codec::ENCODED_LENGTH, '\0');
+    hhc::encode_range<Codec>(start, count, text.data());
+    return text;
+}
+
+template <typename Codec>
+string encode_each(typename Codec::value_type start, std::size_t count) {
+    string text;
+    for (std::size_t i = 0; i < count; ++i) {
+        text += encode<Codec>(static_cast<typename Codec::value_type>(start + i));
+    }
+    return text;
+}
+
+} // namespace
+
+TEST(HhcSequenceTest, StartsAtGivenValue) {
+    const hhc::sequence_encoder ids(629717763ULL);
+    EXPECT_EQ(ids.value(), 629717763ULL);
+    EXPECT_EQ(ids.view(), encode<hhc64_codec>(629717763ULL));
+    EXPECT_EQ(std::string_view(ids.c_str()), ids.view());
+}
+
+TEST(HhcSequenceTest, DefaultStartsAtZero) {
+    const hhc::sequence_encoder ids;
+    EXPECT_EQ(ids.value(), 0U);
+    EXPECT_EQ(ids.view(), "-----------");
+}
+
+TEST(HhcSequenceTest, IncrementMatchesEncodeAcrossCarries) {
+    // Crosses several carries of the last digit and one of the second to last
+    hhc::sequence_encoder ids(hhc64_codec::BASE * hhc64_codec::BASE - 100);
+    for (uint64_t value = ids.value(); value < hhc64_codec::BASE * hhc64_codec::BASE + 200; ++value) {
+        ASSERT_EQ(ids.value(), value);
+        ASSERT_EQ(ids.view(), encode<hhc64_codec>(value)) << "value " << value;
+        ++ids;
+    }
+}
+
+TEST(HhcSequenceTest, IncrementCarriesThroughManyDigits) {
+    uint64_t value = 1;
+    for (std::size_t digits = 0; digits < 10; ++digits) {
+        value *= hhc64_codec::BASE;
+    }
+    hhc::sequence_encoder ids(value - 1);
+    ++ids;
+    EXPECT_EQ(ids.value(), value);
+    EXPECT_EQ(ids.view(), encode<hhc64_codec>(value));
+}
+
+TEST(HhcSequenceTest, IncrementPastMaxWrapsToZero) {
+    hhc::sequence_encoder32 ids(UINT32_MAX - 1);
+    EXPECT_EQ(ids.view(), encode<hhc32_codec>(UINT32_MAX - 1));
+    ++ids;
+    EXPECT_EQ(ids.view(), std::string_view(hhc32_codec::MAX_STRING.data()));
+    ++ids;
+    EXPECT_EQ(ids.value(), 0U);
+    EXPECT_EQ(ids.view(), "------");
+}
+
+TEST(HhcSequenceTest, NextWritesThenAdvances) {
+    hhc::sequence_encoder32 ids(65);
+    string first(hhc32_codec::ENCODED_LENGTH, '\0');
+    string second(hhc32_codec::ENCODED_LENGTH, '\0');
+    ids.next(first.data());
+    ids.next(second.data());
+    EXPECT_EQ(first, encode<hhc32_codec>(65));
+    EXPECT_EQ(second, encode<hhc32_codec>(66));
+    EXPECT_EQ(ids.value(), 67U);
+}
+
+TEST(HhcSequenceTest, ResetReencodes) {
+    hhc::sequence_encoder ids(5);
+    ids.reset(UINT64_MAX);
+    EXPECT_EQ(ids.view(), std::string_view(hhc64_codec::MAX_STRING.data()));
+}
+
+TEST(HhcSequenceTest, UsableInConstantExpressions) {
+    constexpr auto advanced = [] {
+        hhc::sequence_encoder32 ids(65);
+        ++ids;
+        ++ids;
+        return ids;
+    }();
+    static_assert(advanced.value() == 67);
+    EXPECT_EQ(advanced.view(), encode<hhc32_codec>(67));
+}
+
+TEST(HhcEncodeRangeTest, MatchesPerValueEncoding) {
+    for (uint64_t start : {0ULL, 1ULL, 65ULL, 66ULL, 4290ULL, 629717763ULL}) {
+        for (std::size_t count : {1U, 2U, 65U, 66U, 67U, 1000U}) {
+            ASSERT_EQ(encode_range_string<hhc64_codec>(start, count), encode_each<hhc64_codec>(start, count))
+                << "start " << start << " count " << count;
+        }
+    }
+}
+
+TEST(HhcEncodeRangeTest, Matches32BitEncoding) {
+    EXPECT_EQ(encode_range_string<hhc32_codec>(4000, 5000), encode_each<hhc32_codec>(4000, 5000));
+}
+
+TEST(HhcEncodeRangeTest, ReachesMaxValue) {
+    EXPECT_EQ(encode_range_string<hhc32_codec>(UINT32_MAX - 99, 100), encode_each<hhc32_codec>(UINT32_MAX - 99, 100));
+    EXPECT_EQ(encode_range_string<hhc64_codec>(UINT64_MAX, 1), string(hhc64_codec::MAX_STRING.data()));
+}
+
+TEST(HhcEncodeRangeTest, ThrowsPastMaxValue) {
+    string text(2 * hhc32_codec::ENCODED_LENGTH, '\0');
+    EXPECT_THROW(hhc::encode_range<hhc32_codec>(UINT32_MAX, 2, text.data()), std::out_of_range);
+}
+
+TEST(HhcEncodeRangeTest, EmptyRangeWritesNothing) {
+    EXPECT_NO_THROW(hhc::encode_range(UINT64_MAX, 0, nullptr));
+}
@@ -0,0 +1,317 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_shm_allocator.hpp"
+
+#if HHC_HAVE_SHM_ALLOCATOR
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/**
+ * @file shm_allocator_tests.cpp
+ * @brief Unit tests covering the cross-process shared-memory ID allocator.
+ */
+
+
+using hhc::hhc64_codec;
+using hhc::shm_allocator_options;
+using hhc::shm_id_allocator;
+
+using std::string;
+using std::vector;
+
+namespace {
+
+class ShmAllocatorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const string suffix = std::to_string(::getpid()) + "_" +
+                              ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        name_ = "/hhc_test_" + suffix;
+        checkpoint_ = ::testing::TempDir() + "hhc_checkpoint_" + suffix;
+        cleanup();
+    }
+
+    void TearDown() override { cleanup(); }
+
+    void cleanup() const {
+        shm_id_allocator::remove(name_);
+        std::remove(checkpoint_.c_str());
+        std::remove((checkpoint_ + ".lock").c_str());
+        std::remove((checkpoint_ + ".tmp").c_str());
+    }
+
+    shm_allocator_options checkpointed(uint64_t block_size, uint64_t interval) const {
+        shm_allocator_options options;
+        options.block_size = block_size;
+        options.checkpoint_path = checkpoint_;
+        options.checkpoint_interval = interval;
+        return options;
+    }
+
+    string read_file() const {
+        std::ifstream file(checkpoint_);
+        return string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    /// Leave a sized but uninitialized segment behind, as a creator that died would
+    void create_abandoned_segment() const {
+        const int fd = ::shm_open(name_.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        ASSERT_GE(fd, 0);
+        EXPECT_EQ(::ftruncate(fd, 4096), 0);
+        ::close(fd);
+    }
+
+    string name_;
+    string checkpoint_;
+};
+
+string padded(uint64_t id) {
+    string text(hhc64_codec::ENCODED_LENGTH, '\0');
+    hhc64_codec::encode_padded(id, text.data());
+    return text;
+}
+
+} // namespace
+
+TEST_F(ShmAllocatorTest, BlocksAreConsecutive) {
+    shm_allocator_options options;
+    options.first_id = 1000;
+    shm_id_allocator allocator(name_, options);
+    const auto first = allocator.allocate(10);
+    const auto second = allocator.allocate(5);
+    EXPECT_EQ(first.first, 1000U);
+    EXPECT_EQ(first.count, 10U);
+    EXPECT_EQ(second.first, 1010U);
+    EXPECT_EQ(allocator.peek(), 1015U);
+}
+
+TEST_F(ShmAllocatorTest, InstancesShareTheSegment) {
+    shm_id_allocator a(name_);
+    shm_id_allocator b(name_);
+    EXPECT_EQ(a.allocate(3).first, 0U);
+    EXPECT_EQ(b.allocate(3).first, 3U);
+    EXPECT_EQ(a.allocate(1).first, 6U);
+}
+
+TEST_F(ShmAllocatorTest, LocalAllocatorEncodesEveryId) {
+    shm_allocator_options options;
+    options.block_size = 70;
+    options.first_id = 60;
+    shm_id_allocator allocator(name_, options);
+    auto local = allocator.local();
+    auto other = allocator.local();
+    char key[hhc64_codec::ENCODED_LENGTH];
+    uint64_t previous = 0;
+    for (int i = 0; i < 500; ++i) {
+        const uint64_t id = local.next(key);
+        EXPECT_EQ(string(key, sizeof(key)), padded(id));
+        if (i > 0) {
+            EXPECT_GT(id, previous);
+        }
+        previous = id;
+        if (i % 100 == 0) {
+            other.next();
+        }
+    }
+}
+
+TEST_F(ShmAllocatorTest, ProcessesGetUniqueIds) {
+    shm_allocator_options options = checkpointed(16, 1000);
+    constexpr int PROCESSES = 4;
+    constexpr int PER_PROCESS = 5000;
+
+    int pipes[PROCESSES][2];
+    vector<pid_t> children;
+    for (int p = 0; p < PROCESSES; ++p) {
+        ASSERT_EQ(::pipe(pipes[p]), 0);
+        const pid_t pid = ::fork();
+        ASSERT_GE(pid, 0);
+        if (pid == 0) {
+            ::close(pipes[p][0]);
+            int status = 0;
+            try {
+                shm_id_allocator allocator(name_, options);
+                auto local = allocator.local();
+                vector<uint64_t> ids(PER_PROCESS);
+                for (std::size_t i = 0; i < ids.size(); ++i) {
+                    ids[i] = (i % 3 == 0) ? allocator.allocate(1).first : local.next();
+                }
+                const auto bytes = static_cast<ssize_t>(ids.size() * sizeof(uint64_t));
+                status = ::write(pipes[p][1], ids.data(), static_cast<std::size_t>(bytes)) == bytes ? 0 : 1;
+            } catch (...) {
+                status = 2;
+            }
+            ::_exit(status);
+        }
+        ::close(pipes[p][1]);
+        children.push_back(pid);
+    }
+
+    vector<uint64_t> all;
+    for (int p = 0; p < PROCESSES; ++p) {
+        vector<uint64_t> ids(PER_PROCESS);
+        std::size_t received = 0;
+        auto* bytes = reinterpret_cast<char*>(ids.data());
+        while (received < ids.size() * sizeof(uint64_t)) {
+            const ssize_t got = ::read(pipes[p][0], bytes + received, ids.size() * sizeof(uint64_t) - received);
+            if (got <= 0) {
+                break;
+            }
+            received += static_cast<std::size_t>(got);
+        }
+        ::close(pipes[p][0]);
+        EXPECT_EQ(received, ids.size() * sizeof(uint64_t));
+        all.insert(all.end(), ids.begin(), ids.end());
+    }
+    for (const pid_t pid : children) {
+        int status = 0;
+        ::waitpid(pid, &status, 0);
+        EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    }
+
+    std::sort(all.begin(), all.end());
+    EXPECT_EQ(std::adjacent_find(all.begin(), all.end()), all.end());
+    shm_id_allocator allocator(name_, options);
+    EXPECT_GE(allocator.high_water_mark(), all.back() + 1);
+    EXPECT_EQ(hhc64_codec::decode(read_file().c_str(), hhc64_codec::ENCODED_LENGTH), allocator.high_water_mark());
+}
+
+TEST_F(ShmAllocatorTest, CheckpointCoversIssuedIds) {
+    shm_id_allocator allocator(name_, checkpointed(100, 1000));
+    EXPECT_EQ(allocator.high_water_mark(), 0U);
+    const auto block = allocator.allocate(100);
+    EXPECT_EQ(block.first, 0U);
+    EXPECT_EQ(allocator.high_water_mark(), 1100U);
+    EXPECT_EQ(read_file(), padded(1100) + "\n");
+
+    // Further blocks inside the reserved interval do not rewrite the file
+    for (int i = 0; i < 9; ++i) {
+        allocator.allocate(100);
+    }
+    EXPECT_EQ(allocator.high_water_mark(), 1100U);
+    allocator.allocate(200);
+    EXPECT_EQ(allocator.high_water_mark(), 2200U);
+    EXPECT_EQ(read_file(), padded(2200) + "\n");
+}
+
+TEST_F(ShmAllocatorTest, RestartResumesFromTheCheckpoint) {
+    uint64_t last = 0;
+    {
+        shm_id_allocator allocator(name_, checkpointed(64, 500));
+        auto local = allocator.local();
+        for (int i = 0; i < 1234; ++i) {
+            last = local.next();
+        }
+    }
+    // A reboot or crash loses the segment but not the checkpoint file
+    ASSERT_TRUE(shm_id_allocator::remove(name_));
+
+    shm_id_allocator restarted(name_, checkpointed(64, 500));
+    const uint64_t resumed = restarted.allocate(1).first;
+    EXPECT_GT(resumed, last);
+    EXPECT_LE(resumed - last, 64U + 500U + 1U);
+}
+
+TEST_F(ShmAllocatorTest, FirstIdBelowTheCheckpointIsIgnored) {
+    {
+        std::ofstream file(checkpoint_);
+        file << padded(5000) << "\n";
+    }
+    shm_allocator_options options = checkpointed(1, 10);
+    options.first_id = 10;
+    shm_id_allocator allocator(name_, options);
+    EXPECT_EQ(allocator.allocate(1).first, 5000U);
+}
+
+TEST_F(ShmAllocatorTest, RejectsCorruptCheckpointsAndBadOptions) {
+    {
+        std::ofstream file(checkpoint_);
+        file << "not an id!!\n";
+    }
+    EXPECT_THROW(shm_id_allocator(name_, checkpointed(1, 10)), std::invalid_argument);
+    // The failed open must not leave a half-made segment behind
+    EXPECT_FALSE(shm_id_allocator::remove(name_));
+    EXPECT_THROW(shm_id_allocator(name_, checkpointed(0, 10)), std::invalid_argument);
+    EXPECT_THROW(shm_id_allocator(name_, checkpointed(1, 0)), std::invalid_argument);
+}
+
+TEST_F(ShmAllocatorTest, ReplacesSegmentsAbandonedByTheirCreator) {
+    {
+        std::ofstream file(checkpoint_);
+        file << padded(700) << "\n";
+    }
+    create_abandoned_segment();
+    shm_id_allocator allocator(name_, checkpointed(1, 10));
+    EXPECT_EQ(allocator.allocate(1).first, 700U);
+
+    // Processes opening the replacement share it
+    shm_id_allocator second(name_, checkpointed(1, 10));
+    EXPECT_EQ(second.allocate(1).first, 701U);
+}
+
+TEST_F(ShmAllocatorTest, NamesAbandonedSegmentsWithoutACheckpoint) {
+    create_abandoned_segment();
+    shm_allocator_options options;
+    options.open_timeout = std::chrono::milliseconds(10);
+    try {
+        shm_id_allocator allocator(name_, options);
+        FAIL() << "expected std::system_error";
+    } catch (const std::system_error& error) {
+        EXPECT_EQ(error.code(), std::errc::timed_out);
+        EXPECT_NE(string(error.what()).find(name_), string::npos);
+    }
+    ASSERT_TRUE(shm_id_allocator::remove(name_));
+    shm_id_allocator allocator(name_, options);
+    EXPECT_EQ(allocator.allocate(1).first, 0U);
+}
+
+TEST_F(ShmAllocatorTest, ReportsExhaustedIdSpace) {
+    shm_allocator_options options;
+    options.first_id = UINT64_MAX - 10;
+    shm_id_allocator allocator(name_, options);
+    EXPECT_EQ(allocator.allocate(5).first, UINT64_MAX - 10);
+    EXPECT_THROW(allocator.allocate(10), std::out_of_range);
+    // The failed call must not wrap the counter round to small IDs
+    EXPECT_EQ(allocator.peek(), UINT64_MAX - 5);
+    EXPECT_EQ(allocator.allocate(5).first, UINT64_MAX - 5);
+}
+
+TEST_F(ShmAllocatorTest, ThreadsCheckpointInOrder) {
+    // Tiny blocks and intervals make the threads race on nearly every checkpoint
+    shm_id_allocator allocator(name_, checkpointed(4, 8));
+    constexpr int THREADS = 4;
+    constexpr int IDS_PER_THREAD = 5000;
+    vector<uint64_t> highest(THREADS);
+    vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&allocator, &highest, t] {
+            auto local = allocator.local();
+            for (int i = 0; i < IDS_PER_THREAD; ++i) {
+                highest[t] = std::max(highest[t], local.next());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const uint64_t issued = *std::max_element(highest.begin(), highest.end());
+    EXPECT_GT(allocator.high_water_mark(), issued);
+    const string file = read_file();
+    ASSERT_EQ(file.size(), hhc64_codec::ENCODED_LENGTH + 1);
+    EXPECT_EQ(hhc64_codec::decode(file.c_str(), hhc64_codec::ENCODED_LENGTH), allocator.high_water_mark());
+}
+
+#endif // HHC_HAVE_SHM_ALLOCATOR
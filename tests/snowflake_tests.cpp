@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_snowflake.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @file snowflake_tests.cpp
+ * @brief Unit tests covering the time-ordered snowflake ID generator.
+ */
+
+
+using hhc::hhc64_codec;
+using hhc::SNOWFLAKE_DEFAULT_EPOCH;
+
+using std::string;
+using std::vector;
+
+namespace {
+
+/// A clock the test sets by hand, in milliseconds since the Unix epoch
+struct manual_clock {
+    using duration = std::chrono::milliseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<manual_clock>;
+    static constexpr bool is_steady = false;
+
+    static inline std::atomic<int64_t> millis{SNOWFLAKE_DEFAULT_EPOCH};
+
+    static time_point now() noexcept { return time_point(duration(millis.load())); }
+};
+
+using manual_generator = hhc::basic_snowflake_generator<manual_clock>;
+
+class SnowflakeTest : public ::testing::Test {
+protected:
+    void SetUp() override { manual_clock::millis = SNOWFLAKE_DEFAULT_EPOCH + 1000; }
+};
+
+string padded(uint64_t id) {
+    string text(hhc64_codec::ENCODED_LENGTH, '\0');
+    hhc64_codec::encode_padded(id, text.data());
+    return text;
+}
+
+} // namespace
+
+TEST_F(SnowflakeTest, IdsCarryTimestampWorkerAndSequence) {
+    manual_generator generator(7);
+    const uint64_t first = generator.next();
+    const uint64_t second = generator.next();
+    EXPECT_EQ(first, (uint64_t{1000} << 22) | (uint64_t{7} << 12));
+    EXPECT_EQ(second, first + 1);
+
+    const auto parts = manual_generator::parse(second);
+    EXPECT_EQ(parts.timestamp, SNOWFLAKE_DEFAULT_EPOCH + 1000);
+    EXPECT_EQ(parts.worker, 7U);
+    EXPECT_EQ(parts.sequence, 1U);
+}
+
+TEST_F(SnowflakeTest, EncodingMatchesTheCodec) {
+    manual_generator generator(3);
+    auto local = generator.local();
+    char key[hhc64_codec::ENCODED_LENGTH];
+    for (int i = 0; i < 500; ++i) {
+        if (i % 100 == 0) {
+            ++manual_clock::millis;
+        }
+        const uint64_t id = local.next(key);
+        EXPECT_EQ(string(key, sizeof(key)), padded(id));
+        EXPECT_EQ(local.view(), padded(id));
+        const uint64_t shared_id = generator.next(key);
+        EXPECT_EQ(string(key, sizeof(key)), padded(shared_id));
+    }
+}
+
+TEST_F(SnowflakeTest, IdsAndEncodingsIncreaseWithTime) {
+    manual_generator generator(1);
+    auto local = generator.local();
+    // Each source is strictly increasing; across sources only the timestamps are ordered
+    uint64_t previous[2] = {0, 0};
+    string previous_key[2];
+    int64_t previous_timestamp = 0;
+    for (int i = 0; i < 10000; ++i) {
+        if (i % 37 == 0) {
+            manual_clock::millis += 1 + i % 3;
+        }
+        char key[hhc64_codec::ENCODED_LENGTH];
+        const int source = i % 5 == 0 ? 0 : 1;
+        const uint64_t id = source == 0 ? generator.next(key) : local.next(key);
+        EXPECT_GT(id, previous[source]);
+        EXPECT_GT(string(key, sizeof(key)), previous_key[source]);
+        EXPECT_GE(manual_generator::parse(id).timestamp, previous_timestamp);
+        previous[source] = id;
+        previous_key[source].assign(key, sizeof(key));
+        previous_timestamp = manual_generator::parse(id).timestamp;
+    }
+}
+
+TEST_F(SnowflakeTest, LocalBlocksFollowTheClock) {
+    manual_generator generator(0);
+    auto local = generator.local();
+    EXPECT_EQ(manual_generator::parse(local.next()).timestamp, manual_clock::millis.load());
+    // The rest of the block is from an older millisecond, so a fresh one is reserved
+    manual_clock::millis += 50;
+    EXPECT_EQ(manual_generator::parse(local.next()).timestamp, manual_clock::millis.load());
+}
+
+TEST_F(SnowflakeTest, SequenceOverflowBorrowsTheNextMillisecond) {
+    manual_generator generator(2);
+    auto local = generator.local();
+    const int64_t now = manual_clock::millis;
+    std::set<uint64_t> seen;
+    for (int i = 0; i < 4096 * 3; ++i) {
+        EXPECT_TRUE(seen.insert(local.next()).second);
+    }
+    const auto last = manual_generator::parse(*seen.rbegin());
+    EXPECT_EQ(last.timestamp, now + 2);
+    EXPECT_EQ(last.sequence, 4095U);
+}
+
+TEST_F(SnowflakeTest, ClockSteppingBackNeverRepeatsIds) {
+    manual_generator generator(4);
+    const uint64_t before = generator.next();
+    manual_clock::millis -= 500;
+    const uint64_t after = generator.next();
+    EXPECT_GT(after, before);
+    EXPECT_EQ(manual_generator::parse(after).timestamp, manual_generator::parse(before).timestamp);
+}
+
+TEST_F(SnowflakeTest, MovedLocalGeneratorsDoNotShareBlocks) {
+    manual_generator generator(5);
+    auto first = generator.local();
+    const uint64_t a = first.next();
+    auto second = std::move(first);
+    const uint64_t b = second.next();
+    const uint64_t c = first.next();
+    EXPECT_EQ(b, a + 1);
+    EXPECT_GT(c, b);
+}
+
+TEST_F(SnowflakeTest, ConcurrentThreadsGetUniqueIds) {
+    manual_generator generator(9);
+    constexpr int THREADS = 4;
+    constexpr int PER_THREAD = 20000;
+    vector<vector<uint64_t>> results(THREADS);
+    vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&, t] {
+            auto local = generator.local();
+            results[t].reserve(PER_THREAD);
+            for (int i = 0; i < PER_THREAD; ++i) {
+                if (t == 0 && i % 1000 == 0) {
+                    ++manual_clock::millis;
+                }
+                results[t].push_back(i % 2 == 0 ? local.next() : generator.next());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    vector<uint64_t> all;
+    for (const auto& ids : results) {
+        all.insert(all.end(), ids.begin(), ids.end());
+    }
+    std::sort(all.begin(), all.end());
+    EXPECT_EQ(std::adjacent_find(all.begin(), all.end()), all.end());
+}
+
+TEST_F(SnowflakeTest, RejectsBadWorkersAndClocks) {
+    EXPECT_THROW(manual_generator(1024), std::out_of_range);
+    EXPECT_NO_THROW(manual_generator(1023));
+
+    manual_generator generator(0);
+    manual_clock::millis = SNOWFLAKE_DEFAULT_EPOCH - 1;
+    EXPECT_THROW(generator.next(), std::out_of_range);
+    manual_clock::millis = SNOWFLAKE_DEFAULT_EPOCH + (int64_t{1} << 41);
+    EXPECT_THROW(generator.next(), std::out_of_range);
+}
+
+TEST(SnowflakeSystemClockTest, TimestampsAreCurrent) {
+    hhc::snowflake_generator generator(12);
+    const auto before = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    const auto parts = hhc::snowflake_generator::parse(generator.local().next());
+    EXPECT_GE(parts.timestamp, before);
+    EXPECT_LT(parts.timestamp, before + 60000);
+    EXPECT_EQ(parts.worker, 12U);
+}
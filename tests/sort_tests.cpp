@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_sort.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @file sort_tests.cpp
+ * @brief Unit tests covering the radix sort of encoded records.
+ */
+
+
+using hhc::hhc32_codec;
+using hhc::hhc64_codec;
+
+using std::string;
+using std::vector;
+
+namespace {
+
+template <typename Codec>
+string encode_records(const vector<typename Codec::value_type>& values) {
+    string records(values.size() * Codec::ENCODED_LENGTH, '\0');
+    Codec::encode_padded_batch(values.data(), values.size(), records.data());
+    return records;
+}
+
+/// Reference result: the records sorted as strings with std::sort
+template <typename Codec>
+string string_sorted(const string& records) {
+    vector<string> split;
+    for (std::size_t offset = 0; offset < records.size(); offset += Codec::ENCODED_LENGTH) {
+        split.push_back(records.substr(offset, Codec::ENCODED_LENGTH));
+    }
+    std::sort(split.begin(), split.end());
+    string joined;
+    for (const auto& record : split) {
+        joined += record;
+    }
+    return joined;
+}
+
+vector<uint64_t> make_ids(std::size_t count, uint64_t mask) {
+    vector<uint64_t> ids(count);
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    for (auto& id : ids) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        id = (seed ^ (seed >> 29)) & mask;
+    }
+    return ids;
+}
+
+} // namespace
+
+TEST(HhcSortTest, EmptyAndSingle) {
+    EXPECT_NO_THROW(hhc::sort_encoded(nullptr, 0));
+    string one = encode_records<hhc64_codec>({42});
+    hhc::sort_encoded(one.data(), 1);
+    EXPECT_EQ(one, encode_records<hhc64_codec>({42}));
+}
+
+TEST(HhcSortTest, SmallInputMatchesStringSort) {
+    string records = encode_records<hhc64_codec>({5, UINT64_MAX, 0, 66, 65, 5, 629717763});
+    const string expected = string_sorted<hhc64_codec>(records);
+    hhc::sort_encoded(records.data(), 7);
+    EXPECT_EQ(records, expected);
+}
+
+TEST(HhcSortTest, RadixPathMatchesStringSort) {
+    string records = encode_records<hhc64_codec>(make_ids(5000, UINT64_MAX));
+    const string expected = string_sorted<hhc64_codec>(records);
+    hhc::sort_encoded(records.data(), 5000);
+    EXPECT_EQ(records, expected);
+}
+
+TEST(HhcSortTest, SkipsConstantBytes) {
+    // Only the low bytes differ, so most radix passes are skipped
+    vector<uint64_t> ids = make_ids(3000, 0xFFFFULL);
+    for (auto& id : ids) {
+        id |= 0x0123456700000000ULL;
+    }
+    string records = encode_records<hhc64_codec>(ids);
+    const string expected = string_sorted<hhc64_codec>(records);
+    hhc::sort_encoded(records.data(), ids.size());
+    EXPECT_EQ(records, expected);
+}
+
+TEST(HhcSortTest, Sorts32BitRecords) {
+    vector<uint32_t> ids;
+    for (uint64_t id : make_ids(4000, UINT32_MAX)) {
+        ids.push_back(static_cast<uint32_t>(id));
+    }
+    string records = encode_records<hhc32_codec>(ids);
+    const string expected = string_sorted<hhc32_codec>(records);
+    hhc::sort_encoded<hhc32_codec>(records.data(), ids.size());
+    EXPECT_EQ(records, expected);
+}
+
+TEST(HhcSortTest, ParallelMatchesSerial) {
+    const string records = encode_records<hhc64_codec>(make_ids(100000, UINT64_MAX));
+    string serial = records;
+    string parallel = records;
+    hhc::sort_encoded(serial.data(), 100000, 1);
+    hhc::sort_encoded(parallel.data(), 100000, 4);
+    EXPECT_EQ(parallel, serial);
+    EXPECT_EQ(serial, string_sorted<hhc64_codec>(records));
+}
+
+TEST(HhcSortTest, MoreThreadsThanRecords) {
+    string records = encode_records<hhc64_codec>({3, 1, 2});
+    hhc::sort_encoded(records.data(), 3, 16);
+    EXPECT_EQ(records, encode_records<hhc64_codec>({1, 2, 3}));
+}
+
+TEST(HhcSortTest, InvalidRecordThrowsAndLeavesInputUntouched) {
+    string records = encode_records<hhc64_codec>(make_ids(1000, UINT64_MAX));
+    records[700 * hhc64_codec::ENCODED_LENGTH + 4] = '!';
+    const string original = records;
+    EXPECT_THROW(hhc::sort_encoded(records.data(), 1000, 4), std::invalid_argument);
+    EXPECT_EQ(records, original);
+}
+
+TEST(HhcSortTest, OutOfRangeRecordThrows) {
+    string records = encode_records<hhc64_codec>({1, 2});
+    records.replace(0, hhc64_codec::ENCODED_LENGTH, hhc64_codec::ENCODED_LENGTH, hhc::ALPHABET.back());
+    EXPECT_THROW(hhc::sort_encoded(records.data(), 2), std::out_of_range);
+}
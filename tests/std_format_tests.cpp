@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_format.hpp"
+
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <string>
+
+/**
+ * @file std_format_tests.cpp
+ * @brief Unit tests covering the std::format formatter specializations (C++20).
+ */
+
+
+using hhc::as_hhc;
+
+using std::string;
+
+static_assert(__cpp_lib_format >= 201907L, "std_format_tests.cpp needs <format>");
+
+TEST(StdFormatTest, FormatsPaddedByDefault) {
+    EXPECT_EQ(std::format("{}", as_hhc(424242U)), "--.TNv");
+    EXPECT_EQ(std::format("{:p}", as_hhc(uint64_t{9876543210ULL})), "-----5tVfK4");
+}
+
+TEST(StdFormatTest, FormatsUnpaddedAndWidths) {
+    EXPECT_EQ(std::format("id={:u}", as_hhc(uint64_t{9876543210ULL})), "id=5tVfK4");
+    EXPECT_EQ(std::format("{:8}", as_hhc(424242U)), "----.TNv");
+    EXPECT_EQ(std::format("{:u8}", as_hhc(424242U)), "----.TNv");
+    EXPECT_EQ(std::format("{:u}/{:u}", as_hhc(1U), as_hhc(uint64_t{66})), "./.-");
+}
+
+TEST(StdFormatTest, FormatsIntoAnIterator) {
+    string result;
+    std::format_to(std::back_inserter(result), "{}", as_hhc(uint64_t{0}));
+    EXPECT_EQ(result, string(hhc::HHC_64BIT_ENCODED_LENGTH, '-'));
+}
+
+TEST(StdFormatTest, RejectsUnknownSpecs) {
+    // make_format_args binds lvalues only
+    const auto one = as_hhc(1U);
+    EXPECT_THROW((void)std::vformat("{:x}", std::make_format_args(one)), std::format_error);
+}
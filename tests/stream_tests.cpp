@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_stream.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @file stream_tests.cpp
+ * @brief Unit tests covering the streaming block codec for byte buffers.
+ */
+
+
+using hhc::hhc_stream_encode;
+using hhc::hhc_stream_decode;
+using hhc::hhc_stream_encoded_length;
+using hhc::hhc_stream_decoded_length;
+using hhc::stream_encoder;
+using hhc::stream_decoder;
+
+using std::string;
+using std::vector;
+
+static_assert(hhc_stream_encoded_length(0) == 0);
+static_assert(hhc_stream_encoded_length(8) == 11);
+static_assert(hhc_stream_encoded_length(15) == 21);
+static_assert(hhc_stream_decoded_length(21) == 15);
+
+namespace {
+
+vector<uint8_t> make_bytes(std::size_t size, uint64_t seed) {
+    vector<uint8_t> bytes(size);
+    for (auto& byte : bytes) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        byte = static_cast<uint8_t>(seed >> 56);
+    }
+    return bytes;
+}
+
+string encode(const vector<uint8_t>& bytes) {
+    string encoded(hhc_stream_encoded_length(bytes.size()), '\0');
+    EXPECT_EQ(hhc_stream_encode(bytes.data(), bytes.size(), &encoded[0]), encoded.size());
+    return encoded;
+}
+
+vector<uint8_t> decode(const string& encoded) {
+    vector<uint8_t> bytes(hhc_stream_decoded_length(encoded.size()));
+    EXPECT_EQ(hhc_stream_decode(encoded.data(), encoded.size(), bytes.data()), bytes.size());
+    return bytes;
+}
+
+} // namespace
+
+TEST(HhcStreamTest, TailLengths) {
+    const std::size_t expected[] = {0, 2, 3, 4, 6, 7, 8, 10, 11};
+    for (std::size_t size = 0; size <= 8; ++size) {
+        EXPECT_EQ(hhc_stream_encoded_length(size), expected[size]);
+        EXPECT_EQ(hhc_stream_decoded_length(expected[size]), size);
+        EXPECT_EQ(hhc_stream_encoded_length(size + 80), expected[size] + 110);
+    }
+    for (std::size_t length : {1U, 5U, 9U, 12U, 27U}) {
+        EXPECT_THROW(hhc_stream_decoded_length(length), std::invalid_argument);
+    }
+}
+
+TEST(HhcStreamTest, FullBlocksMatch64BitEncoder) {
+    const vector<uint8_t> bytes = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF,
+                                   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+    char first[hhc::HHC_64BIT_STRING_LENGTH] = {};
+    hhc::hhc_64bit_encode_padded(0x0123456789ABCDEFULL, first);
+    EXPECT_EQ(encode(bytes), string(first) + hhc::HHC_64BIT_ENCODED_MAX_STRING);
+}
+
+TEST(HhcStreamTest, TailBoundaryValues) {
+    EXPECT_EQ(encode({0x00}), "--");
+    EXPECT_EQ(encode({0xFF}), "1s");
+    EXPECT_EQ(encode({0xFF, 0xFF, 0xFF, 0xFF}), hhc::HHC_32BIT_ENCODED_MAX_STRING);
+    EXPECT_EQ(decode("1s"), (vector<uint8_t>{0xFF}));
+    EXPECT_EQ(decode(""), vector<uint8_t>{});
+}
+
+TEST(HhcStreamTest, OneShotRoundTrip) {
+    for (std::size_t size = 0; size < 100; ++size) {
+        const vector<uint8_t> bytes = make_bytes(size, size + 1);
+        const string encoded = encode(bytes);
+        ASSERT_EQ(encoded.size(), hhc_stream_encoded_length(size));
+        ASSERT_EQ(decode(encoded), bytes) << "size " << size;
+    }
+}
+
+TEST(HhcStreamTest, IncrementalMatchesOneShotForAnyChunking) {
+    const vector<uint8_t> bytes = make_bytes(1000, 42);
+    const string expected = encode(bytes);
+
+    for (std::size_t chunk : {1U, 3U, 7U, 8U, 9U, 16U, 333U, 1000U}) {
+        stream_encoder encoder;
+        string encoded;
+        for (std::size_t offset = 0; offset < bytes.size(); offset += chunk) {
+            const std::size_t size = std::min(chunk, bytes.size() - offset);
+            string buffer(encoder.max_update_length(size), '\0');
+            buffer.resize(encoder.update(bytes.data() + offset, size, &buffer[0]));
+            encoded += buffer;
+        }
+        char tail[16] = {};
+        encoded.append(tail, encoder.finish(tail));
+        ASSERT_EQ(encoded, expected) << "chunk " << chunk;
+
+        stream_decoder decoder;
+        vector<uint8_t> decoded;
+        for (std::size_t offset = 0; offset < encoded.size(); offset += chunk) {
+            const std::size_t length = std::min(chunk, encoded.size() - offset);
+            vector<uint8_t> buffer(decoder.max_update_size(length));
+            buffer.resize(decoder.update(encoded.data() + offset, length, buffer.data()));
+            decoded.insert(decoded.end(), buffer.begin(), buffer.end());
+        }
+        uint8_t trailing[8] = {};
+        decoded.insert(decoded.end(), trailing, trailing + decoder.finish(trailing));
+        ASSERT_EQ(decoded, bytes) << "chunk " << chunk;
+    }
+}
+
+TEST(HhcStreamTest, EncoderResetsAfterFinish) {
+    stream_encoder encoder;
+    char buffer[32] = {};
+    const uint8_t bytes[] = {1, 2, 3};
+    EXPECT_EQ(encoder.update(bytes, 3, buffer), 0U);
+    EXPECT_EQ(encoder.finish(buffer), 4U);
+    EXPECT_EQ(encoder.finish(buffer), 0U);
+}
+
+TEST(HhcStreamTest, DecodeRejectsInvalidInput) {
+    vector<uint8_t> output(32);
+    EXPECT_THROW(hhc_stream_decode("-", 1, output.data()), std::invalid_argument);
+    EXPECT_THROW(hhc_stream_decode("---!-------", 11, output.data()), std::invalid_argument);
+    EXPECT_THROW(hhc_stream_decode("9lH9ebONzYE", 11, output.data()), std::out_of_range);
+    EXPECT_THROW(hhc_stream_decode("1t", 2, output.data()), std::out_of_range);
+    EXPECT_THROW(hhc_stream_decode("-!", 2, output.data()), std::invalid_argument);
+
+    stream_decoder decoder;
+    EXPECT_EQ(decoder.update("-----", 5, output.data()), 0U);
+    EXPECT_THROW(decoder.finish(output.data()), std::invalid_argument);
+}
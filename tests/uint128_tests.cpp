@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_128bit.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @file uint128_tests.cpp
+ * @brief Unit tests covering the 128-bit codec and the direct UUID path.
+ */
+
+#if defined(__SIZEOF_INT128__)
+
+using hhc::uint128_t;
+using hhc::hhc_128bit_encode_padded;
+using hhc::hhc_128bit_decode_unsafe;
+using hhc::hhc_128bit_decode;
+using hhc::hhc_uuid_parse;
+using hhc::hhc_uuid_format;
+using hhc::hhc_uuid_encode;
+using hhc::hhc_uuid_decode;
+using hhc::HHC_128BIT_ENCODED_LENGTH;
+using hhc::HHC_128BIT_STRING_LENGTH;
+using hhc::HHC_128BIT_ENCODED_MAX_STRING;
+using hhc::HHC_UUID_TEXT_LENGTH;
+
+using std::string;
+
+constexpr uint128_t U128_MAX_VALUE = ~uint128_t{0};
+
+static_assert(hhc_128bit_decode_unsafe("----------------------") == 0);
+static_assert(hhc_128bit_decode(HHC_128BIT_ENCODED_MAX_STRING) == U128_MAX_VALUE);
+static_assert(hhc_uuid_parse("00000000-0000-0001-0000-0000000000ff") == ((uint128_t{1} << 64) | 0xFF));
+
+namespace {
+
+string encode128(uint128_t value) {
+    char buffer[HHC_128BIT_STRING_LENGTH] = {};
+    hhc_128bit_encode_padded(value, buffer);
+    return string(buffer);
+}
+
+uint128_t make128(uint64_t high, uint64_t low) {
+    return (static_cast<uint128_t>(high) << 64) | low;
+}
+
+} // namespace
+
+TEST(Hhc128BitTest, EncodesBoundaryValues) {
+    EXPECT_EQ(encode128(0), "----------------------");
+    EXPECT_EQ(encode128(1), "---------------------.");
+    EXPECT_EQ(encode128(U128_MAX_VALUE), HHC_128BIT_ENCODED_MAX_STRING);
+    EXPECT_EQ(encode128(hhc::detail::BASE_POW_10), "-----------.----------");
+}
+
+TEST(Hhc128BitTest, LowHalfMatches64BitEncoder) {
+    for (uint64_t i = 0; i < 5000; ++i) {
+        const uint64_t value = i * 0x9E3779B97F4A7C15ULL;
+        char expected[hhc::HHC_64BIT_STRING_LENGTH] = {};
+        hhc::hhc_64bit_encode_padded(value, expected);
+        ASSERT_EQ(encode128(value), "-----------" + string(expected));
+    }
+}
+
+TEST(Hhc128BitTest, RoundTripsAcrossRange) {
+    uint64_t state = 1;
+    for (int i = 0; i < 20000; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        const uint128_t value = make128(state, state * 0xD1B54A32D192ED03ULL) >> (i % 128);
+        const string encoded = encode128(value);
+        ASSERT_EQ(encoded.size(), HHC_128BIT_ENCODED_LENGTH);
+        ASSERT_TRUE(hhc_128bit_decode_unsafe(encoded.c_str()) == value);
+        ASSERT_TRUE(hhc_128bit_decode(encoded.c_str()) == value);
+    }
+}
+
+TEST(Hhc128BitTest, DecodeAcceptsUnpaddedStrings) {
+    EXPECT_TRUE(hhc_128bit_decode(".") == 1);
+    EXPECT_TRUE(hhc_128bit_decode(".----------") == hhc::detail::BASE_POW_10);
+    EXPECT_TRUE(hhc_128bit_decode(hhc::HHC_64BIT_ENCODED_MAX_STRING) == UINT64_MAX);
+}
+
+TEST(Hhc128BitTest, DecodeRejectsOutOfRange) {
+    EXPECT_THROW(hhc_128bit_decode("04Ki.mH9tLeAcRProAhwVt"), std::out_of_range);
+    EXPECT_THROW(hhc_128bit_decode("1---------------------"), std::out_of_range);
+    EXPECT_THROW(hhc_128bit_decode("~~~~~~~~~~~~~~~~~~~~~~"), std::out_of_range);
+}
+
+TEST(Hhc128BitTest, DecodeRejectsInvalidInput) {
+    EXPECT_THROW(hhc_128bit_decode(nullptr), std::invalid_argument);
+    EXPECT_THROW(hhc_128bit_decode(""), std::invalid_argument);
+    EXPECT_THROW(hhc_128bit_decode("-----------------------"), std::invalid_argument);
+    EXPECT_THROW(hhc_128bit_decode("--/"), std::invalid_argument);
+}
+
+TEST(HhcUuidTest, ParsesAndFormatsCanonicalStrings) {
+    const char* uuid = "123e4567-e89b-12d3-a456-426614174000";
+    const uint128_t value = hhc_uuid_parse(uuid);
+    EXPECT_TRUE(value == make128(0x123e4567e89b12d3ULL, 0xa456426614174000ULL));
+
+    char formatted[HHC_UUID_TEXT_LENGTH + 1] = {};
+    hhc_uuid_format(value, formatted);
+    EXPECT_STREQ(formatted, uuid);
+
+    EXPECT_TRUE(hhc_uuid_parse("ABCDEF01-2345-6789-AbCd-eF0123456789") ==
+                make128(0xabcdef0123456789ULL, 0xabcdef0123456789ULL));
+    EXPECT_TRUE(hhc_uuid_parse("00000000-0000-0000-0000-000000000000") == 0);
+    EXPECT_TRUE(hhc_uuid_parse("ffffffff-ffff-ffff-ffff-ffffffffffff") == U128_MAX_VALUE);
+}
+
+TEST(HhcUuidTest, EncodesDirectlyToHhc) {
+    char encoded[HHC_128BIT_STRING_LENGTH] = {};
+    hhc_uuid_encode("123e4567-e89b-12d3-a456-426614174000", encoded);
+    EXPECT_STREQ(encoded, "-7rfo~_EbPTIsailhJo.6n");
+
+    char uuid[HHC_UUID_TEXT_LENGTH + 1] = {};
+    hhc_uuid_decode(encoded, uuid);
+    EXPECT_STREQ(uuid, "123e4567-e89b-12d3-a456-426614174000");
+
+    hhc_uuid_decode("-", uuid);
+    EXPECT_STREQ(uuid, "00000000-0000-0000-0000-000000000000");
+}
+
+TEST(HhcUuidTest, RoundTripsEveryHexDigit) {
+    const string hex = "0123456789abcdef";
+    for (std::size_t shift = 0; shift < hex.size(); ++shift) {
+        string uuid;
+        for (std::size_t i = 0; i < 32; ++i) {
+            if (i == 8 || i == 12 || i == 16 || i == 20) {
+                uuid += '-';
+            }
+            uuid += hex[(i * 7 + shift) % hex.size()];
+        }
+        char encoded[HHC_128BIT_STRING_LENGTH] = {};
+        hhc_uuid_encode(uuid.c_str(), encoded);
+        char decoded[HHC_UUID_TEXT_LENGTH + 1] = {};
+        hhc_uuid_decode(encoded, decoded);
+        ASSERT_EQ(string(decoded), uuid);
+    }
+}
+
+TEST(HhcUuidTest, ParsesUuidsOfKnownLength) {
+    // A UUID embedded in a longer buffer, with no terminator after it
+    const string text = "id=123e4567-e89b-12d3-a456-426614174000;";
+    EXPECT_TRUE(hhc_uuid_parse(text.data() + 3, HHC_UUID_TEXT_LENGTH) ==
+                make128(0x123e4567e89b12d3ULL, 0xa456426614174000ULL));
+    EXPECT_THROW(hhc_uuid_parse(text.data() + 3, HHC_UUID_TEXT_LENGTH + 1), std::invalid_argument);
+    EXPECT_THROW(hhc_uuid_parse(text.data() + 3, 8), std::invalid_argument);
+
+    char encoded[HHC_128BIT_STRING_LENGTH] = {};
+    hhc::hhc_uuid_encode(text.data() + 3, HHC_UUID_TEXT_LENGTH, encoded);
+    EXPECT_STREQ(encoded, "-7rfo~_EbPTIsailhJo.6n");
+}
+
+TEST(HhcUuidTest, RejectsMalformedUuids) {
+    EXPECT_THROW(hhc_uuid_parse(nullptr), std::invalid_argument);
+    EXPECT_THROW(hhc_uuid_parse("123e4567e89b-12d3-a456-426614174000-"), std::invalid_argument);
+    EXPECT_THROW(hhc_uuid_parse("123e4567-e89b-12d3-a456_426614174000"), std::invalid_argument);
+    EXPECT_THROW(hhc_uuid_parse("abc"), std::invalid_argument);
+    EXPECT_THROW(hhc_uuid_parse(""), std::invalid_argument);
+    EXPECT_THROW(hhc_uuid_parse("123e4567-e89b-12d3-a456-426614174000x"), std::invalid_argument);
+    EXPECT_THROW(hhc_uuid_parse("123e4567-e89b-12d3-a456-42661417400"), std::invalid_argument);
+
+    const string valid = "123e4567-e89b-12d3-a456-426614174000";
+    for (const char bad : {'g', 'G', '/', ':', '@', '`', ' ', '\x80', '\xff'}) {
+        for (const std::size_t pos : {0U, 7U, 9U, 17U, 22U, 35U}) {
+            string uuid = valid;
+            uuid[pos] = bad;
+            EXPECT_THROW(hhc_uuid_parse(uuid.c_str()), std::invalid_argument) << "position " << pos;
+        }
+    }
+}
+
+#endif // __SIZEOF_INT128__
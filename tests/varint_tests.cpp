@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_varint.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @file varint_tests.cpp
+ * @brief Unit tests covering the self-delimiting varint format for ID lists.
+ */
+
+
+using hhc::decode_varint;
+using hhc::decode_varints;
+using hhc::encode_varint;
+using hhc::encode_varints;
+using hhc::varint_mode;
+using hhc::VARINT_MAX_LENGTH;
+
+using std::string;
+using std::vector;
+
+namespace {
+
+template <typename UInt>
+string varint(UInt value) {
+    string text(VARINT_MAX_LENGTH<UInt>, '\0');
+    text.resize(encode_varint<UInt>(value, text.data()));
+    return text;
+}
+
+} // namespace
+
+TEST(VarintTest, MaxLengthCoversEveryValue) {
+    EXPECT_EQ(VARINT_MAX_LENGTH<uint32_t>, 7U);
+    EXPECT_EQ(VARINT_MAX_LENGTH<uint64_t>, 13U);
+    EXPECT_EQ(varint<uint32_t>(std::numeric_limits<uint32_t>::max()).size(), 7U);
+    EXPECT_EQ(varint<uint64_t>(std::numeric_limits<uint64_t>::max()).size(), 13U);
+}
+
+TEST(VarintTest, SmallValuesTakeOneSymbol) {
+    EXPECT_EQ(varint<uint64_t>(0), "-");
+    EXPECT_EQ(varint<uint64_t>(1), ".");
+    EXPECT_EQ(varint<uint64_t>(2), "0");
+    EXPECT_EQ(varint<uint64_t>(32), "U");
+    // 33 = 1 * 33 + 0: continuation digit 1 ('W'), terminal digit 0 ('-')
+    EXPECT_EQ(varint<uint64_t>(33), "W-");
+    EXPECT_EQ(varint<uint64_t>(33 * 33 - 1), "~U");
+    EXPECT_EQ(varint<uint64_t>(33 * 33).size(), 3U);
+}
+
+TEST(VarintTest, OnlyTheLastSymbolIsTerminal) {
+    const string text = varint<uint64_t>(std::numeric_limits<uint64_t>::max());
+    const auto& inverse = hhc::detail::alphabet_tables<hhc::hhc_alphabet>::INVERSE;
+    for (std::size_t i = 0; i + 1 < text.size(); ++i) {
+        EXPECT_GE(inverse[static_cast<unsigned char>(text[i])], 33) << i;
+    }
+    EXPECT_LT(inverse[static_cast<unsigned char>(text.back())], 33);
+}
+
+TEST(VarintTest, RoundTripsBoundaryAndRandomValues) {
+    vector<uint64_t> values = {0, 1, 32, 33, 1088, 1089, 35936, 35937, std::numeric_limits<uint32_t>::max(),
+                               std::numeric_limits<uint64_t>::max() - 1, std::numeric_limits<uint64_t>::max()};
+    std::mt19937_64 rng(42);
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(rng() >> (rng() % 64));
+    }
+    for (const uint64_t value : values) {
+        const string text = varint<uint64_t>(value);
+        uint64_t decoded = 0;
+        EXPECT_EQ(decode_varint<uint64_t>(text.data(), text.size(), decoded), text.size());
+        EXPECT_EQ(decoded, value);
+    }
+    EXPECT_EQ(decode_varints(encode_varints(values)), values);
+}
+
+TEST(VarintTest, DecodeStopsAtTheTerminalSymbol) {
+    const string text = varint<uint64_t>(123456) + varint<uint64_t>(7);
+    uint64_t value = 0;
+    const std::size_t used = decode_varint<uint64_t>(text.data(), text.size(), value);
+    EXPECT_EQ(value, 123456U);
+    EXPECT_EQ(decode_varint<uint64_t>(text.data() + used, text.size() - used, value), 1U);
+    EXPECT_EQ(value, 7U);
+}
+
+TEST(VarintTest, DeltaModeShrinksSortedLists) {
+    vector<uint64_t> ids;
+    for (uint64_t id = 900000000000ULL; ids.size() < 100; id += 1 + ids.size() % 7) {
+        ids.push_back(id);
+    }
+    const string plain = encode_varints(ids);
+    const string delta = encode_varints(ids, varint_mode::delta);
+    EXPECT_EQ(decode_varints(plain), ids);
+    EXPECT_EQ(decode_varints(delta, varint_mode::delta), ids);
+    EXPECT_LT(delta.size(), plain.size() / 4);
+    // Comma-joined padded encodings take 12 characters per ID
+    EXPECT_LT(delta.size(), ids.size() * 2);
+}
+
+TEST(VarintTest, DeltaModeAcceptsDuplicatesAndRejectsUnsorted) {
+    const vector<uint64_t> repeated = {5, 5, 5, 9};
+    EXPECT_EQ(decode_varints(encode_varints(repeated, varint_mode::delta), varint_mode::delta), repeated);
+    EXPECT_THROW(encode_varints(vector<uint64_t>{5, 4}, varint_mode::delta), std::invalid_argument);
+    EXPECT_NO_THROW(encode_varints(vector<uint64_t>{5, 4}));
+}
+
+TEST(VarintTest, ThirtyTwoBitLists) {
+    const vector<uint32_t> ids = {0, 17, 4000, 4000, 70000, std::numeric_limits<uint32_t>::max()};
+    EXPECT_EQ(decode_varints<uint32_t>(encode_varints(ids)), ids);
+    EXPECT_EQ(decode_varints<uint32_t>(encode_varints(ids, varint_mode::delta), varint_mode::delta), ids);
+}
+
+TEST(VarintTest, EmptyInputs) {
+    EXPECT_EQ(encode_varints(vector<uint64_t>{}), "");
+    EXPECT_TRUE(decode_varints("").empty());
+    EXPECT_TRUE(decode_varints("", varint_mode::delta).empty());
+}
+
+TEST(VarintTest, RejectsMalformedInput) {
+    uint64_t value = 0;
+    // Continuation symbols with no terminal symbol after them
+    EXPECT_THROW(decode_varints("W"), std::invalid_argument);
+    EXPECT_THROW(decode_varints(".~~"), std::invalid_argument);
+    EXPECT_THROW(decode_varint<uint64_t>("W-", 1, value), std::invalid_argument);
+    EXPECT_THROW(decode_varints("0,1"), std::invalid_argument);
+    EXPECT_THROW(decode_varints("0 1"), std::invalid_argument);
+    EXPECT_THROW(decode_varints(string("0\0", 2)), std::invalid_argument);
+}
+
+TEST(VarintTest, RejectsLeadingZeroDigits) {
+    uint64_t value = 0;
+    // 'V' is the continuation symbol for zero; without the check these would all decode like "-"
+    EXPECT_THROW(decode_varint<uint64_t>("V-", 2, value), std::invalid_argument);
+    EXPECT_THROW(decode_varints("VVVV-"), std::invalid_argument);
+    EXPECT_THROW(decode_varints("-V0"), std::invalid_argument);
+    EXPECT_THROW(decode_varints("VW-", varint_mode::delta), std::invalid_argument);
+
+    // Zero digits after the first are ordinary digits
+    EXPECT_EQ(decode_varint<uint64_t>("WV-", 3, value), 3U);
+    EXPECT_EQ(value, 33U * 33U);
+    EXPECT_EQ(varint<uint64_t>(33U * 33U), "WV-");
+    EXPECT_EQ(decode_varints("-"), vector<uint64_t>{0});
+}
+
+TEST(VarintTest, RejectsValuesPastTheIntegerWidth) {
+    const string max64 = varint<uint64_t>(std::numeric_limits<uint64_t>::max());
+    EXPECT_THROW(decode_varints<uint32_t>(max64), std::out_of_range);
+    EXPECT_THROW(decode_varints("~" + max64), std::out_of_range);
+
+    // The largest 13-symbol string is far past 2^64
+    EXPECT_THROW(decode_varints("~~~~~~~~~~~~U"), std::out_of_range);
+
+    // Gaps that each fit but whose running sum overflows
+    const string gaps = max64 + varint<uint64_t>(1);
+    EXPECT_EQ(decode_varints(gaps).size(), 2U);
+    EXPECT_THROW(decode_varints(gaps, varint_mode::delta), std::out_of_range);
+}
+
+TEST(VarintTest, EveryOutputSymbolIsUrlSafe) {
+    const string text = encode_varints(vector<uint64_t>{0, 1ULL << 40, std::numeric_limits<uint64_t>::max()});
+    for (const char c : text) {
+        const bool unreserved = (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') ||
+                                c == '-' || c == '.' || c == '_' || c == '~';
+        EXPECT_TRUE(unreserved) << c;
+    }
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_views.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <vector>
+
+/**
+ * @file views_cxx20_tests.cpp
+ * @brief Unit tests covering the range views as std::ranges views composed with std::views (C++20).
+ */
+
+
+using hhc::hhc64_codec;
+namespace views = hhc::views;
+
+using std::string;
+using std::vector;
+
+using record64 = std::array<char, hhc64_codec::ENCODED_LENGTH>;
+
+static_assert(__cpp_lib_ranges >= 201911L, "views_cxx20_tests.cpp needs <ranges>");
+
+using vector_encode_view = decltype(std::declval<const vector<uint64_t>&>() | views::encode64_padded);
+using vector_decode_view = decltype(std::declval<const vector<string>&>() | views::decode64);
+static_assert(std::ranges::view<vector_encode_view>);
+static_assert(std::ranges::input_range<vector_encode_view>);
+static_assert(std::ranges::sized_range<vector_encode_view>);
+static_assert(std::ranges::view<vector_decode_view>);
+static_assert(std::ranges::input_range<vector_decode_view>);
+
+namespace {
+
+vector<uint64_t> make_ids(std::size_t count) {
+    vector<uint64_t> ids(count);
+    uint64_t seed = 0xD1B54A32D192ED03ULL;
+    for (auto& id : ids) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        id = seed >> (seed & 31U);
+    }
+    return ids;
+}
+
+string padded64(uint64_t value) {
+    char buffer[hhc::HHC_64BIT_STRING_LENGTH] = {};
+    hhc::hhc_64bit_encode_padded(value, buffer);
+    return buffer;
+}
+
+} // namespace
+
+TEST(ViewsCxx20Test, EncodesAStandardViewPipeline) {
+    const vector<uint64_t> ids = make_ids(40);
+    constexpr std::size_t TAKEN = 21;
+    vector<string> encoded;
+    for (const record64& record : ids | std::views::take(TAKEN) | views::encode64_padded) {
+        encoded.emplace_back(record.data(), record.size());
+    }
+    ASSERT_EQ(encoded.size(), TAKEN);
+    for (std::size_t i = 0; i < TAKEN; ++i) {
+        EXPECT_EQ(encoded[i], padded64(ids[i]));
+    }
+}
+
+TEST(ViewsCxx20Test, FeedsStandardViews) {
+    const vector<uint64_t> ids = make_ids(40);
+    auto strings = ids | views::encode64_padded | std::views::drop(3) | std::views::take(5) |
+                   std::views::transform([](const record64& record) { return string(record.data(), record.size()); });
+    vector<string> encoded;
+    std::ranges::copy(strings, std::back_inserter(encoded));
+    ASSERT_EQ(encoded.size(), 5U);
+    for (std::size_t i = 0; i < encoded.size(); ++i) {
+        EXPECT_EQ(encoded[i], padded64(ids[i + 3]));
+    }
+}
+
+TEST(ViewsCxx20Test, RoundTripsThroughAFilterView) {
+    const vector<uint64_t> ids = make_ids(64);
+    auto odd = ids | std::views::filter([](uint64_t id) { return id % 2 == 1; });
+    vector<uint64_t> expected;
+    std::ranges::copy(odd, std::back_inserter(expected));
+
+    // A filter_view is not contiguous, so this takes the element-at-a-time path
+    vector<string> strings;
+    for (const record64& record : odd | views::encode64_padded) {
+        strings.emplace_back(record.data(), record.size());
+    }
+    vector<uint64_t> decoded;
+    std::ranges::copy(strings | views::decode64, std::back_inserter(decoded));
+    EXPECT_EQ(decoded, expected);
+}
+
+TEST(ViewsCxx20Test, DecodesAStandardViewPipeline) {
+    const vector<uint64_t> ids = make_ids(30);
+    auto encoded_view = ids | views::encode64_padded;
+    const vector<record64> records(encoded_view.begin(), encoded_view.end());
+
+    vector<uint64_t> decoded;
+    std::ranges::copy(records | std::views::take(10) | views::decode64, std::back_inserter(decoded));
+    EXPECT_EQ(decoded, vector<uint64_t>(ids.begin(), ids.begin() + 10));
+}
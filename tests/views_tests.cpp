@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_views.hpp"
+
+#include <array>
+#include <cstdint>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file views_tests.cpp
+ * @brief Unit tests covering the lazy encode/decode range views.
+ */
+
+
+using hhc::hhc64_codec;
+namespace views = hhc::views;
+
+using std::string;
+using std::vector;
+
+using record64 = std::array<char, hhc64_codec::ENCODED_LENGTH>;
+
+namespace {
+
+vector<uint64_t> make_ids(std::size_t count) {
+    vector<uint64_t> ids(count);
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    for (auto& id : ids) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        id = seed >> (seed & 31U);
+    }
+    ids.push_back(0);
+    ids.push_back(UINT64_MAX);
+    return ids;
+}
+
+string padded64(uint64_t value) {
+    char buffer[hhc::HHC_64BIT_STRING_LENGTH] = {};
+    hhc::hhc_64bit_encode_padded(value, buffer);
+    return buffer;
+}
+
+} // namespace
+
+TEST(ViewsTest, Encode64ContiguousMatchesScalar) {
+    // 37 + 2 elements cross several 16-element blocks and end on a partial one
+    const vector<uint64_t> ids = make_ids(37);
+    std::size_t index = 0;
+    for (const record64& encoded : ids | views::encode64_padded) {
+        ASSERT_LT(index, ids.size());
+        EXPECT_EQ(string(encoded.data(), encoded.size()), padded64(ids[index]));
+        ++index;
+    }
+    EXPECT_EQ(index, ids.size());
+    EXPECT_EQ((ids | views::encode64_padded).size(), ids.size());
+}
+
+TEST(ViewsTest, Encode64NonContiguousFallsBack) {
+    const std::list<uint64_t> ids = {0, 1, 9876543210ULL, UINT64_MAX};
+    vector<string> encoded;
+    for (const record64& record : ids | views::encode64_padded) {
+        encoded.emplace_back(record.data(), record.size());
+    }
+    EXPECT_EQ(encoded, (vector<string>{"-----------", "----------.", "-----5tVfK4", "9lH9ebONzYD"}));
+}
+
+TEST(ViewsTest, Encode32AcceptsNarrowerIntegers) {
+    const vector<uint16_t> ids = {0, 1, 65535};
+    vector<string> encoded;
+    for (const auto& record : views::encode32_padded(ids)) {
+        encoded.emplace_back(record.data(), record.size());
+    }
+    EXPECT_EQ(encoded, (vector<string>{"------", "-----.", "---D0y"}));
+}
+
+TEST(ViewsTest, SkippingElementsDoesNotEncodeThem) {
+    const vector<uint64_t> ids = make_ids(40);
+    auto view = ids | views::encode64_padded;
+    auto it = view.begin();
+    for (int i = 0; i < 20; ++i) {
+        ++it;
+    }
+    const record64 encoded = *it;
+    EXPECT_EQ(string(encoded.data(), encoded.size()), padded64(ids[20]));
+}
+
+TEST(ViewsTest, RoundTripThroughCollectedRecords) {
+    const vector<uint64_t> ids = make_ids(50);
+    auto encoded_view = ids | views::encode64_padded;
+    const vector<record64> records(encoded_view.begin(), encoded_view.end());
+
+    // Contiguous std::array records take the batched decode path
+    auto decoded_view = records | views::decode64;
+    const vector<uint64_t> decoded(decoded_view.begin(), decoded_view.end());
+    EXPECT_EQ(decoded, ids);
+}
+
+TEST(ViewsTest, Decode64StringLikeElements) {
+    const vector<string> strings = {"-", ".", "5tVfK4", "-----5tVfK4", "9lH9ebONzYD"};
+    vector<uint64_t> decoded;
+    for (uint64_t value : strings | views::decode64) {
+        decoded.push_back(value);
+    }
+    EXPECT_EQ(decoded, (vector<uint64_t>{0, 1, 9876543210ULL, 9876543210ULL, UINT64_MAX}));
+
+    const std::string_view text = "5tVfK4-----";
+    const std::array<std::string_view, 2> slices = {text.substr(0, 6), text.substr(6)};
+    vector<uint64_t> sliced;
+    for (uint64_t value : slices | views::decode64) {
+        sliced.push_back(value);
+    }
+    EXPECT_EQ(sliced, (vector<uint64_t>{9876543210ULL, 0}));
+
+    const char* const c_strings[] = {".TNv", "1QLCp1"};
+    vector<uint32_t> decoded32;
+    for (uint32_t value : c_strings | views::decode32) {
+        decoded32.push_back(value);
+    }
+    EXPECT_EQ(decoded32, (vector<uint32_t>{424242U, UINT32_MAX}));
+}
+
+TEST(ViewsTest, DecodeErrorsSurfaceAtTheOffendingElement) {
+    const vector<uint64_t> ids = make_ids(20);
+    auto encoded_view = ids | views::encode64_padded;
+    vector<record64> records(encoded_view.begin(), encoded_view.end());
+    records[5][3] = '!';
+    records[9] = {'9', 'l', 'H', '9', 'e', 'b', 'O', 'N', 'z', 'Y', 'E'};
+
+    auto decoded_view = records | views::decode64;
+    auto it = decoded_view.begin();
+    for (std::size_t i = 0; i < 5; ++i, ++it) {
+        EXPECT_EQ(*it, ids[i]);
+    }
+    EXPECT_THROW(*it, std::invalid_argument);
+    for (std::size_t i = 5; i < 9; ++i) {
+        ++it;
+    }
+    EXPECT_THROW(*it, std::out_of_range);
+    ++it;
+    EXPECT_EQ(*it, ids[10]);
+
+    const vector<string> strings = {"", "0123456789AB", "a b"};
+    for (const string& text : strings) {
+        auto single = std::array<string, 1>{text} | views::decode64;
+        EXPECT_THROW(*single.begin(), std::invalid_argument) << text;
+    }
+}
+
+TEST(ViewsTest, OwnsRvalueRanges) {
+    auto view = vector<uint64_t>{9876543210ULL} | views::encode64_padded;
+    const record64 encoded = *view.begin();
+    EXPECT_EQ(string(encoded.data(), encoded.size()), "-----5tVfK4");
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "hhc.hpp"
+#include "hhc_wide.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @file wide_tests.cpp
+ * @brief Unit tests covering the char16_t/char32_t encode and decode overloads.
+ */
+
+
+using std::string;
+using std::u16string;
+using std::u32string;
+
+static_assert(hhc::hhc_64bit_decode(u"5tVfK4") == 9876543210ULL);
+static_assert(hhc::hhc_32bit_decode(U".TNv") == 424242U);
+
+namespace {
+
+template <typename WideString>
+string to_narrow(const WideString& wide) {
+    string narrow;
+    for (auto unit : wide) {
+        narrow.push_back(static_cast<char>(unit));
+    }
+    return narrow;
+}
+
+} // namespace
+
+TEST(WideTest, Encode64PaddedMatchesNarrow) {
+    for (uint64_t value : {uint64_t{0}, uint64_t{1}, uint64_t{9876543210ULL}, UINT64_MAX}) {
+        char narrow[hhc::HHC_64BIT_STRING_LENGTH] = {};
+        hhc::hhc_64bit_encode_padded(value, narrow);
+
+        char16_t utf16[hhc::HHC_64BIT_ENCODED_LENGTH] = {};
+        char32_t utf32[hhc::HHC_64BIT_ENCODED_LENGTH] = {};
+        hhc::hhc_64bit_encode_padded(value, utf16);
+        hhc::hhc_64bit_encode_padded(value, utf32);
+        EXPECT_EQ(to_narrow(u16string(utf16, hhc::HHC_64BIT_ENCODED_LENGTH)), narrow);
+        EXPECT_EQ(to_narrow(u32string(utf32, hhc::HHC_64BIT_ENCODED_LENGTH)), narrow);
+    }
+}
+
+TEST(WideTest, EncodeUnpadded) {
+    char16_t utf16[hhc::HHC_32BIT_STRING_LENGTH];
+    hhc::hhc_32bit_encode_unpadded(424242U, utf16);
+    EXPECT_EQ(u16string(utf16), u".TNv");
+
+    char32_t utf32[hhc::HHC_64BIT_STRING_LENGTH];
+    hhc::hhc_64bit_encode_unpadded(9876543210ULL, utf32);
+    EXPECT_EQ(u32string(utf32), U"5tVfK4");
+
+    hhc::hhc_64bit_encode_unpadded(0, utf32);
+    EXPECT_EQ(u32string(utf32), U"");
+}
+
+TEST(WideTest, DecodeUnsafe) {
+    EXPECT_EQ(hhc::hhc_32bit_decode_unsafe(u"--.TNv"), 424242U);
+    EXPECT_EQ(hhc::hhc_64bit_decode_unsafe(U"9lH9ebONzYD"), UINT64_MAX);
+}
+
+TEST(WideTest, DecodeNullTerminated) {
+    EXPECT_EQ(hhc::hhc_32bit_decode(u"-"), 0U);
+    EXPECT_EQ(hhc::hhc_32bit_decode(u"1QLCp1"), UINT32_MAX);
+    EXPECT_EQ(hhc::hhc_64bit_decode(U"-----5tVfK4"), 9876543210ULL);
+    EXPECT_EQ(hhc::hhc_64bit_decode(u"9lH9ebONzYD"), UINT64_MAX);
+
+    EXPECT_THROW(hhc::hhc_32bit_decode(u""), std::invalid_argument);
+    EXPECT_THROW(hhc::hhc_32bit_decode(u"1234567"), std::invalid_argument);
+    EXPECT_THROW(hhc::hhc_64bit_decode(U"9lH9ebONzYE"), std::out_of_range);
+    EXPECT_THROW(hhc::hhc_32bit_decode(u"1QLCp2"), std::out_of_range);
+    EXPECT_THROW(hhc::hhc_64bit_decode(static_cast<const char16_t*>(nullptr)), std::invalid_argument);
+}
+
+TEST(WideTest, DecodeRejectsNonAsciiUnits) {
+    // Code units whose low byte is a valid symbol must not alias to it
+    const char16_t shadow_dot[] = {u'-', static_cast<char16_t>(0x012E), 0};  // U+012E has low byte '.'
+    EXPECT_THROW(hhc::hhc_64bit_decode(shadow_dot), std::invalid_argument);
+
+    const char32_t shadow_a[] = {static_cast<char32_t>(0x1F600), U'A', 0};
+    EXPECT_THROW(hhc::hhc_32bit_decode(shadow_a), std::invalid_argument);
+
+    EXPECT_THROW(hhc::hhc_64bit_decode(u"5téfK4"), std::invalid_argument);
+    EXPECT_THROW(hhc::hhc_64bit_decode(u"5t fK4"), std::invalid_argument);
+}
+
+TEST(WideTest, DecodeWithLength) {
+    const u16string text = u"5tVfK4.TNv";
+    EXPECT_EQ(hhc::hhc_64bit_decode(text.data(), 6), 9876543210ULL);
+    EXPECT_EQ(hhc::hhc_32bit_decode(text.data() + 6, 4), 424242U);
+    EXPECT_THROW(hhc::hhc_64bit_decode(text.data(), 0), std::invalid_argument);
+    EXPECT_THROW(hhc::hhc_32bit_decode(text.data(), 7), std::invalid_argument);
+}
+
+TEST(WideTest, RoundTrip) {
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    for (int i = 0; i < 1000; ++i) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        char16_t utf16[hhc::HHC_64BIT_STRING_LENGTH] = {};
+        hhc::hhc_64bit_encode_padded(seed, utf16);
+        ASSERT_EQ(hhc::hhc_64bit_decode(utf16), seed);
+        ASSERT_EQ(hhc::hhc_64bit_decode_unsafe(utf16), seed);
+    }
+}
+
+TEST(WideTest, Validate) {
+    EXPECT_EQ(hhc::hhc_validate_string(u"5tVfK4"), 6U);
+    EXPECT_EQ(hhc::hhc_validate_string(U"-"), 1U);
+    EXPECT_EQ(hhc::hhc_validate_string(u""), 0U);
+    EXPECT_EQ(hhc::hhc_validate_string(u"5tĮK4"), 0U);
+    EXPECT_EQ(hhc::hhc_validate_string(U"a b"), 0U);
+    for (const char16_t gap : {u'/', u':', u'@', u'[', u'\\', u'^', u'`', u'{', u'|', u'}'}) {
+        const char16_t text[] = {u'5', gap, u'V', u'\0'};
+        EXPECT_EQ(hhc::hhc_validate_string(text), 0U) << static_cast<int>(gap);
+    }
+}